@@ -5708,6 +5708,8 @@ GenRet CallExpr::codegen() {
       fname = "chpl_executeOnNB";
     else if (fn->hasFlag(FLAG_FAST_ON))
       fname = "chpl_executeOnFast";
+    else if (fn->hasFlag(FLAG_BATCH_ON))
+      fname = "chpl_executeOnBatch";
     else
       fname = "chpl_executeOn";
 
@@ -6061,10 +6063,11 @@ get_string(Expr* e) {
 }
 
 // This builds an allocation of enough space to hold a variable of the
-// given type.
+// given type.  If taskLocal is set, the space comes from the task arena
+// and must be freed by the same task, with callChplHereFree(p, true).
 //
 // This function should be used *before* resolution
-CallExpr* callChplHereAlloc(Symbol *s, VarSymbol* md) {
+CallExpr* callChplHereAlloc(Symbol *s, VarSymbol* md, bool taskLocal) {
   CallExpr* sizeExpr;
   VarSymbol* mdExpr;
   INT_ASSERT(!resolved);
@@ -6072,7 +6075,9 @@ CallExpr* callChplHereAlloc(Symbol *s, VarSymbol* md) {
   // this sizeof() call to take the resolved type of s as an argument
   sizeExpr = new CallExpr(PRIM_SIZEOF, new SymExpr(s));
   mdExpr = (md != NULL) ? md : newMemDesc(s->name);
-  CallExpr* allocExpr = new CallExpr("chpl_here_alloc", sizeExpr, mdExpr);
+  CallExpr* allocExpr = new CallExpr(taskLocal ? "chpl_here_task_alloc"
+                                               : "chpl_here_alloc",
+                                     sizeExpr, mdExpr);
   // Again, as we don't know the type yet, we leave it to resolution
   // to put in the cast to the proper type
   return allocExpr;
@@ -6083,7 +6088,7 @@ CallExpr* callChplHereAlloc(Symbol *s, VarSymbol* md) {
 //
 // This function should be used *after* resolution
 void insertChplHereAlloc(Expr *call, bool insertAfter, Symbol *sym,
-                         Type* t, VarSymbol* md) {
+                         Type* t, VarSymbol* md, bool taskLocal) {
   INT_ASSERT(resolved);
   AggregateType* ct = toAggregateType(toTypeSymbol(t->symbol)->type);
   Symbol* sizeTmp = newTemp("chpl_here_alloc_size", SIZE_TYPE);
@@ -6094,7 +6099,9 @@ void insertChplHereAlloc(Expr *call, bool insertAfter, Symbol *sym,
   VarSymbol* mdExpr = (md != NULL) ? md : newMemDesc(t->symbol->name);
   Symbol *allocTmp = newTemp("chpl_here_alloc_tmp", dtCVoidPtr);
   CallExpr* allocExpr = new CallExpr(PRIM_MOVE, allocTmp,
-                                     new CallExpr(gChplHereAlloc,
+                                     new CallExpr(taskLocal ?
+                                                  gChplHereTaskAlloc :
+                                                  gChplHereAlloc,
                                                   sizeTmp, mdExpr));
   CallExpr* castExpr = new CallExpr(PRIM_MOVE, sym,
                                     new CallExpr(PRIM_CAST,
@@ -6116,7 +6123,7 @@ void insertChplHereAlloc(Expr *call, bool insertAfter, Symbol *sym,
 
 
 // Similar to callChplHereAlloc(), above but this can be called any time
-CallExpr* callChplHereFree(BaseAST* p) {
+CallExpr* callChplHereFree(BaseAST* p, bool taskLocal) {
   // Don't have a good way to do the following?
   //if (fNoMemoryFrees)
   //  return;
@@ -6129,9 +6136,11 @@ CallExpr* callChplHereFree(BaseAST* p) {
   // needed
   CallExpr* castExpr = new CallExpr(PRIM_CAST_TO_VOID_STAR, p);
   if (!resolved)
-    return new CallExpr("chpl_here_free", castExpr);
+    return new CallExpr(taskLocal ? "chpl_here_task_free" : "chpl_here_free",
+                        castExpr);
   else {
-    return new CallExpr(gChplHereFree, castExpr);
+    return new CallExpr(taskLocal ? gChplHereTaskFree : gChplHereFree,
+                        castExpr);
   }
 }
 
@@ -93,6 +93,8 @@ VarSymbol *gModuleInitIndentLevel = NULL;
 FnSymbol *gPrintModuleInitFn = NULL;
 FnSymbol* gChplHereAlloc = NULL;
 FnSymbol* gChplHereFree = NULL;
+FnSymbol* gChplHereTaskAlloc = NULL;
+FnSymbol* gChplHereTaskFree = NULL;
 
 std::map<FnSymbol*,int> ftableMap;
 Vec<FnSymbol*> ftableVec;
@@ -755,7 +757,7 @@ GenRet VarSymbol::codegen() {
 }
 
 
-void VarSymbol::codegenDefC(bool global) {
+void VarSymbol::codegenDefC(bool global, bool isHeader) {
   GenInfo* info = gGenInfo;
   if (this->hasFlag(FLAG_EXTERN))
     return;
@@ -770,11 +772,17 @@ void VarSymbol::codegenDefC(bool global) {
 
   //
   // a variable can be codegen'd as static if it is global and neither
-  // exported nor external.
+  // exported nor external.  With --incremental, globals are shared by
+  // the separately compiled modules, so the header declares them extern
+  // and _main.c defines them.
   //
-  bool isStatic =  global && !hasFlag(FLAG_EXPORT) && !hasFlag(FLAG_EXTERN);
+  bool isStatic =  global && !hasFlag(FLAG_EXPORT) && !hasFlag(FLAG_EXTERN) &&
+                   !fIncrementalCompilation;
 
-  std::string str = (isStatic ? "static " : "") + typestr + " " + cname;
+  std::string str = (isStatic ? "static " : "");
+  if (isHeader)
+    str += "extern ";
+  str += typestr + " " + cname;
   if (ct) {
     if (ct->isClass()) {
       if (isFnSymbol(defPoint->parentSymbol)) {
@@ -798,7 +806,7 @@ void VarSymbol::codegenDefC(bool global) {
   info->cLocalDecls.push_back(str);
 }
 
-void VarSymbol::codegenGlobalDef() {
+void VarSymbol::codegenGlobalDef(bool isHeader) {
   GenInfo* info = gGenInfo;
 
   if( id == breakOnCodegenID ||
@@ -808,7 +816,7 @@ void VarSymbol::codegenGlobalDef() {
   }
 
   if( info->cfile ) {
-    codegenDefC(/*global=*/true);
+    codegenDefC(/*global=*/true, isHeader);
   } else {
 #ifdef HAVE_LLVM
     if(type == dtVoid) {
@@ -1872,9 +1880,11 @@ void FnSymbol::codegenHeaderC(void) {
 
   //
   // A function prototype can be labeled static if it is neither
-  // exported nor external
+  // exported nor external, and either modules are not compiled
+  // separately or no other module refers to it
   //
-  if (!hasFlag(FLAG_EXPORT) && !hasFlag(FLAG_EXTERN)) {
+  if (!hasFlag(FLAG_EXPORT) && !hasFlag(FLAG_EXTERN) &&
+      (!fIncrementalCompilation || hasFlag(FLAG_MODULE_LOCAL))) {
     fprintf(outfile, "static ");
   }
   fprintf(outfile, "%s", codegenFunctionType(true).c.c_str());
@@ -2611,6 +2621,17 @@ void ModuleSymbol::codegenDef() {
   flushStatements();
 }
 
+// With --incremental, the functions only this module refers to are
+// prototyped in its own file rather than in chpl__header.h.
+void ModuleSymbol::codegenLocalPrototypes() {
+  for_alist(expr, block->body) {
+    if (DefExpr* def = toDefExpr(expr))
+      if (FnSymbol* fn = toFnSymbol(def->sym))
+        if (fn->hasFlag(FLAG_MODULE_LOCAL))
+          fn->codegenPrototype();
+  }
+}
+
 // Collect the top-level classes for this Module.
 //
 // 2014/07/25 MDN.  This function is currently only called by
@@ -166,6 +166,7 @@ extern bool fWarnConstLoops;
 extern bool fReportOptimizedLoopIterators;
 extern bool fReportOrderIndependentLoops;
 extern bool fReportOptimizedOn;
+extern bool fReportBatchedOn;
 extern bool fReportPromotion;
 extern bool fReportScalarReplace;
 extern bool fReportDeadBlocks;
@@ -173,6 +174,7 @@ extern bool fReportDeadModules;
 
 extern bool debugCCode;
 extern bool optimizeCCode;
+extern bool fIncrementalCompilation;
 extern bool specializeCCode;
 
 extern bool fNoMemoryFrees;
@@ -353,10 +353,12 @@ bool get_uint(Expr *e, uint64_t *i); // false is failure
 bool get_string(Expr *e, const char **s); // false is failure
 const char* get_string(Expr* e); // fatal on failure
 
-CallExpr* callChplHereAlloc(Symbol *s, VarSymbol* md = NULL);
+CallExpr* callChplHereAlloc(Symbol *s, VarSymbol* md = NULL,
+                            bool taskLocal = false);
 void insertChplHereAlloc(Expr *call, bool insertAfter, Symbol *sym,
-                         Type* t, VarSymbol* md = NULL);
-CallExpr* callChplHereFree(BaseAST* p);
+                         Type* t, VarSymbol* md = NULL,
+                         bool taskLocal = false);
+CallExpr* callChplHereFree(BaseAST* p, bool taskLocal = false);
 
 // Walk the subtree of expressions rooted at "expr" in postorder, returning the
 // current expression in "e", stopping after "expr" has been returned.
@@ -28,6 +28,7 @@
 
 extern char executableFilename[FILENAME_MAX+1];
 extern char saveCDir[FILENAME_MAX+1];
+extern char objectCacheDir[FILENAME_MAX+1];
 extern std::string ccflags;
 extern std::string ldflags;
 extern bool ccwarnings;
@@ -41,7 +42,13 @@ struct fileinfo {
   const char* pathname;
 };
 
-void codegen_makefile(fileinfo* mainfile, const char** tmpbinname=NULL, bool skip_compile_link=false);
+void codegen_makefile(fileinfo* mainfile, const char** tmpbinname=NULL,
+                      bool skip_compile_link=false,
+                      const std::vector<const char*>& splitFiles =
+                        std::vector<const char*>());
+
+void restoreCachedObjects();
+void saveCachedObjects();
 
 void ensureDirExists(const char* /* dirname */, const char* /* explanation */);
 const char* getCwd();
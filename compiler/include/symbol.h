@@ -215,10 +215,10 @@ public:
   const char* doc;
 
   GenRet codegen();
-  void codegenDefC(bool global = false);
+  void codegenDefC(bool global = false, bool isHeader = false);
   void codegenDef();
   // global vars are different ...
-  void codegenGlobalDef();
+  void codegenGlobalDef(bool isHeader = false);
 
   virtual void printDocs(std::ostream *file, unsigned int tabs);
 
@@ -464,6 +464,7 @@ public:
   // Interface to Symbol
   virtual void replaceChild(BaseAST* old_ast, BaseAST* new_ast);
   virtual void codegenDef();
+  void         codegenLocalPrototypes();
 
   // New interface
   Vec<AggregateType*>  getTopLevelClasses();
@@ -618,6 +619,8 @@ extern VarSymbol *gModuleInitIndentLevel;
 extern FnSymbol *gPrintModuleInitFn;
 extern FnSymbol *gChplHereAlloc;
 extern FnSymbol *gChplHereFree;
+extern FnSymbol *gChplHereTaskAlloc;
+extern FnSymbol *gChplHereTaskFree;
 
 extern Symbol *gSyncVarAuxFields;
 extern Symbol *gSingleVarAuxFields;
@@ -169,6 +169,7 @@ bool fPrintDispatch = false;
 bool fReportOptimizedLoopIterators = false;
 bool fReportOrderIndependentLoops = false;
 bool fReportOptimizedOn = false;
+bool fReportBatchedOn = false;
 bool fReportPromotion = false;
 bool fReportScalarReplace = false;
 bool fReportDeadBlocks = false;
@@ -195,6 +196,7 @@ int breakOnCodegenID = 0;
 bool debugCCode = false;
 bool optimizeCCode = false;
 bool specializeCCode = false;
+bool fIncrementalCompilation = false;
 
 bool fNoMemoryFrees = false;
 int numGlobalsOnHeap = 0;
@@ -706,6 +708,8 @@ static ArgumentDescription arg_desc[] = {
  {"debug", 'g', NULL, "[Don't] Support debugging of generated C code", "N", &debugCCode, "CHPL_DEBUG", setChapelDebug},
  {"dynamic", ' ', NULL, "Generate a dynamically linked binary", "F", &fLinkStyle, NULL, setDynamicLink},
  {"hdr-search-path", 'I', "<directory>", "C header search path", "P", incFilename, NULL, handleIncDir},
+ {"incremental", ' ', NULL, "Enable [disable] compiling the generated code for each module separately and in parallel", "N", &fIncrementalCompilation, "CHPL_INCREMENTAL", NULL},
+ {"object-cache", ' ', "<directory>", "Reuse objects compiled from unchanged generated modules, kept in directory (implies --incremental)", "P", objectCacheDir, "CHPL_OBJECT_CACHE_DIR", NULL},
  {"ldflags", ' ', "<flags>", "Back-end C linker flags (can be specified multiple times)", "S", NULL, "CHPL_LD_FLAGS", setLDFlags},
  {"lib-linkage", 'l', "<library>", "C library linkage", "P", libraryFilename, "CHPL_LIB_NAME", handleLibrary},
  {"lib-search-path", 'L', "<directory>", "C library search path", "P", libraryFilename, "CHPL_LIB_PATH", handleLibPath},
@@ -798,6 +802,7 @@ static ArgumentDescription arg_desc[] = {
  {"report-dead-modules", ' ', NULL, "Print dead module removal stats", "F", &fReportDeadModules, NULL, NULL},
  {"report-optimized-loop-iterators", ' ', NULL, "Print stats on optimized single loop iterators", "F", &fReportOptimizedLoopIterators, NULL, NULL},
  {"report-order-independent-loops", ' ', NULL, "Print stats on order independent loops", "F", &fReportOrderIndependentLoops, NULL, NULL},
+ {"report-batched-on", ' ', NULL, "Print information about on clauses that may be batched with other on clauses to the same locale", "F", &fReportBatchedOn, NULL, NULL},
  {"report-optimized-on", ' ', NULL, "Print information about on clauses that have been optimized for potential fast remote fork operation", "F", &fReportOptimizedOn, NULL, NULL},
  {"report-promotion", ' ', NULL, "Print information about scalar promotion", "F", &fReportPromotion, NULL, NULL},
  {"report-scalar-replace", ' ', NULL, "Print scalar replacement stats", "F", &fReportScalarReplace, NULL, NULL},
@@ -1101,6 +1106,12 @@ static void postStaticLink() {
   }
 }
 
+static void postObjectCache() {
+  // cached objects are per module, so need the modules compiled separately
+  if (objectCacheDir[0] != '\0')
+    fIncrementalCompilation = true;
+}
+
 static void postLocal() {
   if (!fUserSetLocal) fLocal = !strcmp(CHPL_COMM, "none");
 }
@@ -1153,6 +1164,8 @@ static void postprocess_args() {
 
   postStaticLink();
 
+  postObjectCache();
+
   setPrintCppLineno();
 
   checkLLVMCodeGen();
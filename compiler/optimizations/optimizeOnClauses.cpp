@@ -23,6 +23,9 @@
 // The comm layer can provide a "fast" option, for example, run within
 //  the handler (rather than creating a new task).
 //
+// Also confirm or drop the "batch on" marking that parallel() placed on
+//  blocking on statements in order-independent loops.
+//
 
 #include <vector>
 #include "stlUtil.h"
@@ -405,10 +408,111 @@ markFastSafeFn(FnSymbol *fn, int recurse, Vec<FnSymbol*> *visited) {
 }
 
 
+//
+// Return true if this primitive may make the calling task wait for
+// another task to fill or empty a sync/single variable.  Merely locking
+// one is fine, since the holder doesn't wait on us to release it.
+//
+static bool
+isWaitingPrimitive(CallExpr *call) {
+  INT_ASSERT(call->primitive);
+  switch (call->primitive->tag) {
+  case PRIM_SYNC_WAIT_FULL:
+  case PRIM_SYNC_WAIT_EMPTY:
+  case PRIM_SINGLE_WAIT_FULL:
+  case PRIM_WRITEEF:
+  case PRIM_WRITEFF:
+  case PRIM_READFE:
+  case PRIM_READFF:
+  case PRIM_SINGLE_WRITEEF:
+  case PRIM_SINGLE_READFF:
+  case PRIM_FTABLE_CALL:
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+//
+// Return true if calling this extern may make the calling task wait for
+// another task.  Runtime entry points are known not to, apart from the
+// ones listed here; user externs cannot be analyzed.  Spinning on
+// chpl_task_yield() is how the modules implement short-held locks, such
+// as the one protecting Block's remote access cache, so it is allowed.
+//
+static bool
+isWaitingExtern(FnSymbol *fn) {
+  INT_ASSERT(fn->hasFlag(FLAG_EXTERN));
+  if (fn->getModule()->modTag == MOD_USER)
+    return true;
+
+  return !strcmp(fn->cname, "chpl_comm_barrier");
+}
+
+//
+// Return true if the body of this on clause can be run back to back with
+// other on clauses in a single task on the target locale, i.e., it never
+// waits for another task to make progress.  Unlike markFastSafeFn(), this
+// allows communication, nested on clauses and arbitrarily deep calls.
+//
+static bool
+markBatchSafeFn(FnSymbol *fn, Vec<FnSymbol*> *visited) {
+  if (fn->hasFlag(FLAG_EXTERN))
+    return !isWaitingExtern(fn);
+
+  visited->add_exclusive(fn);
+
+  std::vector<CallExpr*> calls;
+
+  collectCallExprs(fn, calls);
+
+  for_vector(CallExpr, call, calls) {
+    FnSymbol* callee = NULL;
+
+    if (call->isPrimitive(PRIM_VIRTUAL_METHOD_CALL)) {
+      callee = toFnSymbol(toSymExpr(call->get(1))->var);
+      if (Vec<FnSymbol*>* children = virtualChildrenMap.get(callee)) {
+        forv_Vec(FnSymbol, child, *children) {
+          if (!visited->in(child) && !markBatchSafeFn(child, visited)) {
+            DEBUG_PRINTF("\tbatch FAILED (virtual call, id=%d)\n", call->id);
+            return false;
+          }
+        }
+      }
+    } else if (call->primitive) {
+      if (isWaitingPrimitive(call)) {
+        DEBUG_PRINTF("\tbatch FAILED (primitive %s, id=%d)\n",
+                     call->primitive->name, call->id);
+        return false;
+      }
+      continue;
+    } else {
+      callee = call->isResolved();
+      if (!callee) {
+        DEBUG_PRINTF("\tbatch FAILED (function not resolved, id=%d)\n",
+                     call->id);
+        return false;
+      }
+    }
+
+    if (!visited->in(callee) && !markBatchSafeFn(callee, visited)) {
+      DEBUG_PRINTF("\tbatch FAILED (call to %s, id=%d)\n",
+                   callee->cname, call->id);
+      return false;
+    }
+  }
+  return true;
+}
+
+
 void
 optimizeOnClauses(void) {
-  if (fNoOptimizeOnClauses)
+  if (fNoOptimizeOnClauses) {
+    forv_Vec(FnSymbol, fn, gFnSymbols)
+      fn->removeFlag(FLAG_BATCH_ON);
     return;
+  }
 
   compute_call_sites();
 
@@ -436,5 +540,22 @@ optimizeOnClauses(void) {
         }
       }
     }
+
+    if (fn->hasFlag(FLAG_BATCH_ON)) {
+      Vec<FnSymbol*> batchVisited;
+
+      // A fast on clause is cheaper to run than a batched one.
+      if (fn->hasFlag(FLAG_FAST_ON) || !markBatchSafeFn(fn, &batchVisited)) {
+        fn->removeFlag(FLAG_BATCH_ON);
+      } else if (fReportBatchedOn) {
+        ModuleSymbol *mod = toModuleSymbol(fn->defPoint->parentSymbol);
+        INT_ASSERT(mod);
+        if (developer ||
+            ((mod->modTag != MOD_INTERNAL) && (mod->modTag != MOD_STANDARD))) {
+          printf("Batched on clause (%s) in module %s (%s:%d)\n",
+                 fn->cname, mod->name, fn->fname(), fn->linenum());
+        }
+      }
+    }
   }
 }
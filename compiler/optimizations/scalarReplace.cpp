@@ -181,6 +181,15 @@ unifyClassInstances(Symbol* sym) {
   return true;
 }
 
+//
+// Is fn one of the frees paired with a chpl_here_*alloc() allocator?
+//
+static bool
+isHereFree(FnSymbol* fn) {
+  return fn && (fn->hasFlag(FLAG_LOCALE_MODEL_FREE) ||
+                fn->hasFlag(FLAG_TASK_LOCAL_FREE));
+}
+
 static bool
 scalarReplaceClass(AggregateType* ct, Symbol* sym) {
 
@@ -238,7 +247,7 @@ scalarReplaceClass(AggregateType* ct, Symbol* sym) {
              (call->isResolved()->hasFlag(FLAG_ALLOCATOR) ||
               // TODO: don't know this is necessary as the arg to free
               // is a void *
-              call->isResolved()->hasFlag(FLAG_LOCALE_MODEL_FREE)))))
+              isHereFree(call->isResolved())))))
         return false;
     }
   }
@@ -288,8 +297,7 @@ scalarReplaceClass(AggregateType* ct, Symbol* sym) {
       } else if (call->isPrimitive(PRIM_SETCID) ||
                  // TODO: don't know if this is still needed.  The
                  // PRIM_CAST_TO_VOID_STAR case may take care of it.
-                 (call->isResolved() &&
-                  call->isResolved()->hasFlag(FLAG_LOCALE_MODEL_FREE))) {
+                 isHereFree(call->isResolved())) {
         //
         // we can remove the setting of the cid because it is never
         // used and we are otherwise able to remove the class
@@ -302,8 +310,7 @@ scalarReplaceClass(AggregateType* ct, Symbol* sym) {
         INT_ASSERT(parent);
         CallExpr* parentNext = toCallExpr(parent->next);
         if (parentNext &&
-            parentNext->isResolved() &&
-            parentNext->isResolved()->hasFlag(FLAG_LOCALE_MODEL_FREE))
+            isHereFree(parentNext->isResolved()))
           parentNext->remove();
         parent->remove();
       } else if (call->isPrimitive(PRIM_SET_MEMBER)) {
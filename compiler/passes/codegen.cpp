@@ -37,11 +37,13 @@
 #include "insertLineNumbers.h"
 
 #include <inttypes.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <cctype>
 #include <cstring>
 #include <cstdio>
+#include <set>
 #include <vector>
 
 // Global so that we don't have to pass around
@@ -135,7 +137,10 @@ genGlobalDefClassId(const char* cname, int id) {
   name += cname;
   
   if( info->cfile ) {
-    fprintf(info->cfile, "const %s %s = %d;\n", 
+    // With --incremental, every module includes the header, so each
+    // gets its own copy of the constant.
+    fprintf(info->cfile, "%sconst %s %s = %d;\n",
+                      fIncrementalCompilation ? "static " : "",
                       id_type_name, name.c_str(), id);
   } else {
 #ifdef HAVE_LLVM
@@ -712,8 +717,45 @@ static void protectNameFromC(Symbol* sym) {
 }
 
 
+//
+// With --incremental, a function that is only referenced by the module
+// defining it stays static and is prototyped in that module's file, so
+// the C compiler can still inline it and drop unused copies as it does
+// when everything is compiled as one unit.  The function pointer and
+// virtual method tables in _main.c refer to the functions they hold.
+//
+static void markModuleLocalFunctions(std::vector<FnSymbol*>& functions) {
+  std::set<FnSymbol*> shared;
+
+  forv_Vec(SymExpr, se, gSymExprs) {
+    if (FnSymbol* fn = toFnSymbol(se->var))
+      if (se->getModule() != fn->getModule())
+        shared.insert(fn);
+  }
+
+  for (int i = 0; i < virtualMethodTable.n; i++) {
+    if (virtualMethodTable.v[i].key) {
+      forv_Vec(FnSymbol, fn, *virtualMethodTable.v[i].value) {
+        shared.insert(fn);
+      }
+    }
+  }
+
+  for_vector(FnSymbol, fn, functions) {
+    if (shared.count(fn) ||
+        !isModuleSymbol(fn->defPoint->parentSymbol) ||
+        fn->hasFlag(FLAG_EXPORT) ||
+        fn->hasFlag(FLAG_EXTERN) ||
+        fn->hasFlag(FLAG_BEGIN_BLOCK) ||
+        fn->hasFlag(FLAG_COBEGIN_OR_COFORALL_BLOCK) ||
+        fn->hasFlag(FLAG_ON_BLOCK))
+      continue;
+    fn->addFlag(FLAG_MODULE_LOCAL);
+  }
+}
+
 // TODO: Split this into a number of smaller routines.<hilde>
-static void codegen_header() {
+static void codegen_header(FILE* mainfile) {
   GenInfo* info = gGenInfo;
   Vec<const char*> cnames;
   Vec<TypeSymbol*> types;
@@ -899,6 +941,13 @@ static void codegen_header() {
 
   FILE* hdrfile = info->cfile;
 
+  //
+  // With --incremental, chpl__header.h is included by every separately
+  // compiled module, so it only declares the tables and globals below;
+  // they are defined in _main.c instead.
+  //
+  FILE* defsfile = fIncrementalCompilation ? mainfile : hdrfile;
+
   if( hdrfile ) {
     // This is done in runClang for LLVM version.
     fprintf(hdrfile, "\n#define CHPL_GEN_CODE\n\n");
@@ -911,7 +960,7 @@ static void codegen_header() {
     fprintf(hdrfile, "#include \"stdchpl.h\"\n");
 
     // Include the compilation config file
-    fprintf(hdrfile, "#include \"%s.c\"\n", sCfgFname);
+    fprintf(defsfile, "#include \"%s.c\"\n", sCfgFname);
 
 #ifdef HAVE_LLVM
     //include generated extern C header file
@@ -991,11 +1040,27 @@ static void codegen_header() {
   }
 
 
+  if (fIncrementalCompilation)
+    markModuleLocalFunctions(functions);
+
   genComment("Function Prototypes");
   for_vector(FnSymbol, fnSymbol, functions) {
-    fnSymbol->codegenPrototype();
+    if (!fnSymbol->hasFlag(FLAG_MODULE_LOCAL))
+      fnSymbol->codegenPrototype();
   }
     
+  if (fIncrementalCompilation && hdrfile) {
+    fprintf(hdrfile, "\nextern chpl_fn_p chpl_vmtable[];\n");
+
+    genComment("Global Variables");
+    forv_Vec(VarSymbol, varSymbol, globals) {
+      varSymbol->codegenGlobalDef(/*isHeader=*/true);
+    }
+    flushStatements();
+  }
+
+  info->cfile = defsfile;
+
   genComment("Function Pointer Table");
   for_vector(FnSymbol, fn2, functions) {
     if (fn2->hasFlag(FLAG_BEGIN_BLOCK) ||
@@ -1020,8 +1085,8 @@ static void codegen_header() {
   genGlobalInt("chpl_numGlobalsOnHeap", numGlobalsOnHeap);
   int globals_registry_static_size = (numGlobalsOnHeap ? numGlobalsOnHeap : 1);
   if( hdrfile ) {
-    fprintf(hdrfile, "\nptr_wide_ptr_t chpl_globals_registry[%d];\n",
-                     globals_registry_static_size);
+    fprintf(defsfile, "\nptr_wide_ptr_t chpl_globals_registry[%d];\n",
+                      globals_registry_static_size);
   } else {
 #ifdef HAVE_LLVM
     llvm::Type* ptr_wide_ptr_t = info->lvt->getType("ptr_wide_ptr_t");
@@ -1046,15 +1111,15 @@ static void codegen_header() {
   }
   genGlobalInt("chpl_heterogeneous", fHeterogeneous?1:0);
   if( hdrfile ) {
-    fprintf(hdrfile, "\nconst char* chpl_mem_descs[] = {\n");
+    fprintf(defsfile, "\nconst char* chpl_mem_descs[] = {\n");
     bool first = true;
     forv_Vec(const char*, memDesc, memDescsVec) {
       if (!first)
-        fprintf(hdrfile, ",\n");
-      fprintf(hdrfile, "\"%s\"", memDesc);
+        fprintf(defsfile, ",\n");
+      fprintf(defsfile, "\"%s\"", memDesc);
       first = false;
     }
-    fprintf(hdrfile, "\n};\n");
+    fprintf(defsfile, "\n};\n");
   } else {
 #ifdef HAVE_LLVM
     std::vector<llvm::Constant *> memDescTable;
@@ -1086,17 +1151,17 @@ static void codegen_header() {
   // add table of private-broadcast constants
   //
   if( hdrfile ) {
-    fprintf(hdrfile, "\nvoid* const chpl_private_broadcast_table[] = {\n");
-    fprintf(hdrfile, "&chpl_verbose_comm");
-    fprintf(hdrfile, ",\n&chpl_comm_diagnostics");
-    fprintf(hdrfile, ",\n&chpl_verbose_mem");
+    fprintf(defsfile, "\nvoid* const chpl_private_broadcast_table[] = {\n");
+    fprintf(defsfile, "&chpl_verbose_comm");
+    fprintf(defsfile, ",\n&chpl_comm_diagnostics");
+    fprintf(defsfile, ",\n&chpl_verbose_mem");
     int i = 3;
     forv_Vec(CallExpr, call, gCallExprs) {
       if (call->isPrimitive(PRIM_PRIVATE_BROADCAST)) {
         SymExpr* se = toSymExpr(call->get(1));
         INT_ASSERT(se);
         SET_LINENO(call);
-        fprintf(hdrfile, ",\n&%s", se->var->cname);
+        fprintf(defsfile, ",\n&%s", se->var->cname);
         // To preserve operand order, this should be insertAtTail.
         // The change must also be made below (for LLVM) and in the signature
         // of chpl_comm_broadcast_private().
@@ -1104,7 +1169,7 @@ static void codegen_header() {
         i++;
       }
     }
-    fprintf(hdrfile, "\n};\n");
+    fprintf(defsfile, "\n};\n");
   } else {
 #ifdef HAVE_LLVM
     llvm::Type *private_broadcastTableEntryType =
@@ -1159,6 +1224,7 @@ static void codegen_header() {
 #endif
   }
 
+  info->cfile = hdrfile;
 
   if (hdrfile) {
     fprintf(hdrfile, "#include \"chpl-gen-includes.h\"\n");
@@ -1327,6 +1393,13 @@ void codegen(void) {
       USR_WARN(C_PACKED_POINTER_CODEGEN, "C code generation for packed pointers not supported");
   }
 
+  if( fIncrementalCompilation ) {
+    if( llvmCodegen )
+      USR_FATAL("--incremental is not supported with --llvm");
+    if( fHeterogeneous )
+      USR_FATAL("--incremental is not supported with --heterogeneous");
+  }
+
   if( llvmCodegen ) {
 #ifndef HAVE_LLVM
     USR_FATAL("This compiler was built without LLVM support");
@@ -1361,13 +1434,11 @@ void codegen(void) {
     openCFile(&mainfile, "_main",        "c");
 
     fprintf(mainfile.fptr, "#include \"chpl__header.h\"\n");
-
-    codegen_makefile(&mainfile);
   }
 
   // This dumps the generated sources into the build directory.
   info->cfile = hdrfile.fptr;
-  codegen_header();
+  codegen_header(mainfile.fptr);
 
   info->cfile = mainfile.fptr;
   codegen_config();
@@ -1397,6 +1468,7 @@ void codegen(void) {
     }
 
     ChainHashMap<char*, StringHashFns, int> filenames;
+    std::vector<const char*> moduleFilenames;
     forv_Vec(ModuleSymbol, currentModule, allModules) {
       mysystem(astr("# codegen-ing module", currentModule->name),
                "generating comment for --print-commands option");
@@ -1436,11 +1508,22 @@ void codegen(void) {
       openCFile(&modulefile, filename, "c");
       info->cfile = modulefile.fptr;
 
+      // With --incremental each module is compiled on its own;
+      // otherwise _main.c includes them all.
+      if (fIncrementalCompilation) {
+        fprintf(modulefile.fptr, "#include \"chpl__header.h\"\n");
+        currentModule->codegenLocalPrototypes();
+        moduleFilenames.push_back(astr(filename));
+      } else {
+        fprintf(mainfile.fptr, "#include \"%s%s\"\n", filename, ".c");
+      }
+
       currentModule->codegenDef();
       closeCFile(&modulefile);
-      fprintf(mainfile.fptr, "#include \"%s%s\"\n", filename, ".c");
     }
 
+    codegen_makefile(&mainfile, NULL, false, moduleFilenames);
+
     if (fHeterogeneous)
       codegenTypeStructures(hdrfile.fptr);
 
@@ -1467,10 +1550,18 @@ void makeBinary(void) {
 #endif
   } else {
     const char* makeflags = printSystemCommands ? "-f " : "-s -f ";
+    if (fIncrementalCompilation) {
+      // compile the modules in parallel, one job per processor
+      long numProcs = sysconf(_SC_NPROCESSORS_ONLN);
+      if (numProcs > 1)
+        makeflags = astr("-j", istr((int)numProcs), " ", makeflags);
+    }
     const char* command = astr(astr(CHPL_MAKE, " "),
                                makeflags,
                                getIntermediateDirName(), "/Makefile");
+    restoreCachedObjects();
     mysystem(command, "compiling generated source");
+    saveCachedObjects();
   }
 }
 
@@ -500,14 +500,15 @@ bool isAtomicFunctionWithOrderArgument(FnSymbol* fnSymbol, ArgSymbol** order = N
 //
 void createTaskFunctions(void) {
 
-  if( fCacheRemote ) {
+  if( fCacheRemote || !strcmp(CHPL_COMM, "gasnet") ) {
     // Add fences to Atomics methods
     //  -- or do it with a flag on the network atomic impl fns
     //  for each method in an atomics type that has an order= argument,
     //   and which does not start/end with chpl_rmem_consist_maybe_release,
     //   add chpl_rmem_consist_maybe_release(order)
     //   add chpl_rmem_consist_maybe_acquire(order)
-    //  only do this when the remote data cache is enabled.
+    //  only do this when the remote data cache is enabled or when
+    //  the gasnet comm layer might aggregate PUTs (decided at runtime).
     // Go through TypeSymbols looking for flag ATOMIC_TYPE
     forv_Vec(ModuleSymbol, module, gModuleSymbols) {
       if( module->hasFlag(FLAG_ATOMIC_MODULE) ) {
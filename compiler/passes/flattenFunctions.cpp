@@ -157,43 +157,65 @@ passByRef(Symbol* sym) {
 }
 
 
+static int
+compareSymbolsById(const void* v1, const void* v2) {
+  Symbol* sym1 = *(Symbol* const*)v1;
+  Symbol* sym2 = *(Symbol* const*)v2;
+  return (sym1->id > sym2->id) - (sym1->id < sym2->id);
+}
+
+//
+// The variables a nested function uses, in the order of their ids.
+// The formals and actuals added for them follow this order rather
+// than the map's (pointer hash) order so that the generated code is
+// the same from run to run.
+//
 static void
-addVarsToFormals(FnSymbol* fn, SymbolMap* vars) {
+getSortedVars(SymbolMap* vars, Vec<Symbol*>& syms) {
   form_Map(SymbolMapElem, e, *vars) {
-    if (Symbol* sym = e->key) {
-      Type* type = sym->type;
-      if (passByRef(sym))
-        /* NOTE: This is still conservative.  This avoids passing
-           coforall index vars by reference for non-var iterators.
-           David came up with an example with nested functions and no
-           iterators that would unnecessarily pass coforall index vars
-           by reference.  With further analysis, we could figure out
-           whether this variable is actually going to be returned as
-           an LHS expr. */
-        type = type->refType;
-      SET_LINENO(sym);
-      //
-      // BLC: TODO: This routine is part of the reason that we aren't
-      // consistent in representing 'ref' argument intents in the AST.
-      // In particular, the code above uses a certain test to decide
-      // to pass something by reference and changes the formal's type
-      // to the corresponding reference type if it believes it should.
-      // But the blankIntentForType() call below (and the INTENT_BLANK
-      // that was used before it) may pass the argument by 'const in'
-      // which seems inconsistent (because most 'ref' formals reflect
-      // INTENT_REF in the current compiler).  My current thought is
-      // to only indicate ref-ness through intents for most of the
-      // compilation (at a Chapel level) and only worry about ref
-      // types very close to code generation, primarily to avoid
-      // inconsistencies like this and keep things more
-      // uniform/simple; but we haven't made this switch yet.
-      //
-      ArgSymbol* arg = new ArgSymbol(blankIntentForType(type), sym->name, type);
-      if (sym->hasFlag(FLAG_ARG_THIS))
-        arg->addFlag(FLAG_ARG_THIS);
-      fn->insertFormalAtTail(new DefExpr(arg));
-      vars->put(sym, arg);
-    }
+    if (e->key)
+      syms.add(e->key);
+  }
+  qsort(syms.v, syms.n, sizeof(syms.v[0]), compareSymbolsById);
+}
+
+static void
+addVarsToFormals(FnSymbol* fn, SymbolMap* vars) {
+  Vec<Symbol*> syms;
+  getSortedVars(vars, syms);
+  forv_Vec(Symbol, sym, syms) {
+    Type* type = sym->type;
+    if (passByRef(sym))
+      /* NOTE: This is still conservative.  This avoids passing
+         coforall index vars by reference for non-var iterators.
+         David came up with an example with nested functions and no
+         iterators that would unnecessarily pass coforall index vars
+         by reference.  With further analysis, we could figure out
+         whether this variable is actually going to be returned as
+         an LHS expr. */
+      type = type->refType;
+    SET_LINENO(sym);
+    //
+    // BLC: TODO: This routine is part of the reason that we aren't
+    // consistent in representing 'ref' argument intents in the AST.
+    // In particular, the code above uses a certain test to decide
+    // to pass something by reference and changes the formal's type
+    // to the corresponding reference type if it believes it should.
+    // But the blankIntentForType() call below (and the INTENT_BLANK
+    // that was used before it) may pass the argument by 'const in'
+    // which seems inconsistent (because most 'ref' formals reflect
+    // INTENT_REF in the current compiler).  My current thought is
+    // to only indicate ref-ness through intents for most of the
+    // compilation (at a Chapel level) and only worry about ref
+    // types very close to code generation, primarily to avoid
+    // inconsistencies like this and keep things more
+    // uniform/simple; but we haven't made this switch yet.
+    //
+    ArgSymbol* arg = new ArgSymbol(blankIntentForType(type), sym->name, type);
+    if (sym->hasFlag(FLAG_ARG_THIS))
+      arg->addFlag(FLAG_ARG_THIS);
+    fn->insertFormalAtTail(new DefExpr(arg));
+    vars->put(sym, arg);
   }
 }
 
@@ -243,20 +265,20 @@ replaceVarUsesWithFormals(FnSymbol* fn, SymbolMap* vars) {
 
 static void
 addVarsToActuals(CallExpr* call, SymbolMap* vars, bool outerCall) {
-  form_Map(SymbolMapElem, e, *vars) {
-    if (Symbol* sym = e->key) {
-      SET_LINENO(sym);
-      if (!outerCall && passByRef(sym)) {
-        // This is only a performance issue.
-        INT_ASSERT(!sym->hasFlag(FLAG_SHOULD_NOT_PASS_BY_REF));
-        /* NOTE: See note above in addVarsToFormals() */
-        VarSymbol* tmp = newTemp(sym->type->refType);
-        call->getStmtExpr()->insertBefore(new DefExpr(tmp));
-        call->getStmtExpr()->insertBefore(new CallExpr(PRIM_MOVE, tmp, new CallExpr(PRIM_ADDR_OF, sym)));
-        call->insertAtTail(tmp);
-      } else {
-        call->insertAtTail(sym);
-      }
+  Vec<Symbol*> syms;
+  getSortedVars(vars, syms);
+  forv_Vec(Symbol, sym, syms) {
+    SET_LINENO(sym);
+    if (!outerCall && passByRef(sym)) {
+      // This is only a performance issue.
+      INT_ASSERT(!sym->hasFlag(FLAG_SHOULD_NOT_PASS_BY_REF));
+      /* NOTE: See note above in addVarsToFormals() */
+      VarSymbol* tmp = newTemp(sym->type->refType);
+      call->getStmtExpr()->insertBefore(new DefExpr(tmp));
+      call->getStmtExpr()->insertBefore(new CallExpr(PRIM_MOVE, tmp, new CallExpr(PRIM_ADDR_OF, sym)));
+      call->insertAtTail(tmp);
+    } else {
+      call->insertAtTail(sym);
     }
   }
 }
@@ -117,6 +117,14 @@ void normalize() {
       INT_ASSERT(gChplHereFree==NULL);
       gChplHereFree = fn;
     }
+    if (fn->hasFlag(FLAG_TASK_LOCAL_ALLOC)) {
+      INT_ASSERT(gChplHereTaskAlloc==NULL);
+      gChplHereTaskAlloc = fn;
+    }
+    if (fn->hasFlag(FLAG_TASK_LOCAL_FREE)) {
+      INT_ASSERT(gChplHereTaskFree==NULL);
+      gChplHereTaskFree = fn;
+    }
     clone_parameterized_primitive_methods(fn);
     fixup_query_formals(fn);
     change_method_into_constructor(fn);
@@ -27,6 +27,7 @@
 #include "driver.h"
 #include "expr.h"
 #include "files.h"
+#include "LoopStmt.h"
 #include "optimizations.h"
 #include "resolution.h"
 #include "stlUtil.h"
@@ -434,6 +435,7 @@ static void create_block_fn_wrapper(FnSymbol* fn, CallExpr* fcall, BundleArgsFnD
   if (fn->hasFlag(FLAG_COBEGIN_OR_COFORALL))    wrap_fn->addFlag(FLAG_COBEGIN_OR_COFORALL_BLOCK);
   if (fn->hasFlag(FLAG_BEGIN))                  wrap_fn->addFlag(FLAG_BEGIN_BLOCK);
   if (fn->hasFlag(FLAG_LOCAL_ON))               wrap_fn->addFlag(FLAG_LOCAL_ON);
+  if (fn->hasFlag(FLAG_BATCH_ON))               wrap_fn->addFlag(FLAG_BATCH_ON);
 
   if (fn->hasFlag(FLAG_ON)) {
     // The wrapper function for 'on' block has an additional argument, which
@@ -1285,6 +1287,30 @@ static void insertEndCounts()
 }
 
 
+// A blocking on statement is a candidate for batching if every call to it
+// sits in an order-independent loop: its invocations are then independent
+// of one another, so the runtime may run several that target the same
+// locale back to back in a single task.  optimizeOnClauses() confirms the
+// candidate by checking that the body cannot wait on another task.
+static bool isBatchOnCandidate(FnSymbol* fn)
+{
+  if (!fn->hasFlag(FLAG_ON) ||
+      fn->hasFlag(FLAG_NON_BLOCKING) ||
+      fn->hasFlag(FLAG_LOCAL_ON) ||
+      fn->calledBy->n == 0)
+    return false;
+
+  forv_Vec(CallExpr, call, *fn->calledBy) {
+    LoopStmt* loop = LoopStmt::findEnclosingLoop(call);
+
+    if (loop == NULL || loop->isOrderIndependent() == false)
+      return false;
+  }
+
+  return true;
+}
+
+
 // For each "nested" function created to represent remote execution, 
 // bundle args so they can be passed through a fork function.
 // Fork functions in general have the signature
@@ -1299,6 +1325,9 @@ static void passArgsToNestedFns(Vec<FnSymbol*>& nestedFunctions)
 
     BundleArgsFnData baData = bundleArgsFnDataInit;
 
+    if (isBatchOnCandidate(fn))
+      fn->addFlag(FLAG_BATCH_ON);
+
     forv_Vec(CallExpr, call, *fn->calledBy) {
       SET_LINENO(call);
       bundleArgs(call, baData);
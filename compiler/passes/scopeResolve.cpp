@@ -80,6 +80,22 @@ static SymbolTable symbolTable;
 static std::map<BlockStmt*,Vec<UseStmt*>*> moduleUsesCache;
 static bool                                enableModuleUsesCache = false;
 
+//
+// The usesLookupCache remembers, for a block with use-statements and a
+// name, the symbols found for that name through the block's uses.
+// Nearly every identifier in a module that is not defined locally is
+// looked up through the same list of internal modules, so this saves
+// repeating that search for each occurrence.  Results that involve
+// private symbols depend on where the lookup started and are not
+// cached.  Like the moduleUsesCache, it is only enabled once use
+// expressions have been resolved, and it is cleared whenever a symbol
+// is added to the symbol table.
+//
+typedef std::pair<BlockStmt*, const char*>             UsesLookupKey;
+typedef std::map<UsesLookupKey, std::vector<Symbol*> > UsesLookupCache;
+
+static UsesLookupCache usesLookupCache;
+
 //
 // The aliasFieldSet is a set of names of fields for which arrays may
 // be passed in by named argument as aliases, as in new C(A=>GA) (see
@@ -253,6 +269,8 @@ static void addOneToSymbolTable(DefExpr* def)
 
     BaseAST* scope = getScope(def);
 
+    usesLookupCache.clear();
+
     if (symbolTable.count(scope) == 0) {
       symbolTable[scope] = new SymbolTableEntry();
     }
@@ -1968,6 +1986,8 @@ static void destroyModuleUsesCaches() {
   }
 
   moduleUsesCache.clear();
+
+  usesLookupCache.clear();
 }
 
 
@@ -2239,41 +2259,53 @@ static bool lookupThisScopeAndUses(BaseAST* scope, const char * name,
           moduleUses = moduleUsesCache[block];
         }
 
-        forv_Vec(UseStmt, use, *moduleUses) {
-          if (use) {
-            if (!use->skipSymbolSearch(name)) {
-              const char* nameToUse = use->isARename(name) ? use->getRename(name) : name;
-              BaseAST* scopeToUse = use->getSearchScope();
-
-              if (Symbol* sym = inSymbolTable(scopeToUse, nameToUse)) {
-                if (sym->hasFlag(FLAG_PRIVATE)) {
-                  if (rejectedPrivateIds.find(sym->id) ==
-                      rejectedPrivateIds.end()) {
-                    // The symbol found was not one of the already rejected
-                    // private symbols
-                    if (!sym->isVisible(callingContext)) {
-                      rejectedPrivateIds.insert(sym->id);
-                    } else {
-                      if (!isRepeat(symbols, sym)) {
-                        symbols.push_back(sym);
+        UsesLookupKey             key(block, name);
+        UsesLookupCache::iterator cached = usesLookupCache.find(key);
+        bool                      sawPrivate = false;
+
+        if (cached != usesLookupCache.end()) {
+          symbols = cached->second;
+        } else {
+          forv_Vec(UseStmt, use, *moduleUses) {
+            if (use) {
+              if (!use->skipSymbolSearch(name)) {
+                const char* nameToUse = use->isARename(name) ? use->getRename(name) : name;
+                BaseAST* scopeToUse = use->getSearchScope();
+
+                if (Symbol* sym = inSymbolTable(scopeToUse, nameToUse)) {
+                  if (sym->hasFlag(FLAG_PRIVATE)) {
+                    sawPrivate = true;
+                    if (rejectedPrivateIds.find(sym->id) ==
+                        rejectedPrivateIds.end()) {
+                      // The symbol found was not one of the already rejected
+                      // private symbols
+                      if (!sym->isVisible(callingContext)) {
+                        rejectedPrivateIds.insert(sym->id);
+                      } else {
+                        if (!isRepeat(symbols, sym)) {
+                          symbols.push_back(sym);
+                        }
                       }
                     }
-                  }
-                  // If it was already rejected, we don't want to add it.
+                    // If it was already rejected, we don't want to add it.
 
-                } else if (!isRepeat(symbols, sym)) {
-                  // Don't want to add if the symbol itself was already present.
-                  symbols.push_back(sym);
+                  } else if (!isRepeat(symbols, sym)) {
+                    // Don't want to add if the symbol itself was already present.
+                    symbols.push_back(sym);
+                  }
                 }
               }
+            } else {
+              //
+              // break on each new depth if a symbol has been found
+              //
+              if (symbols.size() > 0)
+                break;
             }
-          } else {
-            //
-            // break on each new depth if a symbol has been found
-            //
-            if (symbols.size() > 0)
-              break;
           }
+
+          if (enableModuleUsesCache && !sawPrivate)
+            usesLookupCache[key] = symbols;
         }
 
         if (symbols.size() > 0) {
@@ -304,7 +304,12 @@ getVisibleFunctions(BlockStmt* block,
                     const char* name,
                     Vec<FnSymbol*>& visibleFns,
                     Vec<BlockStmt*>& visited,
-                    CallExpr* callOrigin);
+                    CallExpr* callOrigin,
+                    Vec<const char*>& renames,
+                    bool& sawPrivate);
+static void findVisibleFunctions(CallExpr* call,
+                                 const char* name,
+                                 Vec<FnSymbol*>& visibleFns);
 static Expr* resolve_type_expr(Expr* expr);
 static void makeNoop(CallExpr* call);
 static void resolveDefaultGenericType(CallExpr* call);
@@ -835,7 +840,10 @@ protoIteratorClass(FnSymbol* fn) {
   ii->getIterator->insertFormalAtTail(new ArgSymbol(INTENT_BLANK, "ir", ii->irecord));
   VarSymbol* ret = newTemp("_ic_", ii->iclass);
   ii->getIterator->insertAtTail(new DefExpr(ret));
-  CallExpr* icAllocCall = callChplHereAlloc(ret->typeInfo()->symbol);
+  // Iterator classes are freed by _freeIterator() in the task that got
+  // them, so they can come from the task arena.
+  CallExpr* icAllocCall = callChplHereAlloc(ret->typeInfo()->symbol, NULL,
+                                            true /*taskLocal*/);
   ii->getIterator->insertAtTail(new CallExpr(PRIM_MOVE, ret, icAllocCall));
   ii->getIterator->insertAtTail(new CallExpr(PRIM_SETCID, ret));
   ii->getIterator->insertAtTail(new CallExpr(PRIM_RETURN, ret));
@@ -2874,6 +2882,18 @@ class VisibleFunctionBlock {
 
 static Map<BlockStmt*,VisibleFunctionBlock*> visibleFunctionMap;
 static int nVisibleFunctions = 0; // for incremental build
+
+//
+// visibleFunctionIndex holds the complete result of getVisibleFunctions
+// for a name looked up from a visibility block, with the walk over
+// enclosing blocks and module uses already done.  It is keyed by name
+// first so that adding functions to visibleFunctionMap only drops the
+// entries for their names.  visibleFunctionRenames maps a name reached
+// through a use rename to the names whose entries followed that rename.
+//
+typedef Map<BlockStmt*,Vec<FnSymbol*>*> VisibleFunctionIndex;
+static Map<const char*,VisibleFunctionIndex*> visibleFunctionIndex;
+static Map<const char*,Vec<const char*>*> visibleFunctionRenames;
 static Map<BlockStmt*,BlockStmt*> visibilityBlockCache;
 static Vec<BlockStmt*> standardModuleSet;
 
@@ -2923,6 +2943,29 @@ getVisibilityBlock(Expr* expr) {
   }
 }
 
+static void clearVisibleFunctionIndex(VisibleFunctionIndex* index) {
+  Vec<Vec<FnSymbol*>*> vfns;
+  index->get_values(vfns);
+  forv_Vec(Vec<FnSymbol*>, vfn, vfns) {
+    delete vfn;
+  }
+  index->clear();
+}
+
+//
+// drop the cached lookups whose result may include a function named name
+//
+static void invalidateVisibleFunctionIndex(const char* name) {
+  if (VisibleFunctionIndex* index = visibleFunctionIndex.get(name))
+    clearVisibleFunctionIndex(index);
+  if (Vec<const char*>* names = visibleFunctionRenames.get(name)) {
+    forv_Vec(const char, renamed, *names) {
+      if (VisibleFunctionIndex* index = visibleFunctionIndex.get(renamed))
+        clearVisibleFunctionIndex(index);
+    }
+  }
+}
+
 static void buildVisibleFunctionMap() {
   for (int i = nVisibleFunctions; i < gFnSymbols.n; i++) {
     FnSymbol* fn = gFnSymbols.v[i];
@@ -2949,6 +2992,7 @@ static void buildVisibleFunctionMap() {
         vfb->visibleFunctions.put(fn->name, fns);
       }
       fns->add(fn);
+      invalidateVisibleFunctionIndex(fn->name);
     }
   }
   nVisibleFunctions = gFnSymbols.n;
@@ -2959,7 +3003,9 @@ getVisibleFunctions(BlockStmt* block,
                     const char* name,
                     Vec<FnSymbol*>& visibleFns,
                     Vec<BlockStmt*>& visited,
-                    CallExpr* callOrigin) {
+                    CallExpr* callOrigin,
+                    Vec<const char*>& renames,
+                    bool& sawPrivate) {
   //
   // all functions in standard modules are stored in a single block
   //
@@ -2983,6 +3029,8 @@ getVisibleFunctions(BlockStmt* block,
     Vec<FnSymbol*>* fns = vfb->visibleFunctions.get(name);
     if (fns) {
       forv_Vec(FnSymbol, fn, *fns) {
+        if (fn->hasFlag(FLAG_PRIVATE))
+          sawPrivate = true;
         if (fn->isVisible(callOrigin)) {
           // isVisible checks if the function is private to its defining
           // module (and in that case, if we are under its defining module)
@@ -3007,11 +3055,15 @@ getVisibleFunctions(BlockStmt* block,
         // The use statement could be of an enum instead of a module, but only
         // modules can define functions.
         canSkipThisBlock = false; // cannot skip if this block uses modules
+        if (mod->hasFlag(FLAG_PRIVATE))
+          sawPrivate = true;
         if (mod->isVisible(callOrigin)) {
           if (use->isARename(name)) {
-            getVisibleFunctions(mod->block, use->getRename(name), visibleFns, visited, callOrigin);
+            const char* renamed = use->getRename(name);
+            renames.add_exclusive(renamed);
+            getVisibleFunctions(mod->block, renamed, visibleFns, visited, callOrigin, renames, sawPrivate);
           } else {
-            getVisibleFunctions(mod->block, name, visibleFns, visited, callOrigin);
+            getVisibleFunctions(mod->block, name, visibleFns, visited, callOrigin, renames, sawPrivate);
           }
         }
       }
@@ -3022,13 +3074,13 @@ getVisibleFunctions(BlockStmt* block,
   // visibilityBlockCache contains blocks that can be skipped
   //
   if (BlockStmt* next = visibilityBlockCache.get(block)) {
-    getVisibleFunctions(next, name, visibleFns, visited, callOrigin);
+    getVisibleFunctions(next, name, visibleFns, visited, callOrigin, renames, sawPrivate);
     return (canSkipThisBlock) ? next : block;
   }
 
   if (block != rootModule->block) {
     BlockStmt* next = getVisibilityBlock(block);
-    BlockStmt* cache = getVisibleFunctions(next, name, visibleFns, visited, callOrigin);
+    BlockStmt* cache = getVisibleFunctions(next, name, visibleFns, visited, callOrigin, renames, sawPrivate);
     if (cache)
       visibilityBlockCache.put(block, cache);
     return (canSkipThisBlock) ? cache : block;
@@ -3037,6 +3089,66 @@ getVisibleFunctions(BlockStmt* block,
   return NULL;
 }
 
+//
+// add the functions named name that are visible from call to visibleFns,
+// using visibleFunctionIndex when the same lookup was already made from
+// the call's visibility block.  Lookups that saw a private function or
+// module depend on where the call is and are not cached.
+//
+static void findVisibleFunctions(CallExpr* call,
+                                 const char* name,
+                                 Vec<FnSymbol*>& visibleFns) {
+  BlockStmt* block = getVisibilityBlock(call);
+
+  //
+  // blocks that neither define functions named name nor use modules add
+  // nothing to the result, so calls under them share the entry of the
+  // first enclosing block that does or of the enclosing module
+  //
+  while (block != rootModule->block &&
+         !block->modUses &&
+         !isModuleSymbol(block->parentSymbol)) {
+    VisibleFunctionBlock* vfb = visibleFunctionMap.get(block);
+    if (vfb && vfb->visibleFunctions.get(name))
+      break;
+    block = getVisibilityBlock(block);
+  }
+
+  VisibleFunctionIndex* index = visibleFunctionIndex.get(name);
+  if (index) {
+    if (Vec<FnSymbol*>* fns = index->get(block)) {
+      visibleFns.append(*fns);
+      return;
+    }
+  }
+
+  Vec<BlockStmt*> visited;
+  Vec<const char*> renames;
+  bool sawPrivate = false;
+  int start = visibleFns.n;
+  getVisibleFunctions(block, name, visibleFns, visited, call, renames, sawPrivate);
+  if (sawPrivate)
+    return;
+
+  if (!index) {
+    index = new VisibleFunctionIndex();
+    visibleFunctionIndex.put(name, index);
+  }
+  Vec<FnSymbol*>* fns = new Vec<FnSymbol*>();
+  for (int i = start; i < visibleFns.n; i++)
+    fns->add(visibleFns.v[i]);
+  index->put(block, fns);
+
+  forv_Vec(const char, renamed, renames) {
+    Vec<const char*>* names = visibleFunctionRenames.get(renamed);
+    if (!names) {
+      names = new Vec<const char*>();
+      visibleFunctionRenames.put(renamed, names);
+    }
+    names->add_exclusive(name);
+  }
+}
+
 // Ensure 'parent' is the block before which we want to do the capturing.
 static void verifyTaskFnCall(BlockStmt* parent, CallExpr* call) {
   if (call->isNamed("coforall_fn") || call->isNamed("on_fn")) {
@@ -3667,8 +3779,7 @@ FnSymbol* resolveNormalCall(CallExpr* call, bool checkonly) {
 
   if (!call->isResolved()) {
     if (!info.scope) {
-      Vec<BlockStmt*> visited;
-      getVisibleFunctions(getVisibilityBlock(call), info.name, visibleFns, visited, call);
+      findVisibleFunctions(call, info.name, visibleFns);
     } else {
       if (VisibleFunctionBlock* vfb = visibleFunctionMap.get(info.scope)) {
         if (Vec<FnSymbol*>* fns = vfb->visibleFunctions.get(info.name)) {
@@ -4290,7 +4401,8 @@ static void resolveMove(CallExpr* call) {
         rhsCall->replace(new CallExpr(PRIM_CAST_TO_VOID_STAR,
                                       new SymExpr(derefTmp)));
       }
-    } else if (rhsCall->isResolved() == gChplHereAlloc) {
+    } else if (rhsCall->isResolved() == gChplHereAlloc ||
+               rhsCall->isResolved() == gChplHereTaskAlloc) {
       // Insert cast below for calls to chpl_here_*alloc()
       isChplHereAlloc = true;
     }
@@ -4848,8 +4960,7 @@ createFunctionAsValue(CallExpr *call) {
   const char *flname = use->unresolved;
 
   Vec<FnSymbol*> visibleFns;
-  Vec<BlockStmt*> visited;
-  getVisibleFunctions(getVisibilityBlock(call), flname, visibleFns, visited, call);
+  findVisibleFunctions(call, flname, visibleFns);
 
   if (visibleFns.n > 1) {
     USR_FATAL(call, "%s: can not capture overloaded functions as values",
@@ -5003,9 +5114,8 @@ usesOuterVars(FnSymbol* fn, Vec<FnSymbol*> &seen) {
 
       //dive into calls
       Vec<FnSymbol*> visibleFns;
-      Vec<BlockStmt*> visited;
 
-      getVisibleFunctions(getVisibilityBlock(call), call->parentSymbol->name, visibleFns, visited, call);
+      findVisibleFunctions(call, call->parentSymbol->name, visibleFns);
 
       forv_Vec(FnSymbol, called_fn, visibleFns) {
         bool seen_this_fn = false;
@@ -7630,6 +7740,14 @@ buildVirtualMaps() {
 }
 
 
+static int
+compareFnsById(const void* v1, const void* v2) {
+  FnSymbol* fn1 = *(FnSymbol* const*)v1;
+  FnSymbol* fn2 = *(FnSymbol* const*)v2;
+  return (fn1->id > fn2->id) - (fn1->id < fn2->id);
+}
+
+
 // if exclusive=true, check for fn already existing in the virtual method
 // table and do not add it a second time if it is already present.
 static void
@@ -7829,6 +7947,20 @@ resolve() {
   visibleFunctionMap.clear();
   visibilityBlockCache.clear();
 
+  Vec<VisibleFunctionIndex*> indexes;
+  visibleFunctionIndex.get_values(indexes);
+  forv_Vec(VisibleFunctionIndex, index, indexes) {
+    clearVisibleFunctionIndex(index);
+    delete index;
+  }
+  visibleFunctionIndex.clear();
+  Vec<Vec<const char*>*> renamed;
+  visibleFunctionRenames.get_values(renamed);
+  forv_Vec(Vec<const char*>, names, renamed) {
+    delete names;
+  }
+  visibleFunctionRenames.clear();
+
   forv_Vec(BlockStmt, stmt, gBlockStmts) {
     stmt->moduleUseClear();
   }
@@ -7990,14 +8122,21 @@ static void resolveDynamicDispatches() {
     buildVirtualMaps();
   } while (num_types != gTypeSymbols.n);
 
+  // Add the roots in the order they were created rather than in hash
+  // table (pointer) order, so that the virtual method table layout, and
+  // the generated code indexing it, is the same from run to run.
+  Vec<FnSymbol*> roots;
   for (int i = 0; i < virtualRootsMap.n; i++) {
     if (virtualRootsMap.v[i].key) {
       for (int j = 0; j < virtualRootsMap.v[i].value->n; j++) {
-        FnSymbol* root = virtualRootsMap.v[i].value->v[j];
-        addVirtualMethodTableEntry(root->_this->type, root, true);
+        roots.add(virtualRootsMap.v[i].value->v[j]);
       }
     }
   }
+  qsort(roots.v, roots.n, sizeof(roots.v[0]), compareFnsById);
+  forv_Vec(FnSymbol, root, roots) {
+    addVirtualMethodTableEntry(root->_this->type, root, true);
+  }
 
   Vec<Type*> ctq;
   ctq.add(dtObject);
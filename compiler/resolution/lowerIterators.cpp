@@ -678,9 +678,9 @@ bundleLoopBodyFnArgsForIteratorFnCall(CallExpr* iteratorFnCall,
   VarSymbol* argBundle = newTemp("argBundle", ct);
   iteratorFnCall->insertBefore(new DefExpr(argBundle));
   insertChplHereAlloc(iteratorFnCall, false /*insertAfter*/, argBundle,
-                      ct, newMemDesc("bundled args"));
+                      ct, newMemDesc("bundled args"), true /*taskLocal*/);
   iteratorFnCall->insertAtTail(argBundle);
-  iteratorFnCall->insertAfter(callChplHereFree(argBundle));
+  iteratorFnCall->insertAfter(callChplHereFree(argBundle, true /*taskLocal*/));
 
   // loopBodyWrapper(int index, ct* fn_args) {
   //   loopBodyFn(index);
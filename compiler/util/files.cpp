@@ -33,10 +33,14 @@
 #include "mysystem.h"
 #include "stringutil.h"
 #include "tmpdirname.h"
+#include "version.h"
 
+#include <dirent.h>
+#include <inttypes.h>
 #include <pwd.h>
 #include <unistd.h>
 
+#include <cctype>
 #include <cstring>
 #include <cstdlib>
 #include <cerrno>
@@ -48,6 +52,7 @@
 
 char               executableFilename[FILENAME_MAX + 1] = "a.out";
 char               saveCDir[FILENAME_MAX + 1]           = "";
+char               objectCacheDir[FILENAME_MAX + 1]     = "";
 
 std::string ccflags;
 std::string ldflags;
@@ -62,6 +67,9 @@ static const char* intDirName        = NULL;
 
 static const int   MAX_CHARS_PER_PID = 32;
 
+// generated module files compiled on their own (see codegen_makefile)
+static std::vector<const char*> splitFileNames;
+
 void addLibInfo(const char* libName) {
   static int libSpace = 0;
 
@@ -531,7 +539,41 @@ void genIncludeCommandLineHeaders(FILE* outfile) {
 }
 
 
-void codegen_makefile(fileinfo* mainfile, const char** tmpbinname, bool skip_compile_link) {
+//
+// With --incremental, the generated code for each module is in its own
+// .c file (splitFiles holds their names without the extension).  The
+// makefile then compiles each of these, and _main.c, to an object file
+// listed in CHPL_GEN_OBJS, so that make -j can build them in parallel.
+//
+static void genSplitObjFiles(FILE* makefile,
+                             const std::vector<const char*>& splitFiles) {
+  fprintf(makefile, "CHPL_GEN_OBJS = \\\n");
+  fprintf(makefile, "\t%s \\\n", genIntermediateFilename("_main.o"));
+  for (size_t i = 0; i < splitFiles.size(); i++) {
+    fprintf(makefile, "\t%s \\\n",
+            genIntermediateFilename(astr(splitFiles[i], ".o")));
+  }
+  fprintf(makefile, "\n");
+}
+
+// With --object-cache, the C compiler also writes a .d file listing the
+// headers each object depends on (if it knows how; see DEPEND_CFLAGS).
+//
+static void genSplitBuildRules(FILE* makefile) {
+  fprintf(makefile, "$(CHPL_GEN_OBJS): %%.o: %%.c %s\n",
+          genIntermediateFilename("chpl__header.h"));
+  fprintf(makefile,
+          "\t$(CC) $(CHPL_MAKE_BASE_CFLAGS) $(GEN_CFLAGS) $(COMP_GEN_CFLAGS) "
+          "%s-c -o $@ $(CHPL_RT_INC_DIR) $<\n",
+          objectCacheDir[0] != '\0' ? "$(DEPEND_CFLAGS) " : "");
+  fprintf(makefile, "\n");
+}
+
+void codegen_makefile(fileinfo* mainfile, const char** tmpbinname,
+                      bool skip_compile_link,
+                      const std::vector<const char*>& splitFiles) {
+  splitFileNames = splitFiles;
+
   fileinfo makefile;
   openCFile(&makefile, "Makefile");
   const char* tmpDirName = intDirName;
@@ -622,7 +664,14 @@ void codegen_makefile(fileinfo* mainfile, const char** tmpbinname, bool skip_com
   fprintf(makefile.fptr, "\n");
 
   fprintf(makefile.fptr, "CHPLSRC = \\\n");
-  fprintf(makefile.fptr, "\t%s \\\n\n", mainfile->pathname);
+  fprintf(makefile.fptr, "\t%s \\\n", mainfile->pathname);
+  for (size_t i = 0; i < splitFiles.size(); i++) {
+    fprintf(makefile.fptr, "\t%s \\\n",
+            genIntermediateFilename(astr(splitFiles[i], ".c")));
+  }
+  fprintf(makefile.fptr, "\n");
+  if (splitFiles.size() > 0)
+    genSplitObjFiles(makefile.fptr, splitFiles);
   genCFiles(makefile.fptr);
   genObjFiles(makefile.fptr);
   fprintf(makefile.fptr, "\nLIBS =");
@@ -646,6 +695,8 @@ void codegen_makefile(fileinfo* mainfile, const char** tmpbinname, bool skip_com
   }
   fprintf(makefile.fptr, "\n");
   genCFileBuildRules(makefile.fptr);
+  if (splitFiles.size() > 0)
+    genSplitBuildRules(makefile.fptr);
   closeCFile(&makefile, false);
 }
 
@@ -1092,3 +1143,265 @@ bool isSameFile(const char* pathA, const char* pathB)
 
   return false;
 }
+
+
+//
+// With --object-cache, the object file built from each module's .c file
+// is kept in the cache directory, named by a hash of the .c file,
+// chpl__header.h, and the compiler version, settings and flags.  Next
+// to it is a .deps file naming the headers the compiler read, from the
+// .d file it wrote, and a hash of their contents; if any of them has
+// changed since, the object is not reused.  Objects for which there is
+// no .d file (the C compiler can't write one) are not cached.  Before
+// make runs, the cached objects for unchanged modules are copied into
+// the intermediate directory, where they are newer than their sources,
+// so make only compiles the modules that changed.  Afterwards the newly
+// compiled objects are added to the cache.
+//
+
+struct CachedObject {
+  const char* objFile;   // object file in the intermediate directory
+  const char* cacheFile; // its copy in the cache directory
+  const char* depsFile;  // the headers it depends on, in the cache
+};
+
+static std::vector<CachedObject> objectsToCache;
+
+// 64-bit FNV-1a
+static uint64_t hashBytes(uint64_t hash, const char* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= (unsigned char)data[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+static uint64_t hashString(uint64_t hash, const std::string& str) {
+  // include the terminator so that adjacent strings can't run together
+  return hashBytes(hash, str.c_str(), str.size() + 1);
+}
+
+static bool readFileContents(const char* filename, std::string& contents) {
+  FILE* file = fopen(filename, "rb");
+  if (file == NULL)
+    return false;
+
+  char   buf[65536];
+  size_t got;
+
+  contents.clear();
+  while ((got = fread(buf, 1, sizeof(buf), file)) > 0)
+    contents.append(buf, got);
+
+  bool ok = !ferror(file);
+  fclose(file);
+  return ok;
+}
+
+static bool writeFileContents(const char* filename,
+                              const std::string& contents) {
+  FILE* file = fopen(filename, "wb");
+  if (file == NULL)
+    return false;
+
+  bool ok = fwrite(contents.data(), 1, contents.size(), file) ==
+            contents.size();
+  ok = (fclose(file) == 0) && ok;
+  return ok;
+}
+
+static bool copyFileContents(const char* from, const char* to) {
+  std::string contents;
+  return readFileContents(from, contents) && writeFileContents(to, contents);
+}
+
+//
+// Read the dependencies from a .d file written by the C compiler, that is,
+// all the file names that aren't targets.  Files in the intermediate
+// directory are left out: the .c file and chpl__header.h are part of the
+// object's name already, and the directory changes from run to run.
+//
+static bool readDependencies(const char* dFile,
+                             std::vector<std::string>& deps) {
+  std::string contents;
+  if (!readFileContents(dFile, contents))
+    return false;
+
+  std::string intDir  = std::string(intDirName) + "/";
+  std::string word;
+  size_t      i       = 0;
+
+  deps.clear();
+  while (i <= contents.size()) {
+    char c = (i < contents.size()) ? contents[i] : ' ';
+    i++;
+
+    if (c == '\\' && i < contents.size() && contents[i] == ' ') {
+      word += ' ';
+      i++;
+    } else if (c == '\\' && i < contents.size() && contents[i] == '\n') {
+      i++;
+    } else if (isspace((unsigned char)c)) {
+      if (!word.empty() && word[word.size() - 1] != ':' &&
+          word.compare(0, intDir.size(), intDir) != 0)
+        deps.push_back(word);
+      word.clear();
+    } else {
+      word += c;
+    }
+  }
+
+  return true;
+}
+
+// A file that can't be read hashes differently from any that can.
+static uint64_t hashDependencies(const std::vector<std::string>& deps) {
+  uint64_t    hash = 1469598103934665603ULL;
+  std::string contents;
+
+  for (size_t i = 0; i < deps.size(); i++) {
+    hash = hashString(hash, deps[i]);
+    if (readFileContents(deps[i].c_str(), contents))
+      hash = hashString(hash, contents);
+    else
+      hash = hashString(hash, "\n<missing>");
+  }
+
+  return hash;
+}
+
+// The first line of a .deps file is the hash, the rest the dependencies.
+static bool dependenciesUnchanged(const char* depsFile) {
+  std::string              contents;
+  std::vector<std::string> deps;
+
+  if (!readFileContents(depsFile, contents))
+    return false;
+
+  size_t start = 0;
+  while (start < contents.size()) {
+    size_t end = contents.find('\n', start);
+    if (end == std::string::npos)
+      end = contents.size();
+    deps.push_back(contents.substr(start, end - start));
+    start = end + 1;
+  }
+  if (deps.empty())
+    return false;
+
+  char hash[32];
+  snprintf(hash, sizeof(hash), "%016" PRIx64,
+           hashDependencies(std::vector<std::string>(deps.begin() + 1,
+                                                     deps.end())));
+  return deps[0] == hash;
+}
+
+static uint64_t hashCompileSettings() {
+  uint64_t    hash = 1469598103934665603ULL;
+  char        version[128];
+  char        settings[128];
+  std::string contents;
+
+  get_version(version);
+  hash = hashString(hash, version);
+
+  for (std::map<std::string, const char*>::iterator env = envMap.begin();
+       env != envMap.end(); ++env) {
+    hash = hashString(hash, env->first);
+    hash = hashString(hash, env->second);
+  }
+
+  snprintf(settings, sizeof(settings), "%d %d %d %d %d %d %d",
+           ccwarnings, debugCCode, optimizeCCode, specializeCCode, ffloatOpt,
+           fLibraryCompile, fLinkStyle);
+  hash = hashString(hash, settings);
+
+  forv_Vec(const char*, dirName, incDirs) {
+    hash = hashString(hash, dirName);
+  }
+  hash = hashString(hash, ccflags);
+
+  if (readFileContents(genIntermediateFilename("chpl__header.h"), contents))
+    hash = hashString(hash, contents);
+
+  return hash;
+}
+
+void restoreCachedObjects() {
+  if (objectCacheDir[0] == '\0' || splitFileNames.size() == 0)
+    return;
+
+  ensureDirExists(objectCacheDir, "ensuring --object-cache directory exists");
+
+  uint64_t    settingsHash = hashCompileSettings();
+  std::string code;
+  int         numReused    = 0;
+
+  objectsToCache.clear();
+
+  for (size_t i = 0; i < splitFileNames.size(); i++) {
+    const char* name    = splitFileNames[i];
+    const char* srcFile = genIntermediateFilename(astr(name, ".c"));
+
+    if (!readFileContents(srcFile, code))
+      continue;
+
+    char key[32];
+    snprintf(key, sizeof(key), "%016" PRIx64,
+             hashString(settingsHash, code));
+
+    CachedObject obj;
+    obj.objFile   = genIntermediateFilename(astr(name, ".o"));
+    obj.cacheFile = astr(objectCacheDir, "/", name, "-", key, ".o");
+    obj.depsFile  = astr(objectCacheDir, "/", name, "-", key, ".deps");
+
+    if (dependenciesUnchanged(obj.depsFile) &&
+        copyFileContents(obj.cacheFile, obj.objFile))
+      numReused++;
+    else
+      objectsToCache.push_back(obj);
+  }
+
+  if (printSystemCommands) {
+    printf("# reused %d of %d module objects from %s\n",
+           numReused, (int)splitFileNames.size(), objectCacheDir);
+  }
+}
+
+void saveCachedObjects() {
+  for (size_t i = 0; i < objectsToCache.size(); i++) {
+    const CachedObject&      obj = objectsToCache[i];
+    std::vector<std::string> deps;
+
+    // the compiler names the .d file after the object, less its ".o"
+    std::string dFile(obj.objFile, strlen(obj.objFile) - 2);
+    if (!readDependencies((dFile + ".d").c_str(), deps))
+      continue;
+
+    char        hash[32];
+    std::string contents;
+
+    snprintf(hash, sizeof(hash), "%016" PRIx64, hashDependencies(deps));
+    contents = hash;
+    for (size_t j = 0; j < deps.size(); j++)
+      contents += "\n" + deps[j];
+
+    // Write under temporary names and rename, so that a concurrent
+    // compile never sees a partially written file.  The .deps file goes
+    // first, since an object is only reused along with it.
+    const char* suffix  = astr(".", istr((int)getpid()));
+    const char* tmpDeps = astr(obj.depsFile, suffix);
+    const char* tmpFile = astr(obj.cacheFile, suffix);
+
+    if (writeFileContents(tmpDeps, contents) &&
+        rename(tmpDeps, obj.depsFile) == 0 &&
+        copyFileContents(obj.objFile, tmpFile) &&
+        rename(tmpFile, obj.cacheFile) == 0)
+      continue;
+
+    unlink(tmpDeps);
+    unlink(tmpFile);
+  }
+
+  objectsToCache.clear();
+}
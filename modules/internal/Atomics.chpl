@@ -20,8 +20,9 @@
 /*
    See runtime/include/atomics/README for more information about atomics.
 
-   Note that when compiling with --cache-remote, the compiler
-   will add fences to methods in atomic types with order arguments e.g.::
+   Note that when compiling with --cache-remote, or with CHPL_COMM=gasnet
+   (which may aggregate PUTs), the compiler will add fences to methods
+   in atomic types with order arguments e.g.::
 
      proc sub (... order:memory_order = memory_order_seq_cst):void {
        on this do atomic_fetch_sub_explicit_...(_v, value, order);
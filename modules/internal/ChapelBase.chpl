@@ -688,6 +688,10 @@ module ChapelBase {
     return __primitive("cast", t, x);
   }
 
+  inline proc _cast(type t, x) where t:_ddata && x.type:c_void_ptr {
+    return __primitive("cast", t, x);
+  }
+
   // Removing the 'eltType' arg results in errors for --baseline
   inline proc _ddata_shift(type eltType, data: _ddata(eltType), shift: integral) {
     var ret: _ddata(eltType);
@@ -127,7 +127,7 @@ module ChapelIteratorSupport {
   }
 
   inline proc _freeIterator(ic: _iteratorClass) {
-    chpl_here_free(__primitive("cast_to_void_star", ic));
+    chpl_here_task_free(__primitive("cast_to_void_star", ic));
   }
 
   inline proc _freeIterator(x: _tuple) {
@@ -645,6 +645,11 @@ module DefaultRectangular {
     var shiftedData : _ddata(eltType);
     var noinit_data: bool = false;
 
+    // If the element buffer is a file mapping made by file.mapArray()
+    // rather than an allocation, this is the runtime handle that owns
+    // it, and destroying the data unmaps it.
+    var mappedRegion: c_void_ptr;
+
     // 'dataAllocRange' is used by the array-vector operations (e.g. push_back,
     // pop_back, insert, remove) to allow growing or shrinking the data
     // buffer in a doubling/halving style.  If it is used, it will be the
@@ -668,6 +673,14 @@ module DefaultRectangular {
     proc dsiGetBaseDom() return dom;
   
     proc dsiDestroyData() {
+      if mappedRegion != nil {
+        // Only plain numeric elements are mapped, so there is nothing
+        // to destroy in them.
+        extern proc qio_file_unmap_region(region: c_void_ptr);
+        qio_file_unmap_region(mappedRegion);
+        mappedRegion = c_nil;
+        return;
+      }
       if dom.dsiNumIndices > 0 {
         pragma "no copy" pragma "no auto destroy" var dr = data;
         pragma "no copy" pragma "no auto destroy" var dv = __primitive("deref", dr);
@@ -808,6 +821,14 @@ module DefaultRectangular {
     // we want to get rid of all initialize functions everywhere
     proc initialize() {
       if noinit_data == true then return;
+      var size = setupLayout();
+      data = _ddata_allocate(eltType, size);
+      initShiftedData();
+    }
+
+    // Compute the layout of a dense, row-major element buffer for
+    // 'dom' and return the number of elements it holds.
+    proc setupLayout() {
       for param dim in 1..rank {
         off(dim) = dom.dsiDim(dim).alignedLow;
         str(dim) = dom.dsiDim(dim).stride;
@@ -816,8 +837,16 @@ module DefaultRectangular {
       for param dim in 1..(rank-1) by -1 do
         blk(dim) = blk(dim+1) * dom.dsiDim(dim+1).length;
       computeFactoredOffs();
-      var size = blk(1) * dom.dsiDim(1).length;
-      data = _ddata_allocate(eltType, size);
+      return blk(1) * dom.dsiDim(1).length;
+    }
+
+    // Use the file mapping at 'addr', owned by 'region', as the element
+    // buffer of an array built with noinit_data=true.  The elements are
+    // whatever bytes the file holds.
+    proc adoptMappedData(addr: c_void_ptr, region: c_void_ptr) {
+      setupLayout();
+      data = addr:_ddata(eltType);
+      mappedRegion = region;
       initShiftedData();
     }
   
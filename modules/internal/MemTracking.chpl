@@ -28,6 +28,7 @@ module MemTracking
     memLeaks: bool = false,
     memMax: uint = 0,
     memThreshold: uint = 0,
+    memSample: uint = 1,
     memLog: string;
 
   pragma "no auto destroy"
@@ -51,9 +52,10 @@ module MemTracking
   config const
     memLeaksByDesc: string;
 
-  // Safely cast to size_t instances of memMax and memThreshold.
+  // Safely cast to size_t instances of memMax, memThreshold, and memSample.
   const cMemMax = memMax.safeCast(size_t),
-    cMemThreshold = memThreshold.safeCast(size_t);
+    cMemThreshold = memThreshold.safeCast(size_t),
+    cMemSample = memSample.safeCast(size_t);
 
   //
   // This communicates the settings of the various memory tracking
@@ -75,6 +77,7 @@ module MemTracking
                                          ref ret_memLeaks: bool,
                                          ref ret_memMax: size_t,
                                          ref ret_memThreshold: size_t,
+                                         ref ret_memSample: size_t,
                                          ref ret_memLog: c_string,
                                          ref ret_memLeaksLog: c_string) {
     ret_memTrack = memTrack;
@@ -83,6 +86,7 @@ module MemTracking
     ret_memLeaks = memLeaks;
     ret_memMax = cMemMax;
     ret_memThreshold = cMemThreshold;
+    ret_memSample = cMemSample;
 
     if (here.id != 0) {
       if memLeaksByDesc.length != 0 {
@@ -321,6 +321,24 @@ module LocaleModel {
     chpl_mem_free(ptr);
   }
 
+  // Allocations that are always freed by the task that made them, before
+  // it ends, such as iterator classes.  With CHPL_RT_TASK_ARENA these
+  // come from a per-task bump arena instead of the heap.
+  pragma "allocator"
+  pragma "task local alloc"
+  proc chpl_here_task_alloc(size:int, md:chpl_mem_descInt_t): c_void_ptr {
+    pragma "insert line file info"
+      extern proc chpl_mem_taskAlloc(size:size_t, md:chpl_mem_descInt_t) : c_void_ptr;
+    return chpl_mem_taskAlloc(size.safeCast(size_t), md + chpl_memhook_md_num());
+  }
+
+  pragma "task local free"
+  proc chpl_here_task_free(ptr:c_void_ptr): void {
+    pragma "insert line file info"
+      extern proc chpl_mem_taskFree(ptr:c_void_ptr) : void;
+    chpl_mem_taskFree(ptr);
+  }
+
 
   //////////////////////////////////////////
   //
@@ -336,6 +354,8 @@ module LocaleModel {
                                         args: c_void_ptr, args_size: size_t);
   extern proc chpl_comm_execute_on_nb(loc_id: int, subloc_id: int, fn: int,
                                       args: c_void_ptr, args_size: size_t);
+  extern proc chpl_comm_execute_on_batch(loc_id: int, subloc_id: int, fn: int,
+                                         args: c_void_ptr, args_size: size_t);
   extern proc chpl_ftable_call(fn: int, args: c_void_ptr): void;
   //
   // regular "on"
@@ -378,6 +398,28 @@ module LocaleModel {
     }
   }
 
+  //
+  // batched "on" (blocking, but independent of any other batched "on",
+  // so the runtime may run it in a single task together with others
+  // sent to the same locale)
+  //
+  pragma "insert line file info"
+  export
+  proc chpl_executeOnBatch(loc: chpl_localeID_t, // target locale
+                           fn: int,              // on-body function idx
+                           args: c_void_ptr,     // function args
+                           args_size: size_t     // args size
+                          ) {
+    const node = chpl_nodeFromLocaleID(loc);
+    if (node == chpl_nodeID) {
+      // don't call the runtime batched execute_on function if we can stay local
+      chpl_ftable_call(fn, args);
+    } else {
+      chpl_comm_execute_on_batch(node, chpl_sublocFromLocaleID(loc),
+                                 fn, args, args_size);
+    }
+  }
+
   //
   // nonblocking "on" (doesn't wait for completion)
   //
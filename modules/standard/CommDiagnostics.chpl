@@ -129,7 +129,7 @@
   Executing this on two locales with the ``-nl 2`` command line
   option results in the following output::
 
-    (get = 0, get_nb = 0, put = 0, put_nb = 0, test_nb = 0, wait_nb = 0, try_nb = 0, execute_on = 1, execute_on_fast = 0, execute_on_nb = 0) (get = 1, get_nb = 0, put = 1, put_nb = 0, test_nb = 0, wait_nb = 0, try_nb = 0, execute_on = 0, execute_on_fast = 0, execute_on_nb = 0)
+    (get = 0, get_nb = 0, put = 0, put_nb = 0, test_nb = 0, wait_nb = 0, try_nb = 0, execute_on = 1, execute_on_fast = 0, execute_on_nb = 0, cache_get_hits = 0, cache_get_misses = 0, cache_put_hits = 0, cache_put_misses = 0, cache_evictions = 0, cache_prefetch_useful = 0, cache_prefetch_wasted = 0) (get = 1, get_nb = 0, put = 1, put_nb = 0, test_nb = 0, wait_nb = 0, try_nb = 0, execute_on = 0, execute_on_fast = 0, execute_on_nb = 0, cache_get_hits = 0, cache_get_misses = 0, cache_put_hits = 0, cache_put_misses = 0, cache_evictions = 0, cache_prefetch_useful = 0, cache_prefetch_wasted = 0)
 
   The first parenthesized group contains the counts for locale 0, and
   the second contains the counts for locale 1.  So, for the
@@ -137,6 +137,11 @@
   was executed on locale 0, and a remote get and a remote put were
   executed on locale 1.
 
+  The ``cache_*`` counts are only nonzero for programs compiled with
+  ``--cache-remote``.  They report how the remote data cache handled
+  the GETs and PUTs, one count per cache page touched, along with how
+  many cache pages it evicted to make room for others.
+
   **Studying Communication During Module Initialization**
 
   It is hard for a programmer to determine exactly what happens during
@@ -215,6 +220,34 @@ module CommDiagnostics
       non-blocking remote executions
      */
     var execute_on_nb: uint(64);
+    /*
+      GETs satisfied by the remote data cache (one per cache page touched)
+     */
+    var cache_get_hits: uint(64);
+    /*
+      GETs that the remote data cache had to fetch
+     */
+    var cache_get_misses: uint(64);
+    /*
+      PUTs to a page already in the remote data cache
+     */
+    var cache_put_hits: uint(64);
+    /*
+      PUTs that needed a new remote data cache page
+     */
+    var cache_put_misses: uint(64);
+    /*
+      pages evicted from the remote data cache
+     */
+    var cache_evictions: uint(64);
+    /*
+      prefetched pages whose data was later used by a GET
+     */
+    var cache_prefetch_useful: uint(64);
+    /*
+      prefetched pages evicted or invalidated before their data was used
+     */
+    var cache_prefetch_wasted: uint(64);
   };
 
   /*
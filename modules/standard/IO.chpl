@@ -1397,6 +1397,8 @@ extern const QIO_METHOD_FREADFWRITE:c_int;
 pragma "no doc"
 extern const QIO_METHOD_MMAP:c_int;
 pragma "no doc"
+extern const QIO_METHOD_ASYNC:c_int;
+pragma "no doc"
 extern const QIO_METHODMASK:c_int;
 pragma "no doc"
 extern const QIO_HINT_RANDOM:c_int;
@@ -1416,6 +1418,10 @@ pragma "no doc"
 extern const QIO_HINT_NOREUSE:c_int;
 pragma "no doc"
 extern const QIO_HINT_OWNED:c_int;
+pragma "no doc"
+extern const QIO_HINT_PIPELINE_SHIFT:c_int;
+pragma "no doc"
+extern const QIO_MAX_PIPELINE_DEPTH:c_int;
 
 /*  IOHINT_NONE means normal operation, nothing special
     to hint. Expect to use NONE most of the time.
@@ -1444,6 +1450,21 @@ const IOHINT_CACHED = QIO_HINT_CACHED;
  */
 const IOHINT_PARALLEL = QIO_HINT_PARALLEL;
 
+/*  IOHINT_PIPELINE(depth) asks a buffered channel to keep up to
+    ``depth`` buffers (at most 15) of read-ahead or write-behind in
+    flight while the program works on the data it already has. It
+    applies to channels that only read or only write, and is
+    ignored unless the file uses positional or asynchronous I/O.
+    A channel's depth replaces the file's. See
+    :proc:`channel.stallTime`.
+ */
+proc IOHINT_PIPELINE(depth:int):iohints {
+  var d = depth;
+  if d < 0 then d = 0;
+  if d > QIO_MAX_PIPELINE_DEPTH then d = QIO_MAX_PIPELINE_DEPTH;
+  return (d:c_int) << QIO_HINT_PIPELINE_SHIFT;
+}
+
 pragma "no doc"
 extern type qio_file_ptr_t;
 private extern const QIO_FILE_PTR_NULL:qio_file_ptr_t;
@@ -1564,6 +1585,9 @@ extern record iostyle { // aka qio_style_t
        * 1 means  print out 'precision' number of digits after the decimal point
          (%f)
        * 2 means  always use exponential and 'precision' number of digits (%e)
+       * 3 means  print out the fewest significant digits that read back
+         as the same value, choosing between fixed and exponential
+         notation like %g does.  'precision' is ignored.
    */
   var realfmt:uint(8) = 0;
 
@@ -1609,6 +1633,7 @@ private extern proc qio_file_sync(f:qio_file_ptr_t):syserr;
 private extern proc qio_channel_end_offset_unlocked(ch:qio_channel_ptr_t):int(64);
 private extern proc qio_file_get_style(f:qio_file_ptr_t, ref style:iostyle);
 private extern proc qio_file_length(f:qio_file_ptr_t, ref len:int(64)):syserr;
+private extern proc qio_file_map_region(f:qio_file_ptr_t, offset:int(64), len:int(64), writeback:c_int, hints:c_int, ref region:c_void_ptr, ref data:c_void_ptr):syserr;
 
 pragma "no prototype" // FIXME
 private extern proc qio_channel_create(ref ch:qio_channel_ptr_t, file:qio_file_ptr_t, hints:c_int, readable:c_int, writeable:c_int, start:int(64), end:int(64), const ref style:iostyle):syserr;
@@ -1623,6 +1648,34 @@ private extern proc qio_channel_clear_error(ch:qio_channel_ptr_t);
 private extern proc _qio_channel_set_error_unlocked(ch:qio_channel_ptr_t, err:syserr);
 private extern proc qio_channel_error(ch:qio_channel_ptr_t):syserr;
 
+private extern proc bulk_put_channel(dst_locale:int, dst_addr:c_void_ptr, dst_len:int(64), ch:qio_channel_ptr_t, ref amt_read:int(64)):syserr;
+private extern proc qio_channel_create_compress(ref ch_out:qio_channel_ptr_t, under:qio_channel_ptr_t, format:c_int, hints:c_int, const ref style:iostyle):syserr;
+
+pragma "no doc"
+extern record qio_array_header_t {
+  var kind:uint(32);
+  var elt_size:uint(32);
+  var rank:uint(32);
+  var compression:uint(32);
+  var data_len:int(64);
+  var swapped:uint(8);
+}
+
+private extern const QIO_ARRAY_KIND_INT:c_int;
+private extern const QIO_ARRAY_KIND_UINT:c_int;
+private extern const QIO_ARRAY_KIND_REAL:c_int;
+private extern const QIO_ARRAY_KIND_IMAG:c_int;
+private extern const QIO_ARRAY_KIND_COMPLEX:c_int;
+
+private extern proc qio_array_header_init(ref hdr:qio_array_header_t, kind:c_int, elt_size:int(64), rank:int(64));
+private extern proc qio_array_header_set_dim(ref hdr:qio_array_header_t, d:int(64), low:int(64), size:int(64));
+private extern proc qio_array_header_get_dim(const ref hdr:qio_array_header_t, d:int(64), ref low:int(64), ref size:int(64));
+private extern proc qio_array_header_len(rank:int(64)):int(64);
+private extern proc qio_array_header_write(threadsafe:c_int, ch:qio_channel_ptr_t, ref hdr:qio_array_header_t):syserr;
+private extern proc qio_array_header_read(threadsafe:c_int, ch:qio_channel_ptr_t, ref hdr:qio_array_header_t):syserr;
+private extern proc qio_array_bswap(data:c_void_ptr, nparts:int(64), part_size:int(64));
+private extern proc bulk_get_channel(ch:qio_channel_ptr_t, src_locale:int, src_addr:c_void_ptr, src_len:int(64)):syserr;
+
 
 private extern proc qio_channel_lock(ch:qio_channel_ptr_t):syserr;
 private extern proc qio_channel_unlock(ch:qio_channel_ptr_t);
@@ -1656,6 +1709,7 @@ private extern proc qio_channel_write_amt(threadsafe:c_int, ch:qio_channel_ptr_t
 private extern proc qio_channel_write_byte(threadsafe:c_int, ch:qio_channel_ptr_t, byte:uint(8)):syserr;
 
 private extern proc qio_channel_offset_unlocked(ch:qio_channel_ptr_t):int(64);
+private extern proc qio_channel_stall_time_unlocked(ch:qio_channel_ptr_t):int(64);
 private extern proc qio_channel_advance(threadsafe:c_int, ch:qio_channel_ptr_t, nbytes:int(64)):syserr;
 private extern proc qio_channel_mark(threadsafe:c_int, ch:qio_channel_ptr_t):syserr;
 private extern proc qio_channel_revert_unlocked(ch:qio_channel_ptr_t);
@@ -1670,6 +1724,11 @@ private extern proc qio_locales_for_region(fl:qio_file_ptr_t,
                                    ref loc_names:c_ptr(c_string),
                                    ref num_locs_out:c_int):syserr;
 private extern proc qio_get_chunk(fl:qio_file_ptr_t, ref len:int(64)):syserr;
+private extern proc qio_file_record_boundaries(fl:qio_file_ptr_t,
+                                   separator:uint(8),
+                                   start:int(64), end:int(64),
+                                   nchunks:int(64),
+                                   bounds_out:c_ptr(int(64))):syserr;
 private extern proc qio_get_fs_type(fl:qio_file_ptr_t, ref tp:c_int):syserr;
 private extern proc qio_free_string(arg:c_string);
 
@@ -1930,6 +1989,8 @@ The following :type:`iohints` constants are provided:
     cached in memory, possibly all at once.
   * :const:`IOHINT_PARALLEL` suggests to expect many channels
     working with this file in parallel.
+  * :proc:`IOHINT_PIPELINE` requests read-ahead or write-behind
+    that overlaps with computation.
 
 
 Other hints might be added in the future.
@@ -2206,6 +2267,88 @@ proc file.length():int(64) {
   return len;
 }
 
+pragma "no doc"
+proc _isDefaultRectangularDom(d: DefaultRectangularDom) param return true;
+pragma "no doc"
+proc _isDefaultRectangularDom(d) param return false;
+
+/*
+  Make an array whose elements are stored in this file, starting at
+  byte ``offset``, instead of in newly allocated memory. The file is
+  mapped into memory, so creating the array reads nothing; a page of the
+  file is only read when an element on it is first touched. This makes
+  it cheap to open very large binary datasets, or to use just part of
+  one. The elements are laid out densely in row-major order in the
+  machine's native byte order, as :proc:`channel.writeBinary` writes
+  them.
+
+  The array's elements can always be assigned to. If ``writeBack`` is
+  `true`, the assignments change the file as well, and the file is
+  lengthened if it is too short to hold the array; this requires the
+  file to be open for writing. Otherwise the changes are private to
+  this program and the file must already hold the whole array.
+
+  Declare the array as an alias of the result, as in
+  ``var A => f.mapArray(real, {1..n});``. Like any array returned from
+  a function, initializing a ``var`` with it using ``=`` copies the
+  elements into ordinary memory.
+
+  The mapping lasts until the array is destroyed, or until its domain
+  is resized, at which point the elements are copied into ordinary
+  memory. Call :proc:`file.fsync` to make sure written-back changes
+  have reached the storage device.
+
+  This must be called on the locale where the file was opened, and the
+  array is stored on that locale.
+
+  :arg eltType: the element type; must be a numeric type
+  :arg dom: a non-distributed rectangular domain for the array
+  :arg offset: the offset in the file of the first element
+  :arg writeBack: whether assignments to the elements change the file
+  :arg hints: hints describing how the array will be accessed, such as
+              ``IOHINT_SEQUENTIAL``, ``IOHINT_RANDOM`` or
+              ``IOHINT_CACHED`` (which reads the whole region in up front).
+              If not provided, the file's hints are used.
+  :returns: an array over ``dom`` backed by the file
+*/
+proc file.mapArray(type eltType, dom: domain, offset:int(64) = 0,
+                   writeBack:bool = false, hints:iohints = IOHINT_NONE)
+where isNumericType(eltType)
+{
+  if !_isDefaultRectangularDom(dom._value) then
+    compilerError("file.mapArray needs a non-distributed rectangular domain");
+  check();
+  if this.home != here then
+    halt("file.mapArray must be called on the locale that opened the file");
+
+  const len = dom.numIndices:int(64) * numBytes(eltType);
+  var region:c_void_ptr;
+  var addr:c_void_ptr;
+  if len > 0 {
+    var err = qio_file_map_region(_file_internal, offset, len,
+                                  writeBack:c_int, hints, region, addr);
+    if err then ioerror(err, "in file.mapArray", this.tryGetPath());
+  }
+
+  // An empty array has nothing to map, so it is built as usual.
+  var x = if len == 0 then dom._value.dsiBuildArray(eltType)
+          else new DefaultRectangularArr(eltType=eltType, rank=dom.rank,
+                                         idxType=dom.idxType,
+                                         stridable=dom.stridable,
+                                         dom=dom._value, noinit_data=true);
+  if len > 0 then
+    x.adoptMappedData(addr, region);
+  dom._value.add_arr(x);
+  if !noRefCount {
+    dom._value.incRefCount();
+    // The reference held by the returned array; initializing 'ret'
+    // with a no-copy move does not take one.
+    x.incRefCount();
+  }
+  pragma "no copy" var ret = _newArray(x);
+  return ret;
+}
+
 // these strings are here (vs in _modestring)
 // in an attempt to avoid string copies, leaks,
 // and unnecessary allocations.
@@ -2876,6 +3019,25 @@ proc channel.offset():int(64) {
   return ret;
 }
 
+/*
+   Return how long this channel has spent waiting for read-ahead or
+   write-behind requested with :proc:`IOHINT_PIPELINE`. A large value
+   means the I/O did not keep up, and a deeper pipeline or more work
+   between reads or writes might help.
+
+   :returns: the total wait time in seconds, or 0.0 if the channel
+             is not pipelined
+ */
+proc channel.stallTime():real {
+  var ret:int(64);
+  on this.home {
+    this.lock();
+    ret = qio_channel_stall_time_unlocked(_channel_internal);
+    this.unlock();
+  }
+  return ret:real / 1e9;
+}
+
 /*
    Move a channel offset forward.
    
@@ -4171,6 +4333,555 @@ proc channel.readline(ref arg:string):bool {
   }
 }
 
+// Returns the locale id and address of the first element of a 1D
+// local array, for the bulk channel transfers below.
+private proc _bulkArrayAddr(data: [], out loc:int, out addr:c_void_ptr) {
+  if !data._value.isDefaultRectangular() then
+    compilerError("bulk channel transfers need a local (DefaultRectangular) array");
+  var l:int;
+  var a:c_void_ptr;
+  on data {
+    l = here.id;
+    a = c_ptrTo(data):c_void_ptr;
+  }
+  loc = l;
+  addr = a;
+}
+
+/*
+  Read the elements of an array from a channel as raw bytes, filling
+  the array in order. The bytes are taken to be in the machine's native
+  byte order and the channel's style is not consulted.
+
+  When the array and the channel are on different locales, the data is
+  transferred straight from the channel's buffer into the array's
+  memory instead of being copied to a temporary first.
+
+  :arg data: a 1D array of numeric values with unit stride
+  :arg numRead: the number of elements read. This can be less than
+                ``data.size`` if the end of the channel was reached; a
+                trailing partial element is consumed but not counted.
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+  :returns: `true` if the whole array was read without error, `false`
+            on error or EOF
+*/
+proc channel.readBinary(ref data: [] ?t, out numRead:int,
+                        out error:syserr):bool
+where data.rank == 1 && isRectangularArr(data) &&
+      !data.domain.stridable && isNumericType(t)
+{
+  if writing then compilerError("read on write-only channel");
+  error = ENOERR;
+  numRead = 0;
+  if data.size == 0 then return true;
+
+  var dataLoc:int;
+  var dataAddr:c_void_ptr;
+  _bulkArrayAddr(data, dataLoc, dataAddr);
+
+  const len = data.size:int(64) * numBytes(t);
+  var got:int(64);
+  on this.home {
+    var amt:int(64);
+    this.lock();
+    error = bulk_put_channel(dataLoc, dataAddr, len,
+                             _channel_internal, amt);
+    this.unlock();
+    got = amt;
+  }
+  numRead = (got / numBytes(t)):int;
+  return !error;
+}
+
+// documented in the error= version
+pragma "no doc"
+proc channel.readBinary(ref data: [] ?t, out numRead:int):bool
+where data.rank == 1 && isRectangularArr(data) &&
+      !data.domain.stridable && isNumericType(t)
+{
+  var e:syserr = ENOERR;
+  this.readBinary(data, numRead, error=e);
+  if !e then return true;
+  else if e == EEOF then return false;
+  else {
+    this._ch_ioerror(e, "in channel.readBinary(ref data: [] " +
+                        t:string + ", out numRead:int)");
+    return false;
+  }
+}
+
+/*
+  Write the elements of an array to a channel as raw bytes, in order.
+  The bytes are written in the machine's native byte order and the
+  channel's style is not consulted.
+
+  When the array and the channel are on different locales, the data is
+  transferred straight from the array's memory into the channel's
+  buffer instead of being copied to a temporary first.
+
+  :arg data: a 1D array of numeric values with unit stride
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+  :returns: `true` if the whole array was written without error
+*/
+proc channel.writeBinary(const ref data: [] ?t, out error:syserr):bool
+where data.rank == 1 && isRectangularArr(data) &&
+      !data.domain.stridable && isNumericType(t)
+{
+  if !writing then compilerError("write on read-only channel");
+  error = ENOERR;
+  if data.size == 0 then return true;
+
+  var dataLoc:int;
+  var dataAddr:c_void_ptr;
+  _bulkArrayAddr(data, dataLoc, dataAddr);
+
+  const len = data.size:int(64) * numBytes(t);
+  on this.home {
+    this.lock();
+    error = bulk_get_channel(_channel_internal, dataLoc, dataAddr, len);
+    this.unlock();
+  }
+  return !error;
+}
+
+// documented in the error= version
+pragma "no doc"
+proc channel.writeBinary(const ref data: [] ?t):bool
+where data.rank == 1 && isRectangularArr(data) &&
+      !data.domain.stridable && isNumericType(t)
+{
+  var e:syserr = ENOERR;
+  this.writeBinary(data, error=e);
+  if e then this._ch_ioerror(e, "in channel.writeBinary(const ref data: [] " +
+                                t:string + ")");
+  return !e;
+}
+
+/*
+
+Array Files
+-----------
+
+:proc:`channel.writeArray` and :proc:`file.writeArray` store a rectangular
+array of numbers in a self-describing binary format: a header recording
+the element type and the array's shape, followed by the elements in
+row-major order. :proc:`channel.readArray` and :proc:`file.readArray`
+read such an array back, checking that its type and shape match, and
+:proc:`file.arrayDomain` returns the domain of a stored array so that an
+array of the right shape can be declared before reading it.
+
+The elements are moved in bulk, one transfer for each block of the array
+that is contiguous both in memory and in the file, rather than one
+element at a time. The elements are written in the writer's native byte
+order; a reader with the other byte order swaps them after reading.
+
+Since the size of the header depends only on the array's rank, the file
+versions compute where each locale's part of a distributed array goes
+and write (or read) all of the parts in parallel. The elements of an
+array file start at ``offset + arrayHeaderSize(rank)``, so the elements
+can also be used in place with :proc:`file.mapArray`.
+
+ */
+
+/* The size in bytes of the header that starts an array file holding an
+   array of the given rank. */
+proc arrayHeaderSize(rank:int):int {
+  return qio_array_header_len(rank):int;
+}
+
+pragma "no doc"
+proc _arrayFileKind(type t):c_int {
+  if isIntType(t) then return QIO_ARRAY_KIND_INT;
+  else if isUintType(t) then return QIO_ARRAY_KIND_UINT;
+  else if isRealType(t) then return QIO_ARRAY_KIND_REAL;
+  else if isImagType(t) then return QIO_ARRAY_KIND_IMAG;
+  else return QIO_ARRAY_KIND_COMPLEX;
+}
+
+pragma "no doc"
+proc _arrayFileHeader(A: [] ?t):qio_array_header_t {
+  var hdr:qio_array_header_t;
+  qio_array_header_init(hdr, _arrayFileKind(t), numBytes(t), A.rank);
+  for param d in 1..A.rank do
+    qio_array_header_set_dim(hdr, d-1, A.domain.dim(d).low:int(64),
+                             A.domain.dim(d).size:int(64));
+  return hdr;
+}
+
+// Returns EFORMAT unless the header describes an array like A.
+pragma "no doc"
+proc _arrayFileCheck(const ref hdr:qio_array_header_t, A: [] ?t):syserr {
+  if hdr.kind:c_int != _arrayFileKind(t) ||
+     hdr.elt_size != numBytes(t) ||
+     hdr.rank != A.rank then return EFORMAT;
+  for param d in 1..A.rank {
+    var low, size:int(64);
+    qio_array_header_get_dim(hdr, d-1, low, size);
+    if size != A.domain.dim(d).size then return EFORMAT;
+  }
+  return ENOERR;
+}
+
+// Yields (file element, memory element, count) for each block of the
+// part LD of an array over D that is contiguous both in the array file
+// and in LD's row-major memory.  Element positions count from the start
+// of the data in the file and from LD.low in memory.
+pragma "no doc"
+iter _arrayFileRuns(D: domain, LD: domain) {
+  param rank = D.rank;
+  if LD.numIndices > 0 {
+    const runLen = LD.dim(rank).size;
+    const nRuns = LD.numIndices / runLen;
+    var start, memStart, count:int;
+    for k in 0..#nRuns {
+      var rem = k;
+      var pos = LD.dim(rank).low - D.dim(rank).low;
+      var mult = D.dim(rank).size;
+      for d in 1..rank-1 by -1 {
+        const n = LD.dim(d).size;
+        pos += (LD.dim(d).low + rem % n - D.dim(d).low) * mult;
+        rem /= n;
+        mult *= D.dim(d).size;
+      }
+      if count > 0 && pos == start + count {
+        count += runLen;
+      } else {
+        if count > 0 then yield (start, memStart, count);
+        memStart += count;
+        start = pos;
+        count = runLen;
+      }
+    }
+    yield (start, memStart, count);
+  }
+}
+
+pragma "no doc"
+proc _arrayEltAddr(A: [], i):c_void_ptr {
+  return c_ptrTo(A[i]):c_void_ptr;
+}
+
+// Byte-swap n elements of type t in place.
+pragma "no doc"
+proc _arrayFileSwap(type t, addr:c_void_ptr, n:int) {
+  if isComplexType(t) then
+    qio_array_bswap(addr, 2*n, numBytes(t)/2);
+  else
+    qio_array_bswap(addr, n, numBytes(t));
+}
+
+/*
+  Write an array to a channel in the array file format described in
+  `Array Files`_: a header followed by the elements.
+
+  :arg A: a non-distributed rectangular array of numeric values with
+          unit stride. Use :proc:`file.writeArray` for distributed arrays.
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+  :returns: `true` if the array was written without error
+*/
+proc channel.writeArray(const ref A: [] ?t, out error:syserr):bool
+where isRectangularArr(A) && isNumericType(t)
+{
+  if !writing then compilerError("write on read-only channel");
+  if A.domain.stridable then
+    compilerError("writeArray needs an array with unit stride");
+  if !_isDefaultRectangularDom(A.domain._value) then
+    compilerError("channel.writeArray needs a non-distributed array; use file.writeArray");
+
+  var hdr = _arrayFileHeader(A);
+  var dataLoc:int;
+  var dataAddr:c_void_ptr;
+  if A.numElements > 0 then
+    _bulkArrayAddr(A, dataLoc, dataAddr);
+  on this.home {
+    this.lock();
+    var h = hdr;
+    error = qio_array_header_write(false, _channel_internal, h);
+    if !error && h.data_len > 0 then
+      error = bulk_get_channel(_channel_internal, dataLoc, dataAddr,
+                               h.data_len);
+    this.unlock();
+  }
+  return !error;
+}
+
+// documented in the error= version
+pragma "no doc"
+proc channel.writeArray(const ref A: [] ?t):bool
+where isRectangularArr(A) && isNumericType(t)
+{
+  var e:syserr = ENOERR;
+  this.writeArray(A, error=e);
+  if e then this._ch_ioerror(e, "in channel.writeArray");
+  return !e;
+}
+
+/*
+  Read an array written in the array file format described in
+  `Array Files`_. The stored array must have the same element type and
+  rank as ``A`` and the same number of indices in each dimension, or
+  the error will be :data:`SysBasic.EFORMAT`.
+
+  :arg A: a non-distributed rectangular array of numeric values with
+          unit stride. Use :proc:`file.readArray` for distributed arrays.
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+  :returns: `true` if the array was read without error, `false` on error
+            or EOF
+*/
+proc channel.readArray(ref A: [] ?t, out error:syserr):bool
+where isRectangularArr(A) && isNumericType(t)
+{
+  if writing then compilerError("read on write-only channel");
+  if A.domain.stridable then
+    compilerError("readArray needs an array with unit stride");
+  if !_isDefaultRectangularDom(A.domain._value) then
+    compilerError("channel.readArray needs a non-distributed array; use file.readArray");
+
+  var hdr:qio_array_header_t;
+  var dataLoc:int;
+  var dataAddr:c_void_ptr;
+  if A.numElements > 0 then
+    _bulkArrayAddr(A, dataLoc, dataAddr);
+  on this.home {
+    this.lock();
+    var h:qio_array_header_t;
+    error = qio_array_header_read(false, _channel_internal, h);
+    if !error then error = _arrayFileCheck(h, A);
+    if !error && h.data_len > 0 {
+      var amt:int(64);
+      error = bulk_put_channel(dataLoc, dataAddr, h.data_len,
+                               _channel_internal, amt);
+    }
+    this.unlock();
+    hdr = h;
+  }
+  if !error && hdr.swapped != 0 && A.numElements > 0 then
+    on A do _arrayFileSwap(t, dataAddr, A.numElements);
+  return !error;
+}
+
+// documented in the error= version
+pragma "no doc"
+proc channel.readArray(ref A: [] ?t):bool
+where isRectangularArr(A) && isNumericType(t)
+{
+  var e:syserr = ENOERR;
+  this.readArray(A, error=e);
+  if !e then return true;
+  else if e == EEOF then return false;
+  else {
+    this._ch_ioerror(e, "in channel.readArray");
+    return false;
+  }
+}
+
+// Move the part of A on this locale, over LD, to or from the array file
+// whose elements start at dataStart. One channel covers the whole part,
+// and we skip ahead over the other locales' elements between runs. The
+// channel is unbuffered so that skipping only moves its position: a
+// buffered writer would write zeros over the bytes it skips.
+pragma "no doc"
+proc file._arrayFileLocalPart(A: [] ?t, LD: domain, dataStart:int(64),
+                              param writing:bool, swap:bool):syserr {
+  var error:syserr = ENOERR;
+  if LD.numIndices == 0 then return error;
+  const base = _arrayEltAddr(A, LD.low):c_ptr(t);
+  const dataLoc = here.id;
+  var firstElt, endElt:int(64);
+  for (fileElt, memElt, count) in _arrayFileRuns(A.domain, LD) {
+    if memElt == 0 then firstElt = fileElt;
+    endElt = fileElt + count;
+  }
+  const chStart = dataStart + firstElt * numBytes(t);
+  const chEnd = dataStart + endElt * numBytes(t);
+  var ch = if writing
+           then this.writer(kind=iokind.native, locking=false, start=chStart,
+                            end=chEnd, hints=QIO_CH_ALWAYS_UNBUFFERED,
+                            error=error)
+           else this.reader(kind=iokind.native, locking=false, start=chStart,
+                            end=chEnd, hints=QIO_CH_ALWAYS_UNBUFFERED,
+                            error=error);
+  if error then return error;
+  on ch.home {
+    var pos = chStart;
+    for (fileElt, memElt, count) in _arrayFileRuns(A.domain, LD) {
+      const start = dataStart + fileElt * numBytes(t);
+      const len = count:int(64) * numBytes(t);
+      const addr = (base + memElt):c_void_ptr;
+      error = qio_channel_advance(false, ch._channel_internal, start - pos);
+      if error then break;
+      if writing {
+        error = bulk_get_channel(ch._channel_internal, dataLoc, addr, len);
+      } else {
+        var amt:int(64);
+        error = bulk_put_channel(dataLoc, addr, len, ch._channel_internal,
+                                 amt);
+      }
+      if error then break;
+      if !writing && swap then _arrayFileSwap(t, addr, count);
+      pos = start + len;
+    }
+  }
+  var closeError:syserr = ENOERR;
+  ch.close(error=closeError);
+  if !error then error = closeError;
+  return error;
+}
+
+// Write (or read) the elements of A, starting at dataStart, from every
+// locale that holds part of A.
+pragma "no doc"
+proc file._arrayFileData(A: [] ?t, dataStart:int(64), param writing:bool,
+                         swap:bool):syserr {
+  var error:syserr = ENOERR;
+  if _isDefaultRectangularDom(A.domain._value) {
+    on A {
+      error = this._arrayFileLocalPart(A, A.domain, dataStart, writing, swap);
+    }
+  } else {
+    if !A.hasSingleLocalSubdomain() then
+      compilerError("array files need arrays whose locales each hold a single block");
+    var errs:[LocaleSpace] syserr;
+    coforall loc in A.targetLocales() do on loc {
+      errs[here.id] = this._arrayFileLocalPart(A, A.localSubdomain(),
+                                               dataStart, writing, swap);
+    }
+    for e in errs do
+      if e != ENOERR && error == ENOERR then error = e;
+  }
+  return error;
+}
+
+/*
+  Write an array to a file in the array file format described in
+  `Array Files`_. Each locale holding part of the array writes its part
+  directly, so distributed arrays are written in parallel.
+
+  :arg A: a rectangular array of numeric values with unit stride. If it
+          is distributed, each locale must hold a single block of it, as
+          with the Block distribution.
+  :arg offset: the offset in the file at which to write the header
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+*/
+proc file.writeArray(const ref A: [] ?t, offset:int(64) = 0,
+                     out error:syserr)
+where isRectangularArr(A) && isNumericType(t)
+{
+  if A.domain.stridable then
+    compilerError("writeArray needs an array with unit stride");
+  var hdr = _arrayFileHeader(A);
+  var w = this.writer(kind=iokind.native, locking=false, start=offset,
+                      error=error);
+  if error then return;
+  on w.home {
+    var h = hdr;
+    error = qio_array_header_write(false, w._channel_internal, h);
+  }
+  if !error then w.close(error=error);
+  if error then return;
+  error = this._arrayFileData(A, offset + arrayHeaderSize(A.rank),
+                              writing=true, swap=false);
+}
+
+// documented in the error= version
+pragma "no doc"
+proc file.writeArray(const ref A: [] ?t, offset:int(64) = 0)
+where isRectangularArr(A) && isNumericType(t)
+{
+  var err:syserr = ENOERR;
+  this.writeArray(A, offset, err);
+  if err then ioerror(err, "in file.writeArray", this.tryGetPath());
+}
+
+// Read the header of an array file at offset.
+pragma "no doc"
+proc file._readArrayHeader(offset:int(64), out error:syserr)
+    :qio_array_header_t {
+  var hdr:qio_array_header_t;
+  var r = this.reader(kind=iokind.native, locking=false, start=offset,
+                      error=error);
+  if error then return hdr;
+  on r.home {
+    var h:qio_array_header_t;
+    error = qio_array_header_read(false, r._channel_internal, h);
+    hdr = h;
+  }
+  r.close();
+  return hdr;
+}
+
+/*
+  Read an array from a file in the array file format described in
+  `Array Files`_. The stored array must have the same element type and
+  rank as ``A`` and the same number of indices in each dimension, or
+  the error will be :data:`SysBasic.EFORMAT`. Each locale holding part
+  of the array reads its part directly, so distributed arrays are read
+  in parallel.
+
+  :arg A: a rectangular array of numeric values with unit stride. If it
+          is distributed, each locale must hold a single block of it, as
+          with the Block distribution.
+  :arg offset: the offset in the file of the header
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+*/
+proc file.readArray(ref A: [] ?t, offset:int(64) = 0, out error:syserr)
+where isRectangularArr(A) && isNumericType(t)
+{
+  if A.domain.stridable then
+    compilerError("readArray needs an array with unit stride");
+  var hdr = this._readArrayHeader(offset, error);
+  if !error then error = _arrayFileCheck(hdr, A);
+  if error then return;
+  error = this._arrayFileData(A, offset + arrayHeaderSize(A.rank),
+                              writing=false, swap=hdr.swapped != 0);
+}
+
+// documented in the error= version
+pragma "no doc"
+proc file.readArray(ref A: [] ?t, offset:int(64) = 0)
+where isRectangularArr(A) && isNumericType(t)
+{
+  var err:syserr = ENOERR;
+  this.readArray(A, offset, err);
+  if err then ioerror(err, "in file.readArray", this.tryGetPath());
+}
+
+/*
+  Return the domain of an array stored in a file in the array file
+  format described in `Array Files`_, so that an array of the right
+  shape can be declared before calling :proc:`file.readArray`. The
+  domain has the same low bounds as the array that was written.
+
+  :arg rank: the rank of the stored array
+  :arg offset: the offset in the file of the header
+  :returns: a rectangular domain of the given rank
+*/
+proc file.arrayDomain(param rank:int, offset:int(64) = 0):domain(rank) {
+  var err:syserr = ENOERR;
+  var hdr = this._readArrayHeader(offset, err);
+  if !err && hdr.rank != rank then err = EFORMAT;
+  if err then ioerror(err, "in file.arrayDomain", this.tryGetPath());
+  var ranges:rank*range;
+  for param d in 1..rank {
+    var low, size:int(64);
+    qio_array_header_get_dim(hdr, d-1, low, size);
+    ranges(d) = low:int..#size:int;
+  }
+  var D:domain(rank) = ranges;
+  return D;
+}
 /* read a given number of bytes from a channel
 
    :arg str_out: The string to be read into
@@ -4695,6 +5406,83 @@ proc channel.isclosed() {
   return ret;
 }
 
+/*
+  The compression formats that :proc:`channel.compressed` supports.
+*/
+enum iocompression {
+  /* The LZ4 frame format, as read and written by the ``lz4`` command
+     line tool. */
+  lz4 = 1,
+}
+
+/*
+  Return a channel that compresses or decompresses the data of this
+  one. Data written to the returned channel is compressed and written
+  to this channel; data read from the returned channel is read from
+  this channel and decompressed. The returned channel works the same
+  way whatever I/O method this channel uses, but it can't seek.
+
+  Compression runs on a pool of helper threads (set the environment
+  variable ``CHPL_RT_QIO_COMPRESS_THREADS`` to change their number), so
+  blocks are compressed in parallel while the caller keeps writing, and
+  when reading, blocks are read ahead and decompressed before they are
+  needed.
+
+  Close the returned channel when done with it. For a writing channel,
+  that finishes the compressed data; after that more can be written to
+  this channel (including another compressed stream, since concatenated
+  streams are read back as one). Closing the returned channel does not
+  close this one.
+
+  .. code-block:: chapel
+
+    var w = open("data.lz4", iomode.cw).writer();
+    var cw = w.compressed();
+    cw.writeln("hello");
+    cw.close();
+    w.close();
+
+  :arg error: optional argument to capture an error code. If this argument
+              is not provided and an error is encountered, this function
+              will halt with an error message.
+  :arg format: the compression format; see :type:`iocompression`
+  :arg hints: hints for the returned channel
+  :arg style: the I/O style for the returned channel; by default, this
+              channel's style
+  :returns: a channel of the same type as this one
+*/
+proc channel.compressed(out error:syserr,
+                        format:iocompression = iocompression.lz4,
+                        hints:iohints = IOHINT_NONE,
+                        style:iostyle = this._style()):
+                        channel(writing, kind, locking) {
+  var ret:channel(writing, kind, locking);
+  on this.home {
+    var local_style = style;
+    if kind != iokind.dynamic {
+      local_style.binary = true;
+      local_style.byteorder = kind:uint(8);
+    }
+    ret.home = here;
+    error = qio_channel_create_compress(ret._channel_internal,
+                                        _channel_internal, format:c_int,
+                                        hints, local_style);
+  }
+  return ret;
+}
+
+// documented in the error= version
+pragma "no doc"
+proc channel.compressed(format:iocompression = iocompression.lz4,
+                        hints:iohints = IOHINT_NONE,
+                        style:iostyle = this._style()):
+                        channel(writing, kind, locking) {
+  var err:syserr = ENOERR;
+  var ret = this.compressed(err, format, hints, style);
+  if err then this._ch_ioerror(err, "in channel.compressed");
+  return ret;
+}
+
 // TODO -- we should probably have separate c_ptr ddata and ref versions
 // in this function for it to become user-facing. Right now, errors
 // in the type of the argument will only be caught by a type mismatch
@@ -6415,6 +7203,7 @@ proc string.format(args ...?k):string {
 use Regexp;
 
 private extern proc qio_regexp_channel_match(const ref re:qio_regexp_t, threadsafe:c_int, ch:qio_channel_ptr_t, maxlen:int(64), anchor:c_int, can_discard:bool, keep_unmatched:bool, keep_whole_pattern:bool, submatch:_ddata(qio_regexp_string_piece_t), nsubmatch:int(64)):syserr;
+private extern proc qio_regexp_set_channel_match(const ref set:qio_regexp_set_t, threadsafe:c_int, ch:qio_channel_ptr_t, ref line:qio_regexp_string_piece_t, matched:_ddata(int(64)), nmatched:int(64), ref nfound:int(64)):syserr;
 
 pragma "no doc"
 proc channel._extractMatch(m:reMatch, ref arg:reMatch, ref error:syserr) {
@@ -6859,6 +7648,60 @@ iter channel.matches(re:regexp, param captures=0, maxmatches:int = max(int))
   if error then this._ch_ioerror(error, "in channel.matches");
 }
 
+/* Enumerates the lines in the channel that match any pattern in a set of
+   regular expressions, along with which patterns they match.
+
+   Reads the channel one line at a time from its current position, and
+   matches each line against all of the patterns at once.  This is much
+   faster than searching the channel once for each pattern.  Lines end
+   with a newline, which is not part of the line as far as matching is
+   concerned; the last line in the channel need not end with one.
+
+   At the time each match is returned, the channel position is just
+   after the line that matched.  In the end, leaves the channel position
+   at the end of the channel.
+
+   Holds the channel lock for the duration of the search.
+
+   :arg patterns: a :record:`Regexp.regexpSet` representing the compiled
+                  patterns.
+   :yields: a tuple of a :record:`Regexp.reMatch` giving the offset and
+            length of the line and the index of a pattern that matched it,
+            once for each pattern matching the line, in order.
+ */
+iter channel.matchLines(patterns:regexpSet):(reMatch, int)
+{
+  var error:syserr = ENOERR;
+
+  if patterns.home != this.home then
+    halt("channel.matchLines needs a regexpSet compiled on the channel's locale");
+
+  var n = patterns.size;
+
+  lock();
+  while n > 0 && !error {
+    var line:qio_regexp_string_piece_t;
+    var nfound:int(64);
+    var found:[0..#n] int;
+    on this.home {
+      var matched = _ddata_allocate(int(64), n);
+      error = qio_regexp_set_channel_match(patterns._set, false,
+                                           _channel_internal, line,
+                                           matched, n, nfound);
+      for i in 0..#nfound do found[i] = patterns._patternIndex(matched[i]);
+      _ddata_free(matched);
+    }
+    if !error {
+      var m = new reMatch(true, line.offset, line.len);
+      for i in 0..#nfound do yield (m, found[i]);
+    }
+  }
+  unlock();
+  // Running out of lines is not an error.
+  if error == EEOF then error = ENOERR;
+  if error then this._ch_ioerror(error, "in channel.matchLines");
+}
+
 /************** Distributed File Systems ***************/
 
 private extern const FTYPE_NONE   : c_int;
@@ -6983,4 +7826,115 @@ proc file.localesForRegion(start:int(64), end:int(64)) {
   return ret;
 }
 
+/************** Parallel Record Readers ***************/
+
+/*
+   Split the region start..end-1 of a file into ``nChunks`` pieces of
+   about the same size, each beginning at the start of a record. A
+   record ends with the ``separator`` byte, so by default the pieces
+   hold whole lines.
+
+   Only a little of the file near each split point is read.
+
+   :arg nChunks: how many pieces to make
+   :arg separator: the byte that ends each record
+   :arg start: the file offset (starting from 0) where the region begins
+   :arg end: the file offset just after the region; it is limited to
+             the length of the file
+   :returns: an array of ``nChunks+1`` file offsets. Piece ``i`` is
+             ``result[i]..result[i+1]-1``. A piece is empty when a
+             single record covers the whole of it.
+ */
+proc file.recordBoundaries(nChunks:int, separator:uint(8) = 0x0a,
+                           start:int(64) = 0,
+                           end:int(64) = max(int(64))) {
+  if nChunks < 1 then halt("file.recordBoundaries needs nChunks >= 1");
+
+  var bounds:[0..nChunks] int(64);
+  var err:syserr = ENOERR;
+  on this.home {
+    var b:[0..nChunks] int(64);
+    err = qio_file_record_boundaries(this._file_internal, separator,
+                                     start, end, nChunks, c_ptrTo(b));
+    bounds = b;
+  }
+  if err then ioerror(err, "in file.recordBoundaries", this.tryGetPath());
+  return bounds;
+}
+
+/*
+   A set of reading channels that together cover a region of a file,
+   each holding whole records. See :proc:`file.recordReaders`.
+ */
+record RecordReaders {
+  pragma "no doc"
+  var f:file;
+  pragma "no doc"
+  var boundsDom:domain(1);
+  /* the file offsets where the pieces begin and end, as returned by
+     :proc:`file.recordBoundaries` */
+  var bounds:[boundsDom] int(64);
+  pragma "no doc"
+  var hints:iohints;
+  pragma "no doc"
+  var style:iostyle;
+
+  /* the number of pieces */
+  proc size return boundsDom.size - 1;
+
+  /* return a channel that reads piece ``i``, counting from 0 */
+  proc reader(i:int) {
+    return f.reader(start=bounds[i], end=bounds[i+1], hints=hints, style=style);
+  }
+
+  /* iterate over a channel for each piece, in order */
+  iter these() {
+    for i in 0..#size do yield reader(i);
+  }
+
+  /* in a ``forall`` loop, read each piece in its own task */
+  iter these(param tag:iterKind) where tag == iterKind.standalone {
+    coforall i in 0..#size do yield reader(i);
+  }
+
+  pragma "no doc"
+  iter these(param tag:iterKind) where tag == iterKind.leader {
+    coforall i in 0..#size do yield i..i;
+  }
+
+  pragma "no doc"
+  iter these(param tag:iterKind, followThis) where tag == iterKind.follower {
+    for i in followThis do yield reader(i);
+  }
+}
+
+/*
+   Split the region start..end-1 of a file into pieces that each hold
+   whole records (see :proc:`file.recordBoundaries`), so that a text
+   file can be parsed in parallel::
+
+     forall r in f.recordReaders() {
+       var line:string;
+       while r.readline(line) do process(line);
+     }
+
+   Each piece is read through the channel that :proc:`file.reader`
+   would return for it, given ``hints`` and ``style``.
+
+   :arg nChunks: how many pieces to make. By default, one per core on
+                 the locale that calls this.
+   :arg separator: the byte that ends each record
+   :returns: a :record:`RecordReaders` whose ``these`` iterators yield
+             a channel for each piece
+ */
+proc file.recordReaders(nChunks:int = here.maxTaskPar,
+                        separator:uint(8) = 0x0a,
+                        start:int(64) = 0, end:int(64) = max(int(64)),
+                        hints:iohints = IOHINT_NONE,
+                        style:iostyle = this._style) {
+  const b = this.recordBoundaries(nChunks, separator, start, end);
+  return new RecordReaders(f=this, boundsDom={0..nChunks}, bounds=b,
+                           hints=hints, style=style);
+}
+
 } /* end of module */
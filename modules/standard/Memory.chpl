@@ -65,7 +65,7 @@
     If during execution the amount of allocated memory exceeds this
     limit on any locale, halt the program with a message saying so.
 
-  The following two config variables do not enable memory tracking;
+  The following config variables do not enable memory tracking;
   they only modify how it is done.
 
 
@@ -73,6 +73,14 @@
     If this is set to a value greater than 0 (zero), only allocation
     requests larger than this are tracked and/or reported.
 
+  ``memSample``: `uint`:
+    If this is set to a value greater than 1 (one), each thread only
+    tracks one of every ``memSample`` allocations, which makes memory
+    tracking much cheaper for programs that allocate often.  The
+    reports and :proc:`memoryUsed` then only cover the sampled
+    allocations, while ``memMax`` is checked against the sampled
+    memory scaled up by ``memSample``.
+
   ``memLog``: `c_string`:
     Memory reporting is written to this file.  By default it is the
     ``stdout`` associated with the process (not the Chapel channel
@@ -195,6 +203,48 @@ proc printMemAllocStats() {
   chpl_printMemAllocStats();
 }
 
+/*
+  Print a one-line summary of per-task arena use on the calling locale
+  to ``stdout``: how many allocations were served from task arenas, how
+  many were too large and went to the heap instead, how many arena
+  chunks were allocated, and how many tasks have released their arenas.
+  The counts include the calling task, plus every task on this locale
+  that has ended.  Task arenas are enabled by setting the environment
+  variable ``CHPL_RT_TASK_ARENA`` to ``true``; otherwise the counts are
+  all zero.
+*/
+proc printTaskArenaStats() {
+  extern proc chpl_mem_taskArenaStats(ref nAllocs: uint(64),
+                                      ref nHeap: uint(64),
+                                      ref nChunks: uint(64),
+                                      ref nReleased: uint(64));
+
+  var nAllocs, nHeap, nChunks, nReleased: uint(64);
+  chpl_mem_taskArenaStats(nAllocs, nHeap, nChunks, nReleased);
+  writeln("task arena: ", nAllocs, " allocations, ", nHeap,
+          " heap fallbacks, ", nChunks, " chunks, ", nReleased,
+          " tasks released");
+}
+
+/*
+  Print a one-line summary of I/O buffer reuse on the calling locale to
+  ``stdout``: how many I/O buffers channels have asked for, how many of
+  those were reused from the pool of freed buffers rather than taken
+  from the heap, and how many bytes the pool is holding now.  The size
+  of the pool is set with the environment variable
+  ``CHPL_RT_QIO_IOBUF_POOL``.
+*/
+proc printIobufPoolStats() {
+  extern proc qio_iobuf_pool_stats(ref allocs: uint(64),
+                                   ref hits: uint(64),
+                                   ref heldBytes: uint(64));
+
+  var allocs, hits, heldBytes: uint(64);
+  qio_iobuf_pool_stats(allocs, hits, heldBytes);
+  writeln("iobuf pool: ", allocs, " buffers, ", hits, " reused, ",
+          heldBytes, " bytes held");
+}
+
 /*
   Start on-the-fly reporting of memory allocations and deallocations
   done on any locale.  Continue reporting until :proc:`stopVerboseMem`
@@ -58,6 +58,16 @@ Using Regular Expression Support
 Now you can use these methods on regular expressions: :proc:`regexp.search`,
 :proc:`regexp.match`, :proc:`regexp.split`, :proc:`regexp.matches`.
 
+To find out which of many patterns match some text, compile them together
+with :proc:`compileSet` and use :proc:`regexpSet.matches`, or
+:proc:`IO.channel.matchLines` to scan a file line by line:
+
+.. code-block:: chapel
+
+   var levels = compileSet(["ERROR", "WARN(ING)?", "timeout"]);
+   for (line, which) in stdin.matchLines(levels) do
+     writeln("pattern ", which, " matched the line at offset ", line.offset);
+
 You can also use the string versions of these methods: :proc:`string.search`,
 :proc:`string.match`, :proc:`string.split`, or :proc:`string.matches`.
 
@@ -391,6 +401,19 @@ private extern proc qio_regexp_string_piece_isnull(ref sp:qio_regexp_string_piec
 private extern proc qio_regexp_match(ref re:qio_regexp_t, text:c_string, textlen:int(64), startpos:int(64), endpos:int(64), anchor:c_int, submatch:_ddata(qio_regexp_string_piece_t), nsubmatch:int(64)):bool;
 private extern proc qio_regexp_replace(ref re:qio_regexp_t, repl:c_string, repllen:int(64), text:c_string, textlen:int(64), startpos:int(64), endpos:int(64), global:bool, ref replaced:c_string_copy, ref replaced_len:int(64)):int(64);
 
+pragma "no doc"
+extern type qio_regexp_set_t;
+
+pragma "no doc"
+extern proc qio_regexp_set_null():qio_regexp_set_t;
+private extern proc qio_regexp_set_create(ref options:qio_regexp_options_t, ref set:qio_regexp_set_t);
+private extern proc qio_regexp_set_add(ref set:qio_regexp_set_t, str:c_string, strlen:int(64), ref error:c_string_copy):int(64);
+private extern proc qio_regexp_set_compile(ref set:qio_regexp_set_t):bool;
+private extern proc qio_regexp_set_retain(const ref set:qio_regexp_set_t);
+private extern proc qio_regexp_set_release(ref set:qio_regexp_set_t);
+private extern proc qio_regexp_set_size(const ref set:qio_regexp_set_t):int(64);
+private extern proc qio_regexp_set_match(const ref set:qio_regexp_set_t, text:c_string, textlen:int(64), matched:_ddata(int(64)), nmatched:int(64)):int(64);
+
 // These two could be folded together if we had a way
 // to check if a default argument was supplied
 // (or any way to use 'nil' in pass-by-ref)
@@ -563,8 +586,11 @@ proc string.this(m:reMatch) {
   else return "";
 }
 
-/*  This class represents a compiled regular expression. Regular expressions
-    are currently cached on a per-thread basis and are reference counted.
+/*  This class represents a compiled regular expression. Compiled regular
+    expressions are cached for the whole program, so compiling the same
+    pattern with the same options again is cheap, and they are reference
+    counted.  Setting the environment variable ``CHPL_RT_REGEXP_CACHE_SIZE``
+    changes how many are kept in the cache (the default is 64).
     To create a compiled regular expression, use the compile function.
 
     A regexp can be cast to a string (resulting in the pattern that
@@ -1035,6 +1061,184 @@ inline proc _cast(type t, x: string) where t == regexp {
 
 
 
+/* This record represents a set of compiled regular expressions that are
+   matched together, in a single pass over the text, reporting which of
+   them matched.  This is much faster than trying each pattern in turn
+   when there are many patterns, such as when classifying log lines.
+   To create one, use :proc:`compileSet`.
+
+   Patterns are identified by their index in the array passed to
+   :proc:`compileSet`.  A set can only be used on the locale that
+   compiled it.
+ */
+pragma "ignore noinit"
+record regexpSet {
+  pragma "no doc"
+  var home: locale = here;
+  pragma "no doc"
+  var _set:qio_regexp_set_t = qio_regexp_set_null();
+  pragma "no doc"
+  var _first:int;
+  pragma "no doc"
+  var _step:int = 1;
+
+  /* The number of patterns in the set */
+  proc size:int {
+    var n:int;
+    on this.home {
+      n = qio_regexp_set_size(_set);
+    }
+    return n;
+  }
+
+  pragma "no doc"
+  proc ref ~regexpSet() {
+    qio_regexp_set_release(_set);
+    _set = qio_regexp_set_null();
+  }
+
+  pragma "no doc"
+  proc _patternIndex(i:int(64)):int {
+    return _first + i:int * _step;
+  }
+
+  /*
+     Enumerate the patterns in this set that match somewhere in the text.
+
+     :arg text: a string to search
+     :yields: the index of each pattern that matched, in increasing order
+              of position in the array of patterns
+   */
+  iter matches(text: string):int {
+    var n = this.size;
+    var nfound:int(64);
+    var found:[0..#n] int;
+    if n > 0 {
+      on this.home {
+        var matched = _ddata_allocate(int(64), n);
+        nfound = qio_regexp_set_match(_set, text.localize().c_str(),
+                                      text.length, matched, n);
+        for i in 0..#nfound do found[i] = _patternIndex(matched[i]);
+        _ddata_free(matched);
+      }
+      for i in 0..#nfound do yield found[i];
+    }
+  }
+}
+
+pragma "no doc"
+proc =(ref ret:regexpSet, x:regexpSet)
+{
+  on x.home {
+    qio_regexp_set_retain(x._set);
+  }
+  on ret.home {
+    qio_regexp_set_release(ret._set);
+  }
+  ret.home = x.home;
+  ret._set = x._set;
+  ret._first = x._first;
+  ret._step = x._step;
+}
+
+pragma "no doc"
+pragma "init copy fn"
+proc chpl__initCopy(x: regexpSet) {
+  on x.home {
+    qio_regexp_set_retain(x._set);
+  }
+  return x;
+}
+
+pragma "no doc"
+proc _compileSet(patterns: [?D] string, ref error:syserr, ref errorIndex:int, ref errorMsg:string, utf8, posix, literal, ignorecase):regexpSet {
+  if D.rank != 1 then
+    compilerError("compileSet requires a one-dimensional array of patterns");
+
+  var opts:qio_regexp_options_t;
+  qio_regexp_init_default_options(opts);
+  opts.utf8 = utf8;
+  opts.posix = posix;
+  opts.literal = literal;
+  opts.nocapture = true;
+  opts.ignorecase = ignorecase;
+
+  var ret:regexpSet;
+  ret._first = D.dim(1).first;
+  ret._step = D.stride;
+  qio_regexp_set_create(opts, ret._set);
+
+  error = ENOERR;
+  for (pattern, i) in zip(patterns, D) {
+    var err_str:c_string_copy;
+    var localPattern = pattern.localize();
+    if !error && qio_regexp_set_add(ret._set, localPattern.c_str(),
+                                    localPattern.length, err_str) < 0 {
+      error = qio_format_error_bad_regexp();
+      errorIndex = i;
+      errorMsg = new string(err_str, needToCopy=false);
+    }
+  }
+
+  if !error && !qio_regexp_set_compile(ret._set) {
+    error = qio_format_error_bad_regexp();
+    errorMsg = "pattern set too large";
+  }
+
+  return ret;
+}
+
+/*
+   Compile a set of regular expressions to be matched together.  If the
+   optional error argument is provided, this routine will return an error
+   code if compilation failed. Otherwise, it will halt with an error
+   message.
+
+   Capture groups in the patterns are ignored, since matching a set only
+   reports which patterns matched.
+
+   :arg patterns: a one-dimensional array of regular expressions.
+                  See :ref:`regular-expression-syntax` for details.
+   :arg error: (optional) if provided, return an error code instead of halting
+               if an error is encountered
+   :arg utf8: (optional, default true) set to `true` to create regular
+              expressions matching UTF-8; `false` for binary or ASCII only.
+   :arg posix: (optional) set to true to disable non-POSIX regular expression
+               syntax
+   :arg literal: (optional) set to true to treat the patterns as literal
+                 strings rather than as regular expressions.
+   :arg ignorecase: (optional) set to true in order to ignore case when
+                    matching.
+   :returns: a :record:`regexpSet`
+ */
+proc compileSet(patterns: [] string, out error:syserr, utf8=true, posix=false, literal=false, /*i*/ ignorecase=false):regexpSet {
+  var errorIndex:int;
+  var errorMsg:string;
+  return _compileSet(patterns, error, errorIndex, errorMsg,
+                     utf8, posix, literal, ignorecase);
+}
+
+// documented in the error= version
+pragma "no doc"
+proc compileSet(patterns: [] string, utf8=true, posix=false, literal=false, /*i*/ ignorecase=false):regexpSet {
+  if CHPL_REGEXP == "none" {
+    compilerError("Regular expression support not compiled in");
+  }
+
+  var error:syserr;
+  var errorIndex = patterns.domain.low - 1;
+  var errorMsg:string;
+  var ret = _compileSet(patterns, error, errorIndex, errorMsg,
+                        utf8, posix, literal, ignorecase);
+  if error {
+    var err_msg = "Error " + errorMsg + " when compiling regexp set";
+    if patterns.domain.member(errorIndex) then
+      err_msg += " pattern '" + patterns[errorIndex] + "'";
+    __primitive("chpl_error", err_msg.c_str());
+  }
+  return ret;
+}
+
 /*
 
    Compile a regular expression and search the receiving string for matches at
@@ -86,6 +86,11 @@ void  chpl_cache_comm_put_strd(
 // For debugging.
 void chpl_cache_print(void);
 
+// Fill in the cache_* counters in the comm diagnostics, or reset them.
+// The counters are only updated while comm diagnostics are enabled.
+void chpl_cache_getCommDiagnostics(chpl_commDiagnostics *cd);
+void chpl_cache_resetCommDiagnostics(void);
+
 #endif
 // ifdef HAS_CHPL_CACHE_FNS
 
@@ -339,6 +339,15 @@ void chpl_comm_execute_on_nb(c_nodeid_t node, c_sublocid_t subloc,
 void chpl_comm_execute_on_fast(c_nodeid_t node, c_sublocid_t subloc,
                          chpl_fn_int_t fid, void *arg, size_t arg_size);
 
+//
+// batched execute_on: blocking, like chpl_comm_execute_on, but the
+// caller promises that the remote function never waits for another
+// task.  The comm layer may therefore run it back to back with other
+// batched execute_ons to the same node in a single task there.
+//
+void chpl_comm_execute_on_batch(c_nodeid_t node, c_sublocid_t subloc,
+                                chpl_fn_int_t fid, void *arg, size_t arg_size);
+
 
 //
 // This call specifies the number of polling tasks that the
@@ -357,6 +366,18 @@ int chpl_comm_numPollingTasks(void);
 // an atomic variable for other tasks to finish).
 void chpl_comm_make_progress(void);
 
+#ifdef HAS_CHPL_COMM_AGGREGATE_FNS
+//
+// Comm layers that define HAS_CHPL_COMM_AGGREGATE_FNS in their
+// chpl-comm-task-decls.h can hold small PUTs back and send them together.
+// chpl_comm_aggregating says whether they are doing so (it is set at
+// startup), and chpl_comm_aggregate_flush() waits until every PUT this
+// locale has held back has completed.
+//
+extern chpl_bool chpl_comm_aggregating;
+void chpl_comm_aggregate_flush(void);
+#endif
+
 //
 // Comm diagnostics stuff
 //
@@ -371,6 +392,13 @@ typedef struct _chpl_commDiagnostics {
   uint64_t execute_on;
   uint64_t execute_on_fast;
   uint64_t execute_on_nb;
+  uint64_t cache_get_hits;
+  uint64_t cache_get_misses;
+  uint64_t cache_put_hits;
+  uint64_t cache_put_misses;
+  uint64_t cache_evictions;
+  uint64_t cache_prefetch_useful;
+  uint64_t cache_prefetch_wasted;
 } chpl_commDiagnostics;
 
 void chpl_startVerboseComm(void);
@@ -33,4 +33,17 @@ const char* chpl_get_rt_env(const char*, const char*);
 //
 chpl_bool chpl_get_rt_env_bool(const char*, chpl_bool);
 
+//
+// Returns the value of an integral CHPL_RT_* environment variable,
+// with default.
+//
+int64_t chpl_get_rt_env_int(const char*, int64_t);
+
+//
+// Returns the value of a memory size CHPL_RT_* environment variable,
+// with default.  The value may have a k, m, or g suffix (for KiB, MiB,
+// or GiB).
+//
+size_t chpl_get_rt_env_size(const char*, size_t);
+
 #endif
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_mem_arena_h_
+#define _chpl_mem_arena_h_
+
+#include <stddef.h>
+#include <stdint.h>
+
+//
+// Per-task bump arena.  When enabled (CHPL_RT_TASK_ARENA), short-lived
+// allocations that are always freed by the task that made them come
+// from a chunk hung off the task's private data instead of from the
+// heap.  Frees of the most recent allocation pop the bump pointer, the
+// arena is rewound once nothing in it is live, and whatever is left is
+// released in bulk when the task ends.  See chpl_mem_taskAlloc() and
+// chpl_mem_taskFree() in chpl-mem.h.
+//
+typedef struct chpl_mem_taskArenaChunk_s {
+  struct chpl_mem_taskArenaChunk_s* prev;  // older chunk, if any
+  size_t size;                             // bytes, including this header
+} chpl_mem_taskArenaChunk_t;
+
+typedef struct {
+  char* top;                               // next free byte in chunk
+  char* limit;                             // end of chunk
+  chpl_mem_taskArenaChunk_t* chunk;        // current (newest) chunk
+  size_t live;                             // allocated but not yet freed
+  uint64_t nAllocs;                        // served from the arena
+  uint64_t nHeap;                          // too big, sent to the heap
+  uint64_t nChunks;                        // chunks allocated
+} chpl_mem_taskArena_t;
+
+#endif
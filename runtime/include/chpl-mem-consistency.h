@@ -63,6 +63,9 @@ void chpl_rmem_consist_release(int ln, int32_t fn)
 #ifdef HAS_CHPL_CACHE_FNS
   chpl_cache_release(ln, fn);
 #endif
+#ifdef HAS_CHPL_COMM_AGGREGATE_FNS
+  if (chpl_comm_aggregating) chpl_comm_aggregate_flush();
+#endif
 }
 
 static inline
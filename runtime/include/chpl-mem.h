@@ -125,6 +125,92 @@ void chpl_mem_free(void* memAlloc, int32_t lineno, int32_t filename) {
   chpl_free(memAlloc);
 }
 
+//
+// Task-scoped allocation.  The memory returned by chpl_mem_taskAlloc()
+// must be freed with chpl_mem_taskFree(), by the same task, before it
+// ends.  When the task arena is off these are exactly chpl_mem_alloc()
+// and chpl_mem_free().  When it is on, requests are bumped off a chunk
+// in the task's private data (see chpl-mem-arena.h) and each one is
+// preceded by a small header recording its size and origin.  The memory
+// hooks still see each request, so memory tracking works either way.
+//
+typedef struct {
+  size_t size;        // bytes, including this header
+  size_t fromHeap;    // nonzero: too big for the arena
+} chpl_mem_taskArenaHdr_t;
+
+extern chpl_bool chpl_mem_taskArenaOn;
+
+void chpl_mem_taskArenaInit(void);
+void* chpl_mem_taskAllocSlow(chpl_mem_taskArena_t* a,
+                             size_t size, size_t need,
+                             chpl_mem_descInt_t description,
+                             int32_t lineno, int32_t filename);
+void chpl_mem_taskArenaTrim(chpl_mem_taskArena_t* a);
+void chpl_mem_taskArenaRelease(chpl_mem_taskArena_t* a);
+void chpl_mem_taskArenaStats(uint64_t* nAllocs, uint64_t* nHeap,
+                             uint64_t* nChunks, uint64_t* nReleased);
+
+static inline
+void* chpl_mem_taskAlloc(size_t size, chpl_mem_descInt_t description,
+                         int32_t lineno, int32_t filename) {
+  chpl_mem_taskArena_t* a;
+  chpl_mem_taskArenaHdr_t* h;
+  size_t need;
+
+  if (!chpl_mem_taskArenaOn)
+    return chpl_mem_alloc(size, description, lineno, filename);
+
+  a = &chpl_task_getPrvData()->mem_arena;
+  need = sizeof(*h) + ((size + sizeof(*h) - 1) & ~(sizeof(*h) - 1));
+  if (need > (size_t) (a->limit - a->top))
+    return chpl_mem_taskAllocSlow(a, size, need, description,
+                                  lineno, filename);
+
+  chpl_memhook_malloc_pre(1, size, description, lineno, filename);
+  h = (chpl_mem_taskArenaHdr_t*) a->top;
+  h->size = need;
+  h->fromHeap = 0;
+  a->top += need;
+  a->live++;
+  a->nAllocs++;
+  chpl_memhook_malloc_post(h + 1, 1, size, description, lineno, filename);
+  return h + 1;
+}
+
+static inline
+void chpl_mem_taskFree(void* memAlloc, int32_t lineno, int32_t filename) {
+  chpl_mem_taskArena_t* a;
+  chpl_mem_taskArenaHdr_t* h;
+
+  if (!chpl_mem_taskArenaOn) {
+    chpl_mem_free(memAlloc, lineno, filename);
+    return;
+  }
+
+  if (memAlloc == NULL)
+    return;
+
+  h = (chpl_mem_taskArenaHdr_t*) memAlloc - 1;
+  if (h->fromHeap) {
+    chpl_mem_free(h, lineno, filename);
+    return;
+  }
+
+  chpl_memhook_free_pre(memAlloc, lineno, filename);
+  a = &chpl_task_getPrvData()->mem_arena;
+  assert(a->live > 0);
+  if (--a->live == 0) {
+    // Nothing live: rewind to the start of the newest chunk.
+    if (a->chunk->prev != NULL)
+      chpl_mem_taskArenaTrim(a);
+    a->top = (char*) (a->chunk + 1);
+  } else if ((char*) h + h->size == a->top) {
+    // Freeing the most recent allocation: pop it.
+    a->top = (char*) h;
+  }
+}
+
 // Provide a handle to instrument Chapel calls to memcpy.
 static inline
 void* chpl_memcpy(void* dest, const void* src, size_t num)
@@ -171,6 +257,11 @@ void* chpl_mem_layerAlloc(size_t, int32_t lineno, int32_t filename);
 void* chpl_mem_layerRealloc(void*, size_t, int32_t lineno, int32_t filename);
 void chpl_mem_layerFree(void*, int32_t lineno, int32_t filename);
 
+// Called by a tasking layer that has sublocales when a task starts,
+// so the memory layer can serve the thread running it from memory
+// local to that sublocale.
+void chpl_mem_layerSetSubloc(c_sublocid_t subloc);
+
 #else // LAUNCHER
 
 #include <stdlib.h>
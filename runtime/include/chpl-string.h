@@ -24,10 +24,9 @@
 
 typedef const char* chpl_string;
 
-#ifdef _stdchpl_H_
-/*** only needed for generated code ***/
-chpl_string defaultStringValue="";
-#endif
+// used by generated code; defined in chpl-string.c so that separately
+// compiled modules (chpl --incremental) share one definition
+extern chpl_string defaultStringValue;
 
 struct chpl_chpl____wide_chpl_string_s;
 
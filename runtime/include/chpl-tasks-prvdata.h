@@ -23,10 +23,14 @@
 // This header file provides chpl_comm_taskPrvData_t
 #include "chpl-comm-task-decls.h"
 
+// This header file provides chpl_mem_taskArena_t
+#include "chpl-mem-arena.h"
+
 // The type for task private data
 typedef struct {
   chpl_bool serial_state;      // true: serialize execution
   chpl_comm_taskPrvData_t comm_data;
+  chpl_mem_taskArena_t mem_arena;  // see chpl_mem_taskAlloc()
 } chpl_task_prvData_t;
 
 #endif
@@ -27,6 +27,9 @@ typedef void* chpl_comm_nb_handle_t;
 #include "chpl-cache-task-decls.h"
 #define HAS_CHPL_CACHE_FNS
 
+// This comm layer can aggregate small PUTs and GETs.
+#define HAS_CHPL_COMM_AGGREGATE_FNS
+
 typedef struct {
     chpl_cache_taskPrvData_t cache_data;
 } chpl_comm_taskPrvData_t;
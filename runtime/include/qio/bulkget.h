@@ -25,6 +25,7 @@
 #include <inttypes.h>
 #include "qbuffer.h"
 #include "qio_style.h"
+#include "qio.h"
 
 // Clients of this routine must call qbytes_release() if the returned value
 // is not retained.
@@ -35,6 +36,19 @@ qbytes_t* bulk_get_bytes(int64_t src_locale, qbytes_t* src_addr);
 qioerr bulk_put_buffer(int64_t dst_locale, void* dst_addr, int64_t dst_len,
                       qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end);
 
+// Read up to dst_len bytes from the channel into dst_addr on dst_locale,
+// PUTting straight out of the channel's buffer so the data is not staged
+// in a temporary on the channel's locale.  Stores the number of bytes
+// moved in *amt_read; returns EEOF if the channel ran out before dst_len
+// bytes were read.  The channel lock must already be held.
+qioerr bulk_put_channel(int64_t dst_locale, void* dst_addr, int64_t dst_len,
+                        qio_channel_t* ch, int64_t* amt_read);
+
+// Write src_len bytes from src_addr on src_locale to the channel,
+// GETting them straight into the channel's buffer.  Returns EEOF if the
+// channel's region ends first.  The channel lock must already be held.
+qioerr bulk_get_channel(qio_channel_t* ch,
+                        int64_t src_locale, void* src_addr, int64_t src_len);
 
 #endif
 
@@ -158,6 +158,13 @@ void _qbytes_init_generic(qbytes_t* ret, void* give_data, int64_t len, qbytes_fr
 qioerr qbytes_create_generic(qbytes_t** out, void* give_data, int64_t len, qbytes_free_t free_function);
 qioerr _qbytes_init_iobuf(qbytes_t* ret);
 qioerr qbytes_create_iobuf(qbytes_t** out);
+
+// Counts for the pool that freed iobufs go back to: how many iobufs
+// were requested, how many of those were reused from the pool, and
+// how many bytes the pool is holding.  Set CHPL_RT_QIO_IOBUF_POOL to
+// the most bytes the shared part of the pool may hold (default 16M),
+// or to 0 to free iobufs right away.
+void qio_iobuf_pool_stats(uint64_t* allocs, uint64_t* hits, uint64_t* held_bytes);
 qioerr _qbytes_init_calloc(qbytes_t* ret, int64_t len);
 
 // The caller is responsible for calling qbytes_release on the return value.
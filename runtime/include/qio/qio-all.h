@@ -27,6 +27,8 @@
 #include "qio_regexp.h"
 #include "qio_style.h"
 #include "bulkget.h"
+#include "qio_array.h"
+#include "qio_compress.h"
 #include "sys.h"
 #include "qio_plugin_hdfs.h"
 #include "qio_plugin_curl.h"
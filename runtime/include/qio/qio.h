@@ -317,6 +317,8 @@ char* qio_chtype_to_string(qio_chtype_t type);
      -- noreuse -- pread/pwrite
      -- cached -- mmap for reads and writes
      -- force_readwrite
+     -- async (only if requested) -- preadv/pwritev that yield
+        the task instead of blocking the thread; see qio_async.h
  */
 
 #define QIO_HINT_AFTERCHTYPE 0x0010
@@ -327,13 +329,13 @@ typedef enum {
   QIO_METHOD_FREADFWRITE = 3*QIO_HINT_AFTERCHTYPE,
   QIO_METHOD_MMAP = 4*QIO_HINT_AFTERCHTYPE,
   QIO_METHOD_MEMORY = 5*QIO_HINT_AFTERCHTYPE,
-  //QIO_METHOD_LIBEVENT,
+  QIO_METHOD_ASYNC = 6*QIO_HINT_AFTERCHTYPE,
 } qio_method_t;
 #define QIO_METHODMASK 0x00f0
 #define QIO_HINT_AFTERMETHOD 0x0100
 #define QIO_METHOD_DEFAULT 0
 #define QIO_MIN_METHOD QIO_METHOD_READWRITE
-#define QIO_MAX_METHOD QIO_METHOD_MEMORY
+#define QIO_MAX_METHOD QIO_METHOD_ASYNC
 
 enum {
   QIO_HINT_RANDOM       = QIO_HINT_AFTERMETHOD,
@@ -371,6 +373,18 @@ enum {
 };
 
 
+// Pipelining depth for buffered channels using QIO_METHOD_PREADPWRITE
+// or QIO_METHOD_ASYNC. When nonzero, a reading channel keeps up to
+// this many iobufs of read-ahead in flight and a writing channel lets
+// up to this many iobufs drain in the background. 0 (the default)
+// means reads and writes are done synchronously. A depth given for
+// a channel replaces the one given for its file.
+#define QIO_HINT_PIPELINE_SHIFT 20
+#define QIO_HINT_PIPELINE_MASK (0xf << QIO_HINT_PIPELINE_SHIFT)
+#define QIO_HINT_PIPELINE(depth) \
+  ((qio_hint_t) (((depth) & 0xf) << QIO_HINT_PIPELINE_SHIFT))
+#define QIO_MAX_PIPELINE_DEPTH 15
+
 #define QIO_NUM_HINT_BITS 8
 #define QIO_HINTMASK 0xffff00
 
@@ -428,6 +442,9 @@ char* qio_hints_to_string(qio_hint_t hint)
       case QIO_METHOD_MEMORY:
         strcat(buf, " memory"); ok = 1;
         break;
+      case QIO_METHOD_ASYNC:
+        strcat(buf, " async"); ok = 1;
+        break;
       // no default to get warned if any are added.
     }
   }
@@ -444,6 +461,10 @@ char* qio_hints_to_string(qio_hint_t hint)
   if( hint & QIO_HINT_NOREUSE ) strcat(buf, " noreuse");
   if( hint & QIO_HINT_NOFAST ) strcat(buf, " nofast");
   if( hint & QIO_HINT_OWNED ) strcat(buf, " owned");
+  if( hint & QIO_HINT_PIPELINE_MASK ) {
+    sprintf(buf + strlen(buf), " pipeline=%i",
+            (int) ((hint & QIO_HINT_PIPELINE_MASK) >> QIO_HINT_PIPELINE_SHIFT));
+  }
 
   return qio_strdup(buf);
 }
@@ -616,6 +637,19 @@ void qio_file_get_style(qio_file_t* f, qio_style_t* style)
 // Calls fflush on a FILE* first.
 qioerr qio_file_length(qio_file_t* f, int64_t *len_out);
 
+// Map len bytes of the file starting at offset (which need not be
+// page-aligned) into memory, for use as an array's element buffer.
+// The memory is always writeable. With writeback, stores reach the file
+// and the file is extended if needed; otherwise the file must already
+// cover the region and stores stay private to this process.  hints
+// (or the file's hints, if 0) choose the madvise advice.  *data_out is
+// the address of byte offset; *region_out owns the mapping and must be
+// passed to qio_file_unmap_region when the memory is no longer used.
+qioerr qio_file_map_region(qio_file_t* f, int64_t offset, int64_t len,
+                           int writeback, qio_hint_t hints,
+                           void** region_out, void** data_out);
+void qio_file_unmap_region(void* region);
+
 /* CHANNELS ..... */
 
 /* A Read and Write Buffered channels support:
@@ -806,6 +840,10 @@ typedef struct qio_channel_s {
   int64_t mark_space[MARK_INITIAL_STACK_SZ];
 
   qio_style_t style;
+
+  // Requests in flight when QIO_HINT_PIPELINE is used;
+  // allocated on first use.
+  struct qio_pipeline_s* pipe;
 } qio_channel_t;
 
 
@@ -1293,6 +1331,14 @@ int64_t qio_channel_end_offset_unlocked(qio_channel_t* ch)
 
 qioerr qio_channel_end_offset(const int threadsafe, qio_channel_t* ch, int64_t* offset_out);
 
+/*
+ * Returns the total time, in nanoseconds, that this channel has spent
+ * waiting for pipelined read-ahead or write-behind requests to finish
+ * (see QIO_HINT_PIPELINE). A channel that is not pipelined, or whose
+ * requests always finished in time, returns 0.
+ */
+int64_t qio_channel_stall_time_unlocked(qio_channel_t* ch);
+
 
 qioerr qio_channel_advance(const int threadsafe, qio_channel_t* ch, int64_t nbytes);
 
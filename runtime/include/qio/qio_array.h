@@ -0,0 +1,117 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _QIO_ARRAY_H_
+#define _QIO_ARRAY_H_
+
+#include "sys_basic.h"
+#include "qio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A self-describing binary format for rectangular arrays.
+ *
+ * A header describes the element type and the shape of the array, and
+ * the elements follow it densely in row-major order, in the byte order
+ * of the machine that wrote them.  The header is a multiple of 64 bytes
+ * long so that the elements stay aligned.  All header fields are
+ * little-endian:
+ *
+ *   0   magic "CHPLARR\0"
+ *   8   uint32 version (1)
+ *   12  uint32 flags (QIO_ARRAY_BIG_ENDIAN if the elements are big-endian)
+ *   16  uint32 element kind (qio_array_kind_t)
+ *   20  uint32 element size in bytes
+ *   24  uint32 rank
+ *   28  uint32 compression (only QIO_ARRAY_COMPRESS_NONE for now)
+ *   32  int64  number of bytes of element data
+ *   40  int64 low, int64 size for each dimension
+ *
+ * Because the header's size depends only on the rank, a writer can
+ * compute where each element will go and write blocks of the array in
+ * parallel.
+ */
+
+#define QIO_ARRAY_MAX_RANK 8
+#define QIO_ARRAY_VERSION 1
+#define QIO_ARRAY_BIG_ENDIAN 1
+
+typedef enum {
+  QIO_ARRAY_KIND_INT = 1,
+  QIO_ARRAY_KIND_UINT,
+  QIO_ARRAY_KIND_REAL,
+  QIO_ARRAY_KIND_IMAG,
+  QIO_ARRAY_KIND_COMPLEX,
+} qio_array_kind_t;
+
+enum {
+  QIO_ARRAY_COMPRESS_NONE = 0,
+};
+
+typedef struct qio_array_header_s {
+  uint32_t kind;
+  uint32_t elt_size;
+  uint32_t rank;
+  uint32_t compression;
+  int64_t data_len;
+  // Set when reading if the elements are in the other byte order.
+  uint8_t swapped;
+  int64_t low[QIO_ARRAY_MAX_RANK];
+  int64_t size[QIO_ARRAY_MAX_RANK];
+} qio_array_header_t;
+
+// Fill in a header for an array of the given element type and rank,
+// with all dimensions empty.
+void qio_array_header_init(qio_array_header_t* hdr, qio_array_kind_t kind, int64_t elt_size, int64_t rank);
+
+// Dimensions are numbered from 0.
+static inline
+void qio_array_header_set_dim(qio_array_header_t* hdr, int64_t d, int64_t low, int64_t size)
+{
+  hdr->low[d] = low;
+  hdr->size[d] = size;
+}
+
+static inline
+void qio_array_header_get_dim(const qio_array_header_t* hdr, int64_t d, int64_t* low, int64_t* size)
+{
+  *low = hdr->low[d];
+  *size = hdr->size[d];
+}
+
+// The number of bytes in the header for an array of this rank.
+int64_t qio_array_header_len(int64_t rank);
+
+// Write the header, computing data_len from the shape.
+qioerr qio_array_header_write(const int threadsafe, qio_channel_t* ch, qio_array_header_t* hdr);
+
+// Read and check a header.  Returns EFORMAT if the channel does not hold
+// an array header this version can read.
+qioerr qio_array_header_read(const int threadsafe, qio_channel_t* ch, qio_array_header_t* hdr);
+
+// Reverse the byte order of nparts values of part_size bytes each.
+void qio_array_bswap(void* data, int64_t nparts, int64_t part_size);
+
+#ifdef __cplusplus
+} // end extern "C"
+#endif
+
+#endif
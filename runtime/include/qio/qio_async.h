@@ -0,0 +1,91 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _QIO_ASYNC_H_
+#define _QIO_ASYNC_H_
+
+#include "sys_basic.h"
+#include "sys.h"
+
+#include <sys/uio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Asynchronous positional I/O, used by QIO_METHOD_ASYNC.
+ *
+ * These behave like sys_preadv and sys_pwritev (including returning
+ * EEOF when a read gets no data), but the calling thread does not
+ * block in the kernel while the request is outstanding.  Instead the
+ * request is handed off and the calling task yields until it completes,
+ * so the thread can run other tasks in the meantime.
+ *
+ * On Linux the requests are submitted through io_uring.  If io_uring is
+ * not available (old kernel, seccomp, or CHPL_RT_QIO_ASYNC_URING=false)
+ * they are handed to a small pool of helper threads that do ordinary
+ * preadv/pwritev calls.  CHPL_RT_QIO_ASYNC_THREADS sets the size of
+ * that pool (default 4).
+ */
+err_t qio_async_preadv(fd_t fd, const struct iovec* iov, int iovcnt, off_t seek_to_offset, ssize_t* num_read_out);
+err_t qio_async_pwritev(fd_t fd, const struct iovec* iov, int iovcnt, off_t seek_to_offset, ssize_t* num_written_out);
+
+// Returns 1 if async requests go through io_uring, 0 if they go
+// through the helper thread pool.
+int qio_async_uses_uring(void);
+
+/* Lower-level interface, for callers that keep several requests in
+ * flight at once.  A request must stay where it is, along with its
+ * iovecs, from qio_async_start() until qio_async_test() has returned
+ * nonzero for it or qio_async_wait() has returned.  Each request does
+ * one preadv or pwritev (so iovcnt must be at most IOV_MAX), which
+ * may transfer less than was asked for.
+ */
+typedef enum {
+  QIO_ASYNC_READ,
+  QIO_ASYNC_WRITE,
+} qio_async_kind_t;
+
+typedef struct qio_async_req_s {
+  struct qio_async_req_s* next; // helper thread queue link
+  qio_async_kind_t kind;
+  fd_t fd;
+  const struct iovec* iov;
+  int iovcnt;
+  off_t offset;
+  ssize_t result;               // bytes transferred, or -errno
+  int done;                     // set once result is valid
+} qio_async_req_t;
+
+void qio_async_start(qio_async_req_t* req, qio_async_kind_t kind, fd_t fd,
+                     const struct iovec* iov, int iovcnt, off_t offset);
+
+// Returns nonzero if the request has finished.  Never blocks.
+int qio_async_test(qio_async_req_t* req);
+
+// Yields until the request finishes.  Returns 0 or an errno, and
+// stores the number of bytes transferred in *num_out.  Unlike
+// qio_async_preadv, a read at end-of-file is not an error here.
+err_t qio_async_wait(qio_async_req_t* req, ssize_t* num_out);
+
+#ifdef __cplusplus
+} // end extern "C"
+#endif
+
+#endif
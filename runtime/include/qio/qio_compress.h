@@ -0,0 +1,101 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _QIO_COMPRESS_H_
+#define _QIO_COMPRESS_H_
+
+#include "sys_basic.h"
+#include "qio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Compressing and decompressing channels.
+ *
+ * qio_channel_create_compress() stacks a filter on top of an existing
+ * channel.  Data written to the new channel is compressed and written
+ * to the underlying one; data read from the new channel is read from
+ * the underlying one and decompressed.  The filter is a sequential
+ * (non-seekable) qio_file_functions_t file, so it works with any
+ * underlying channel, whatever its I/O method.
+ *
+ * The stream format is the LZ4 frame format, so files can be exchanged
+ * with the lz4 command line tool.  When writing, the data is cut into
+ * independent 1 MiB blocks that are compressed by a pool of helper
+ * threads (CHPL_RT_QIO_COMPRESS_THREADS, default the number of CPUs up
+ * to 8) while the caller keeps writing.  When reading, blocks are read
+ * ahead and handed to the same threads, so decompression overlaps with
+ * the reader's work.  Frames whose blocks depend on earlier blocks are
+ * decompressed in order by the reading task.
+ *
+ * The filter holds a reference to the underlying channel until the
+ * filtered channel is closed.  Closing a compressing channel finishes
+ * the frame; the underlying channel is not closed.
+ */
+
+typedef enum {
+  QIO_COMPRESS_LZ4 = 1,
+} qio_compress_format_t;
+
+qioerr qio_channel_create_compress(qio_channel_t** ch_out,
+                                   qio_channel_t* under,
+                                   qio_compress_format_t format,
+                                   qio_hint_t hints,
+                                   const qio_style_t* style);
+
+// LZ4 block format primitives, exposed for testing.
+
+// The largest compressed size of a block of len bytes.
+static inline
+int64_t qio_lz4_compress_bound(int64_t len)
+{
+  return len + len / 255 + 16;
+}
+
+// Compresses src into dst, which has room for cap bytes.  Returns the
+// compressed length, or 0 if it did not fit.
+int64_t qio_lz4_compress_block(const unsigned char* src, int64_t len,
+                               unsigned char* dst, int64_t cap);
+
+// Decompresses src into dst, which has room for cap bytes.  Matches may
+// refer to up to prefix_len bytes of earlier output stored just before
+// dst.  Returns the decompressed length, or -1 if src is malformed.
+int64_t qio_lz4_decompress_block(const unsigned char* src, int64_t len,
+                                 unsigned char* dst, int64_t cap,
+                                 int64_t prefix_len);
+
+// The xxHash32 checksum used by the LZ4 frame format.
+typedef struct {
+  uint32_t v[4];
+  uint64_t total_len;
+  unsigned char mem[16];
+  uint32_t memsize;
+} qio_xxh32_state_t;
+
+void qio_xxh32_init(qio_xxh32_state_t* st, uint32_t seed);
+void qio_xxh32_update(qio_xxh32_state_t* st, const void* data, size_t len);
+uint32_t qio_xxh32_digest(const qio_xxh32_state_t* st);
+uint32_t qio_xxh32(const void* data, size_t len, uint32_t seed);
+
+#ifdef __cplusplus
+} // end extern "C"
+#endif
+
+#endif
@@ -843,5 +843,13 @@ qioerr qio_format_error_arg_mismatch(int64_t arg);
 qioerr qio_format_error_bad_regexp(void);
 qioerr qio_format_error_write_regexp(void);
 
+// Splits the bytes start..end-1 of a file into nchunks pieces of
+// roughly equal size that each begin at the start of a record.
+// A record ends with the separator byte (or at end). Stores
+// nchunks+1 offsets in bounds_out; chunk i is bounds_out[i] up to
+// bounds_out[i+1], which is empty when a record spans a whole chunk.
+// end is limited to the file's length.
+qioerr qio_file_record_boundaries(qio_file_t* f, uint8_t separator, int64_t start, int64_t end, int64_t nchunks, int64_t* bounds_out);
+
 #endif
 
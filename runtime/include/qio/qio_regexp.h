@@ -137,4 +137,43 @@ int64_t qio_regexp_replace(qio_regexp_t* regexp, const char* repl, int64_t repl_
 //
 qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe, struct qio_channel_s* ch, int64_t maxlen, int anchor, qio_bool can_discard, qio_bool keep_unmatched, qio_bool keep_whole_pattern, qio_regexp_string_piece_t* submatch, int64_t nsubmatch);
 
+// A set of regular expressions that are matched against text together,
+// in one pass, reporting which of them matched.  Patterns are added
+// (and numbered from 0 in the order they are added) and then the set
+// is compiled.  A set is reference counted like a regexp.
+typedef struct qio_regexp_set_s {
+  void* set;
+} qio_regexp_set_t;
+
+static inline
+qio_regexp_set_t qio_regexp_set_null(void)
+{
+  qio_regexp_set_t ret;
+  ret.set = NULL;
+  return ret;
+}
+
+void qio_regexp_set_create(const qio_regexp_options_t* options, qio_regexp_set_t* set);
+// Returns the index of the added pattern, or -1 if it could not be
+// parsed, in which case *error_out is a message that must be freed
+// by the caller.
+int64_t qio_regexp_set_add(qio_regexp_set_t* set, const char* str, int64_t str_len, const char** error_out);
+// Returns false if the set could not be compiled (it is too large).
+qio_bool qio_regexp_set_compile(qio_regexp_set_t* set);
+void qio_regexp_set_retain(const qio_regexp_set_t* set);
+void qio_regexp_set_release(qio_regexp_set_t* set);
+int64_t qio_regexp_set_size(const qio_regexp_set_t* set);
+
+// Returns how many patterns in the set match somewhere in the text, and
+// stores the indices of the first nmatched of them, in increasing order,
+// in matched.
+int64_t qio_regexp_set_match(const qio_regexp_set_t* set, const char* str, int64_t str_len, int64_t* matched, int64_t nmatched);
+
+// Reads lines from the channel, starting at its current position, until
+// one is matched by some pattern in the set.  Returns that line (not
+// counting its newline) in *line and the matching patterns as for
+// qio_regexp_set_match, with the count in *nfound.  The channel is left
+// just past that line.  Returns EEOF if no remaining line matched.
+qioerr qio_regexp_set_channel_match(const qio_regexp_set_t* set, const int threadsafe, struct qio_channel_s* ch, qio_regexp_string_piece_t* line, int64_t* matched, int64_t nmatched, int64_t* nfound);
+
 #endif
@@ -178,6 +178,8 @@ typedef struct qio_style_s {
 
   // realfmt does not apply to integers.
   uint8_t realfmt; //0 -> print with %g; 1 -> print with %f; 2 -> print with %e
+                   //3 -> like %g, but with the fewest significant digits
+                   //     that read back as the same value
 
   // Other data type choices
   //
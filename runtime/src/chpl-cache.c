@@ -151,20 +151,23 @@ you get a full barrier ).
 == Implementation Notes ==
 
 The cache itself is a 2Q cache (because this kind of cache is reported to have
-better efficiency than a plain LRU). Besides being in a queue of one sort or
-another, entries are also stored in a 'pointer tree' which is a two-level
-'hashtable' where the hash function just selects different portions of the
-remote address. The pointer tree uses separate chaining (ie, each hash table
-element is actually a linked list of elements that go into that bucket).
+better efficiency than a plain LRU), or optionally an ARC cache (selected with
+CHPL_RT_CACHE_POLICY=arc) that reuses the 2Q queues but adapts the balance
+between recently and frequently used pages as the program runs. Besides being
+in a queue of one sort or another, entries are also stored in a 'pointer tree'
+which is a two-level 'hashtable' where the hash function just selects different
+portions of the remote address. The pointer tree uses separate chaining (ie,
+each hash table element is actually a linked list of elements that go into that
+bucket).
 
 The cache consists of 'cache entries', one per 'cache page'. A 'cache page' is
-1024 bytes in the current implementation. The pointer tree and the 2Q queues
-consist of cache entries which may point to a 1024-byte cache page. However, a
-GET is always rounded up to entire 'cache line'. A cache line is currently 64
-bytes. Each cache entry tracks which cache lines are valid (ie, for which cache
-lines in the cache page have we done a GET?) and for pages that have been
-written to in a PUT - aka 'dirty pages' - which bytes in the page have been
-written to.
+1024 bytes by default (CHPL_RT_CACHE_PAGE_SIZE can change it). The pointer
+tree and the 2Q queues consist of cache entries which may point to a cache
+page. However, a GET is always rounded up to entire 'cache line'. A cache line
+is currently 64 bytes. Each cache entry tracks which cache lines are valid (ie,
+for which cache lines in the cache page have we done a GET?) and for pages that
+have been written to in a PUT - aka 'dirty pages' - which bytes in the page
+have been written to.
 
 There is a tradeoff in the cache line size and in the cache page size:
   - smaller cache lines might mean lower latency gets
@@ -277,6 +280,7 @@ use.
 #include "chpl-tasks.h"
 #include "chpl-mem.h"
 #include "chpl-atomics.h"
+#include "chpl-env.h"
 #include "chpl-thread-local-storage.h" // CHPL_TLS_DECL etc
 #include "chpl-cache.h"
 #include "chpl-linefile-support.h"
@@ -295,9 +299,23 @@ use.
 // We try to auto-size the cache so that we
 // can have CACHE_PAGES_PER_NODE cache pages per locale, but we
 // do so within the below bounds.
+//
+// CHPL_RT_CACHE_SIZE replaces the auto-sizing with a fixed
+// per-thread cache data size; CHPL_RT_CACHE_PAGES_PER_NODE adjusts
+// the auto-sizing instead. Either way, we always keep at least
+// MIN_CACHE_PAGES pages.
 #define CACHE_PAGES_PER_NODE 4
 #define MIN_CACHE_DATA_SIZE (1024*1024)
 #define MAX_CACHE_DATA_SIZE (256*1024*1024)
+#define MIN_CACHE_PAGES 64
+static size_t cache_data_size = 0; // 0 means auto-size
+static int cache_pages_per_node = CACHE_PAGES_PER_NODE;
+
+// Which replacement policy should the cache use?
+// This is set at startup from CHPL_RT_CACHE_POLICY.
+#define CACHE_POLICY_2Q 0
+#define CACHE_POLICY_ARC 1
+static int cache_policy = CACHE_POLICY_2Q;
 
 // How many pending operations can we have at once?
 #define MAX_PENDING 32
@@ -309,10 +327,17 @@ use.
 // Reasonable values for CACHEPAGE_BITS are between 6 and 12
 // (64 bytes and 4k bytes. CACHEPAGE_BITS should not be larger than the
 // page size) and it must currently be even.
-// Here we set it to 1k bytes (ie 2^10).
-#define CACHEPAGE_BITS 10
+// By default we set it to 1k bytes (ie 2^10), but CHPL_RT_CACHE_PAGE_SIZE
+// can choose another size at startup. Anything sized at compile time
+// according to the page size uses MAX_CACHEPAGE_BITS.
+#define MIN_CACHEPAGE_BITS 6
+#define MAX_CACHEPAGE_BITS 12
+#define DEFAULT_CACHEPAGE_BITS 10
+static int cachepage_bits = DEFAULT_CACHEPAGE_BITS;
+#define CACHEPAGE_BITS cachepage_bits
 #define CACHEPAGE_SIZE (1 << CACHEPAGE_BITS)
 #define CACHEPAGE_MASK (CACHEPAGE_SIZE-1)
+#define MAX_CACHEPAGE_SIZE (1 << MAX_CACHEPAGE_BITS)
 
 // CACHELINE_BITS 
 // Controls the cache line size - that is, the minimum number of bytes
@@ -341,6 +366,21 @@ typedef int16_t readahead_distance_t;
 #define ENABLE_READAHEAD_TRIGGER_SEQUENTIAL 0
 #define MAX_SEQUENTIAL_READAHEAD_BYTES (MAX_PAGES_PER_PREFETCH*CACHEPAGE_SIZE)
 
+// Should we detect fixed-stride access (e.g. walking down a column of a
+// Block-distributed 2D array) and prefetch where it is going next?
+// The readahead above only helps when access is sequential.
+#define ENABLE_STRIDE_PREFETCH 1
+// How many interleaved strided streams can we follow at once?
+#define STRIDE_STREAMS 4
+// How many recent misses do we remember when looking for a new stream?
+#define STRIDE_HISTORY 8
+// How many strides ahead of the program do we prefetch?
+#define STRIDE_PREFETCH_DEPTH 4
+// Strides of a cache line or less are left to readahead, and very large
+// strides are more likely to be unrelated accesses than a stream.
+#define MIN_STRIDE_BYTES (CACHELINE_SIZE+1)
+#define MAX_STRIDE_BYTES (16*1024*1024)
+
 //#define TIME
 //#define TRACE
 //#define DEBUG
@@ -394,6 +434,24 @@ static long time_duration(const struct timespec* t1, const struct timespec* t2)
 #include "chpl-cache-support.c"
 
 
+// ----------  COMM DIAGNOSTICS COUNTERS
+// These are shared by all of the per-thread caches, so we only
+// update them while comm diagnostics are enabled.
+static atomic_uint_least64_t cache_get_hits;
+static atomic_uint_least64_t cache_get_misses;
+static atomic_uint_least64_t cache_put_hits;
+static atomic_uint_least64_t cache_put_misses;
+static atomic_uint_least64_t cache_evictions;
+static atomic_uint_least64_t cache_prefetch_useful;
+static atomic_uint_least64_t cache_prefetch_wasted;
+
+#define CACHE_DIAGS_INC(counter) \
+  do { \
+    if( chpl_comm_diagnostics ) \
+      atomic_fetch_add_uint_least64_t(&counter, 1); \
+  } while(0)
+
+
 
 
 // Forward Declarations.
@@ -442,6 +500,7 @@ struct rdcache_s;
 // How many uint64_t words do we need to create a bitmask for CACHEPAGE_SIZE?
 // Divide # bytes in cache by 64, rounding up.
 #define CACHEPAGE_BITMASK_WORDS ((CACHEPAGE_SIZE+63)/64)
+#define MAX_CACHEPAGE_BITMASK_WORDS ((MAX_CACHEPAGE_SIZE+63)/64)
 
 // How many cache lines per cache page?
 #define CACHE_LINES_PER_PAGE (CACHEPAGE_SIZE/CACHELINE_SIZE)
@@ -449,6 +508,7 @@ struct rdcache_s;
 // How many uint64_t words do we need to create a bitmask for CACHE_LINES_PER_PAGE
 // ie, a mask recording a bit per cache line?
 #define CACHE_LINES_PER_PAGE_BITMASK_WORDS (((CACHEPAGE_SIZE/CACHELINE_SIZE)+63)/64)
+#define MAX_CACHE_LINES_PER_PAGE_BITMASK_WORDS (((MAX_CACHEPAGE_SIZE/CACHELINE_SIZE)+63)/64)
 
 struct cache_entry_base_s {
   uint32_t index_bits;
@@ -471,13 +531,20 @@ struct dirty_entry_s {
   // which cache entry are we talking about here?
   struct cache_entry_s* entry;
   // Which of the page's bytes are dirty?
-  uint64_t dirty[CACHEPAGE_BITMASK_WORDS]; // ie we need to create a put for these bytes
+  uint64_t dirty[MAX_CACHEPAGE_BITMASK_WORDS]; // ie we need to create a put for these bytes
 };
 
 #define QUEUE_FREE 0
 #define QUEUE_AIN 1
 #define QUEUE_AOUT 2
 #define QUEUE_AM 3
+#define QUEUE_AMOUT 4
+
+// Has prefetched data in a page not been used yet, and who prefetched it?
+// PREFETCHED_OTHER covers readahead and chpl_cache_comm_prefetch.
+#define PREFETCHED_NONE 0
+#define PREFETCHED_OTHER 1
+#define PREFETCHED_STRIDE 2
 
 // Storing a remote address (node number is separate).
 typedef uintptr_t raddr_t;
@@ -496,19 +563,21 @@ raddr_t raddr_min(raddr_t a, raddr_t b)
 struct cache_entry_s {
   struct cache_entry_base_s base; // contains what we hashed to...
   raddr_t raddr; // cached data is for (base.node,raddr), aligned to CACHE_PAGESIZE
-  // Queue information. This entry could be in Ain, Aout, or Am queues.
+  // Queue information. This entry could be in Ain, Aout, Am, or Amout queues.
   int queue;
   // Readahead information.
   readahead_distance_t readahead_skip;
   readahead_distance_t readahead_len; // == 0 if this page doesn't trigger readahead.
-  // These are the queue links. Am is LRU but Ain and Aout are FIFO
-  struct cache_entry_s* next; // next entry in Ain/Aout/Am
-  struct cache_entry_s* prev; // previous entry in An/Aout/Am
+  // PREFETCHED_* - used to count useful and wasted prefetches.
+  int8_t prefetched;
+  // These are the queue links. Am is LRU but Ain, Aout, and Amout are FIFO
+  struct cache_entry_s* next; // next entry in Ain/Aout/Am/Amout
+  struct cache_entry_s* prev; // previous entry in An/Aout/Am/Amout
   // Pointer to the cached data.
   // This refers to CACHEPAGE_SIZE bytes of memory.
   unsigned char* page;
   // Which of the cache lines have we done 'get's for?
-  uint64_t valid_lines[CACHE_LINES_PER_PAGE_BITMASK_WORDS];
+  uint64_t valid_lines[MAX_CACHE_LINES_PER_PAGE_BITMASK_WORDS];
   // dirty info if this cache page is dirty, NULL otherwise.
   struct dirty_entry_s* dirty;
   // What is the mininimum sequence number stored in this cache entry?
@@ -547,7 +616,7 @@ static int set_valid_lines(uint64_t* valid, uintptr_t skip, uintptr_t len)
 // Note skip/len are in line numbers, NOT byte offsets!
 static void unset_valid_lines(uint64_t* valid, uintptr_t skip, uintptr_t len)
 {
-  uint64_t myvalid[CACHE_LINES_PER_PAGE_BITMASK_WORDS];
+  uint64_t myvalid[MAX_CACHE_LINES_PER_PAGE_BITMASK_WORDS];
   unset_valids_for_skip_len(valid, myvalid, skip, len, CACHE_LINES_PER_PAGE_BITMASK_WORDS);  
 }
 /*
@@ -567,11 +636,24 @@ struct top_entry_s {
   struct cache_entry_s* bottom_index[BOTTOM_SIZE];
 };
 
+// A stream of accesses to one node that are a fixed stride apart.
+struct stride_stream_s {
+  c_nodeid_t node;
+  raddr_t last_addr; // most recent access in the stream
+  intptr_t stride; // bytes between accesses, or 0 if the stream is unused
+  raddr_t next_prefetch; // where the next prefetch for this stream goes
+  cache_seqn_t last_use; // so we can replace the least recently used stream
+};
+
 struct rdcache_s {
   // A 2Q cache.
   // See "2Q: A Low Overhead High Performance Buffer Management
   //      Replacement Algorithm"
   //    by Theodore Johnson and Dennis Sasha, Proc 20th VLDB conference, 1994.
+  //
+  // or, with CACHE_POLICY_ARC, an ARC cache.
+  // See "ARC: A Self-Tuning, Low Overhead Replacement Cache"
+  //    by Nimrod Megiddo and Dharmendra S. Modha, FAST 2003.
   
   // The next request number -- there is currently no request or cache
   // element with this sequence number.
@@ -584,6 +666,15 @@ struct rdcache_s {
   c_nodeid_t last_cache_miss_read_node;
   raddr_t last_cache_miss_read_addr;
 
+  // Recent cache miss read addresses (a circular buffer) and the
+  // fixed-stride streams found in them, for stride prefetching.
+  // Since each thread has its own cache, this follows the access
+  // pattern of whatever task is running on the thread.
+  c_nodeid_t stride_history_node[STRIDE_HISTORY];
+  raddr_t stride_history_addr[STRIDE_HISTORY];
+  int stride_history_next;
+  struct stride_stream_s stride_streams[STRIDE_STREAMS];
+
   // The variable names Ain Aout and Am come from the 2Q paper
 
   // Ain is a FIFO queue storing entries initially as they go into
@@ -648,6 +739,23 @@ struct rdcache_s {
   struct cache_entry_s* am_lru_head;
   struct cache_entry_s* am_lru_tail;
 
+  // The remaining queue and fields are only used by the ARC policy, which
+  // maps its lists onto the 2Q queues: T1 is Ain, T2 is Am, B1 is Aout and
+  // B2 is Amout.
+  //
+  // Amout, a FIFO queue of entries fallen off of Am
+  // Like Aout, entries in Amout have no page.
+  unsigned int amout_current; // current length of amout list
+  struct cache_entry_s *amout_head;
+  struct cache_entry_s *amout_tail;
+  // ARC's adaptive target size for Ain, between 0 and max_pages.
+  // Hits in Aout grow it and hits in Amout shrink it.
+  unsigned int arc_target;
+  // The entry most recently used. ARC only moves an entry from Ain
+  // to Am when it is used again after some other entry has been used,
+  // so that many accesses within one page count as a single reference.
+  struct cache_entry_s* last_used;
+
   // List of dirty pages (for write-combining)
   int num_dirty_pages;
   struct dirty_entry_s *dirty_lru_head;
@@ -693,16 +801,27 @@ struct rdcache_s* cache_create(void) {
   unsigned char* buffer;
   unsigned char* pages;
 
-  cache_pages = CACHE_PAGES_PER_NODE * chpl_numNodes;
-  if( cache_pages < MIN_CACHE_DATA_SIZE/CACHEPAGE_SIZE )
-    cache_pages = MIN_CACHE_DATA_SIZE/CACHEPAGE_SIZE;
-  if( cache_pages > MAX_CACHE_DATA_SIZE/CACHEPAGE_SIZE )
-    cache_pages = MAX_CACHE_DATA_SIZE/CACHEPAGE_SIZE;
+  if( cache_data_size > 0 ) {
+    cache_pages = cache_data_size / CACHEPAGE_SIZE;
+  } else {
+    cache_pages = cache_pages_per_node * chpl_numNodes;
+    if( cache_pages < MIN_CACHE_DATA_SIZE/CACHEPAGE_SIZE )
+      cache_pages = MIN_CACHE_DATA_SIZE/CACHEPAGE_SIZE;
+    if( cache_pages > MAX_CACHE_DATA_SIZE/CACHEPAGE_SIZE )
+      cache_pages = MAX_CACHE_DATA_SIZE/CACHEPAGE_SIZE;
+  }
+  if( cache_pages < MIN_CACHE_PAGES )
+    cache_pages = MIN_CACHE_PAGES;
 
   ain_pages = cache_pages / 4; // 2Q: "Kin should be 25% of page slots"
   aout_pages = cache_pages / 2; // 2Q: "Kout should hold identifiers for as
                                 // many pages as would fit in 50% of the
                                 // buffer"
+  if( cache_policy == CACHE_POLICY_ARC ) {
+    // ARC: the ghost lists B1 and B2 together remember as many pages
+    // as fit in the cache.
+    aout_pages = cache_pages;
+  }
   // How many pages can be dirty at once?
   dirty_pages = 16 + cache_pages / 64; 
   // How many mid-level elements can we have in our tree? Note each is 8k in the current config..
@@ -766,6 +885,19 @@ struct rdcache_s* cache_create(void) {
   c->last_cache_miss_read_node = -1;
   c->last_cache_miss_read_addr = 0;
 
+  for( i = 0; i < STRIDE_HISTORY; i++ ) {
+    c->stride_history_node[i] = -1;
+    c->stride_history_addr[i] = 0;
+  }
+  c->stride_history_next = 0;
+  for( i = 0; i < STRIDE_STREAMS; i++ ) {
+    c->stride_streams[i].node = -1;
+    c->stride_streams[i].last_addr = 0;
+    c->stride_streams[i].stride = 0;
+    c->stride_streams[i].next_prefetch = 0;
+    c->stride_streams[i].last_use = 0;
+  }
+
   c->max_pages = cache_pages;
   c->max_entries = n_entries;
   c->max_top_nodes = top_entries;
@@ -810,6 +942,12 @@ struct rdcache_s* cache_create(void) {
   c->am_lru_head = NULL;
   c->am_lru_tail = NULL;
 
+  c->amout_current = 0;
+  c->amout_head = NULL;
+  c->amout_tail = NULL;
+  c->arc_target = 0;
+  c->last_used = NULL;
+
   c->num_dirty_pages = 0;
   c->dirty_lru_head = NULL;
   c->dirty_lru_tail = NULL;
@@ -938,6 +1076,13 @@ void rdcache_print(struct rdcache_s* cache) {
   for( entry = cache->am_lru_head; entry; entry = entry->next ) {
     cache_entry_print(entry, "     am ", 1);
   }
+  if( cache_policy == CACHE_POLICY_ARC ) {
+    printf("  arc_target %i\n", (int) cache->arc_target);
+    printf("  Amout:\n");
+    for( entry = cache->amout_head; entry; entry = entry->next ) {
+      cache_entry_print(entry, "  amout ", 1);
+    }
+  }
 
   fflush(stdout);
 }
@@ -1140,6 +1285,54 @@ void aout_evict(struct rdcache_s* cache)
   SINGLE_PUSH_HEAD(cache, entry, free_entries);
 }
 
+static
+void amout_evict(struct rdcache_s* cache)
+{
+  struct cache_entry_s* z;
+  struct cache_entry_base_s* entry;
+
+  z = cache->amout_tail;
+
+  if( !z ) return;
+
+  // Remove the tail element from Amout
+  DOUBLE_REMOVE_TAIL(cache, amout);
+  cache->amout_current--;
+
+  // Remove entry (which we are kicking off of Amout) from the tree
+  tree_remove(cache, z);
+
+  z->queue = QUEUE_FREE;
+
+  // and store it on the free list.
+  entry = &z->base;
+  SINGLE_PUSH_HEAD(cache, entry, free_entries);
+}
+
+// Retire entries from the ghost queues (Aout and Amout) once they
+// remember more pages than the policy allows.
+static
+void ghost_trim(struct rdcache_s* cache)
+{
+  if( cache_policy == CACHE_POLICY_ARC ) {
+    // ARC: |T1| + |B1| <= c and |T1| + |T2| + |B1| + |B2| <= 2c
+    while( cache->aout_current > 0 &&
+           cache->ain_current + cache->aout_current > cache->max_pages ) {
+      aout_evict(cache);
+    }
+    while( cache->amout_current > 0 &&
+           cache->ain_current + cache->aout_current +
+           cache->am_current + cache->amout_current > 2 * cache->max_pages ) {
+      amout_evict(cache);
+    }
+  } else {
+    if( cache->aout_current > cache->aout_max ) {
+      // Remove the tail element from aout.
+      aout_evict(cache);
+    }
+  }
+}
+
 static
 void ain_evict(struct rdcache_s* cache, struct cache_entry_s* dont_evict_me)
 {
@@ -1155,6 +1348,7 @@ void ain_evict(struct rdcache_s* cache, struct cache_entry_s* dont_evict_me)
     ain_evict(cache, NULL);
     // Put dont_evict_me back on the tail.
     DOUBLE_PUSH_TAIL(cache, dont_evict_me, ain);
+    return;
   }
 
 #ifdef DEBUG
@@ -1177,10 +1371,7 @@ void ain_evict(struct rdcache_s* cache, struct cache_entry_s* dont_evict_me)
   DOUBLE_PUSH_HEAD(cache, y, aout);
   cache->aout_current++;
 
-  if( cache->aout_current > cache->aout_max ) {
-    // Remove the tail element from aout.
-    aout_evict(cache);
-  }
+  ghost_trim(cache);
 }
 
  
@@ -1199,6 +1390,7 @@ void am_evict(struct rdcache_s *cache, struct cache_entry_s* dont_evict_me) {
     am_evict(cache, NULL);
     // Put dont_evict_me back on the tail.
     DOUBLE_PUSH_TAIL(cache, dont_evict_me, am_lru);
+    return;
   }
 
   // If the entry in Am has any pending/dirty requests, we must
@@ -1209,6 +1401,16 @@ void am_evict(struct rdcache_s *cache, struct cache_entry_s* dont_evict_me) {
   DOUBLE_REMOVE_TAIL(cache, am_lru);
   cache->am_current--;
 
+  if( cache_policy == CACHE_POLICY_ARC ) {
+    // ARC remembers pages evicted from T2 in B2, so
+    // add this entry to Amout.
+    y->queue = QUEUE_AMOUT;
+    DOUBLE_PUSH_HEAD(cache, y, amout);
+    cache->amout_current++;
+    ghost_trim(cache);
+    return;
+  }
+
   // Remove this entry in Am from the pointer tree.
   tree_remove(cache, y);
 
@@ -1236,6 +1438,10 @@ struct top_entry_s* top_entry_allocate(struct rdcache_s* tree)
     aout_evict(tree);
     if( tree->free_top_nodes_head ) break; 
 
+    // Evict from Amout (only used by ARC; evicting Am adds to it)
+    amout_evict(tree);
+    if( tree->free_top_nodes_head ) break; 
+
     // Evict from Ain (will add an entry to aout)
     ain_evict(tree, NULL);
     if( tree->free_top_nodes_head ) break; 
@@ -1256,9 +1462,23 @@ struct top_entry_s* top_entry_allocate(struct rdcache_s* tree)
 static
 void reclaim(struct rdcache_s* cache, struct cache_entry_s* dont_evict_me)
 {
+  // 2Q uses a fixed maximum for Ain, but ARC adapts it (and the
+  // Ain/Am balance in ARC is what 'replace' in the ARC paper decides).
+  unsigned int ain_max = ( cache_policy == CACHE_POLICY_ARC ) ?
+                         cache->arc_target : cache->ain_max;
+  int evict_ain = ( cache->ain_current > ain_max );
+
+  // Don't pick a queue that has nothing we can evict.
+  if( ! cache->am_lru_tail ||
+      ( cache->am_current == 1 && cache->am_lru_tail == dont_evict_me ) )
+    evict_ain = 1;
+  if( ! cache->ain_tail ||
+      ( cache->ain_current == 1 && cache->ain_tail == dont_evict_me ) )
+    evict_ain = 0;
+
   // This is like 'reclaimfor' in the 2Q paper
   // if the number of elements in Ain > max
-  if( cache->ain_current > cache->ain_max ) {
+  if( evict_ain ) {
     // Page out the tail of Ain (and record it in Aout)
     // ain_evict will also evict from aout if necessary.
     ain_evict(cache, dont_evict_me);
@@ -1279,7 +1499,16 @@ struct cache_entry_s* allocate_entry(struct rdcache_s* cache)
   //       cache->ain_current, cache->aout_current, cache->am_current);
 
   // Make sure we have a free entry..
-  if( ! cache->free_entries_head ) reclaim(cache, NULL);
+  if( ! cache->free_entries_head ) {
+    if( cache_policy == CACHE_POLICY_ARC ) {
+      // At most max_pages entries have pages, so there must be
+      // a ghost entry that we can retire.
+      if( cache->amout_current > 0 ) amout_evict(cache);
+      else aout_evict(cache);
+    } else {
+      reclaim(cache, NULL);
+    }
+  }
 
   ret = (struct cache_entry_s*) cache->free_entries_head;
 
@@ -1514,11 +1743,12 @@ void validate_cache(struct rdcache_s* tree)
   int in_ain;
   int in_aout;
   int in_am;
+  int in_amout;
   int num_used_pages = 0;
   int num_used_top_nodes = 0;
   int num_dirty = 0;
 
-  // 0: All tree entries must be in either Ain, Aout, or Am,
+  // 0: All tree entries must be in either Ain, Aout, Am, or Amout,
   //    and num_entries is correct for each top entry.
   for(top = 0; top < TOP_SIZE; top++) {
     top_cur = tree->top_index_list[top];
@@ -1532,10 +1762,12 @@ void validate_cache(struct rdcache_s* tree)
           in_ain = find_in_queue(tree->ain_head, bottom_cur);
           in_aout = find_in_queue(tree->aout_head, bottom_cur);
           in_am = find_in_queue(tree->am_lru_head, bottom_cur);
-          assert( in_ain || in_aout || in_am );
+          in_amout = find_in_queue(tree->amout_head, bottom_cur);
+          assert( in_ain || in_aout || in_am || in_amout );
           if( in_ain ) assert( bottom_cur->queue == QUEUE_AIN );
           if( in_aout ) assert( bottom_cur->queue == QUEUE_AOUT );
           if( in_am ) assert( bottom_cur->queue == QUEUE_AM );
+          if( in_amout ) assert( bottom_cur->queue == QUEUE_AMOUT );
           if( bottom_cur->page ) num_used_pages++;
           if( bottom_cur->dirty ) num_dirty++;
           bottom_cur = (struct cache_entry_s*)bottom_cur->base.next;
@@ -1557,6 +1789,15 @@ void validate_cache(struct rdcache_s* tree)
   // 3: Entries in Am must be in the tree
   in_am = validate_queue(tree, tree->am_lru_head, tree->am_lru_tail, QUEUE_AM);
   assert( in_am == tree->am_current );
+  // 3a: Entries in Amout must be in the tree
+  in_amout = validate_queue(tree, tree->amout_head, tree->amout_tail, QUEUE_AMOUT);
+  assert( in_amout == tree->amout_current );
+  if( cache_policy == CACHE_POLICY_ARC ) {
+    assert( in_ain + in_aout <= tree->max_pages );
+    assert( in_ain + in_aout + in_am + in_amout <= 2 * tree->max_pages );
+  } else {
+    assert( in_amout == 0 );
+  }
 
   // 4: dirty list must be well-formed
   {
@@ -1591,7 +1832,7 @@ void validate_cache(struct rdcache_s* tree)
     for( cur = tree->free_entries_head; cur; cur = cur->next ) {
       num_free_entries++;
     }
-    assert( in_ain + in_aout + in_am + num_free_entries == tree->max_entries );
+    assert( in_ain + in_aout + in_am + in_amout + num_free_entries == tree->max_entries );
   }
 
   // 6: must not lose pages
@@ -1776,6 +2017,11 @@ void flush_entry(struct rdcache_s* cache, struct cache_entry_s* entry, int op,
       entry->max_put_sequence_number = NO_SEQUENCE_NUMBER;
       entry->max_prefetch_sequence_number = NO_SEQUENCE_NUMBER;
       memset(entry->valid_lines, 0, CACHE_LINES_PER_PAGE_BITMASK_WORDS*sizeof(uint64_t));
+      if( entry->prefetched ) {
+        // The prefetched data was never used.
+        CACHE_DIAGS_INC(cache_prefetch_wasted);
+        entry->prefetched = PREFETCHED_NONE;
+      }
     } else {
       unset_valid_lines(entry->valid_lines, skip_lines, num_lines);
     }
@@ -1783,6 +2029,12 @@ void flush_entry(struct rdcache_s* cache, struct cache_entry_s* entry, int op,
 
   // If evicting, remove the page from the cache and put it on a free list.
   if( op & FLUSH_DO_EVICT ) {
+    CACHE_DIAGS_INC(cache_evictions);
+    if( entry->prefetched ) {
+      // The prefetched data was never used.
+      CACHE_DIAGS_INC(cache_prefetch_wasted);
+      entry->prefetched = PREFETCHED_NONE;
+    }
     // But, our entry no longer can have a page associated with it.
     page = entry->page;
     entry->page = NULL;
@@ -1810,9 +2062,43 @@ void use_entry(struct rdcache_s* cache, struct cache_entry_s* entry)
   if( entry->queue == QUEUE_AM ) {
     DOUBLE_REMOVE(cache, entry, am_lru);
     DOUBLE_PUSH_HEAD(cache, entry, am_lru);
-  } 
+  } else if( cache_policy == CACHE_POLICY_ARC &&
+             entry->queue == QUEUE_AIN &&
+             entry != cache->last_used ) {
+    // ARC: a hit in T1 moves X to the head of T2.
+    DOUBLE_REMOVE(cache, entry, ain);
+    cache->ain_current--;
+    DOUBLE_PUSH_HEAD(cache, entry, am_lru);
+    cache->am_current++;
+    entry->queue = QUEUE_AM;
+  }
   // Otherwise, leave it where it is.
   // Else If X is in A1in then do nothing
+  cache->last_used = entry;
+}
+
+// ARC adapts the target size of Ain when a page that was evicted
+// recently is needed again. A hit in Aout (B1) means Ain should be
+// larger; a hit in Amout (B2) means Am should be larger.
+static
+void arc_adapt(struct rdcache_s* cache, int queue)
+{
+  unsigned int delta;
+
+  if( queue == QUEUE_AOUT ) {
+    delta = 1;
+    if( cache->amout_current > cache->aout_current )
+      delta = cache->amout_current / cache->aout_current;
+    cache->arc_target += delta;
+    if( cache->arc_target > cache->max_pages )
+      cache->arc_target = cache->max_pages;
+  } else {
+    delta = 1;
+    if( cache->aout_current > cache->amout_current )
+      delta = cache->aout_current / cache->amout_current;
+    if( cache->arc_target > delta ) cache->arc_target -= delta;
+    else cache->arc_target = 0;
+  }
 }
 
 // Plumb a cache entry into the tree. We might need to replace something
@@ -1862,18 +2148,29 @@ struct cache_entry_s* make_entry(struct rdcache_s* tree,
     assert( bottom_match->base.node == node );
     assert( bottom_match->raddr == raddr );
     // We shouldn't be replacing something in Ain or Am; use use_entry instead
-    assert(bottom_match->queue == QUEUE_AOUT);
+    assert(bottom_match->queue == QUEUE_AOUT ||
+           bottom_match->queue == QUEUE_AMOUT);
+
+    if( cache_policy == CACHE_POLICY_ARC )
+      arc_adapt(tree, bottom_match->queue);
 
-    DEBUG_PRINT(("%d: Found %p in Aout\n", chpl_nodeID, (void*) raddr));
+    if( bottom_match->queue == QUEUE_AOUT ) {
+      DEBUG_PRINT(("%d: Found %p in Aout\n", chpl_nodeID, (void*) raddr));
+      DOUBLE_REMOVE(tree, bottom_match, aout);
+      tree->aout_current--;
+    } else {
+      DEBUG_PRINT(("%d: Found %p in Amout\n", chpl_nodeID, (void*) raddr));
+      DOUBLE_REMOVE(tree, bottom_match, amout);
+      tree->amout_current--;
+    }
     // add X to the head of Am
-    DOUBLE_REMOVE(tree, bottom_match, aout);
-    tree->aout_current--;
     DOUBLE_PUSH_HEAD(tree, bottom_match, am_lru);
     tree->am_current++;
 
     bottom_match->queue = QUEUE_AM;
     bottom_match->readahead_skip = 0;
     bottom_match->readahead_len = 0;
+    bottom_match->prefetched = PREFETCHED_NONE;
     // Set the page to the one the caller already allocated
     bottom_match->page = page;
     // Clear the valid lines
@@ -1900,6 +2197,7 @@ struct cache_entry_s* make_entry(struct rdcache_s* tree,
     bottom_tmp->queue = QUEUE_AIN;
     bottom_tmp->readahead_skip = 0;
     bottom_tmp->readahead_len = 0;
+    bottom_tmp->prefetched = PREFETCHED_NONE;
 
     bottom_tmp->next = NULL;
     bottom_tmp->prev = NULL;
@@ -1919,8 +2217,11 @@ struct cache_entry_s* make_entry(struct rdcache_s* tree,
     bottom_match = bottom_tmp;
     top_match->num_entries++; // adding an element.
     DEBUG_PRINT(("  added a new bottom_index_entry: %p\n", bottom_match));
+
+    ghost_trim(tree);
   }
 
+  tree->last_used = bottom_match;
 
   return bottom_match;
 }
@@ -2003,6 +2304,9 @@ void cache_put(struct rdcache_s* cache,
     if( ! page ) {
       // get a page from the free list.
       page = allocate_page(cache);
+      CACHE_DIAGS_INC(cache_put_misses);
+    } else {
+      CACHE_DIAGS_INC(cache_put_hits);
     }
 
     if( entry ) use_entry(cache, entry);
@@ -2224,6 +2528,125 @@ int should_readahead_extend(uint64_t* valid,
   return 0;
 }
 
+// Called for a GET of raddr that missed in the cache, or that used
+// data brought in by an earlier stride prefetch. If this access
+// continues a fixed-stride stream (or is the third access in a new one),
+// prefetch the next few accesses in that stream.
+static
+void stride_prefetch(struct rdcache_s* cache,
+                     c_nodeid_t node, raddr_t raddr, size_t size,
+                     cache_seqn_t last_acquire,
+                     int ln, int32_t fn)
+{
+  struct stride_stream_s* stream;
+  struct stride_stream_s* s;
+  struct cache_entry_s* entry;
+  intptr_t delta, stride;
+  uintptr_t distance;
+  raddr_t pf_addr, pf_end;
+  uintptr_t page_mask;
+  int i, j;
+
+  // Does this access continue a stream that we know about?
+  // It might be more than one stride along, since we don't hear about
+  // hits on prefetched pages after the first one.
+  stream = NULL;
+  for( i = 0; i < STRIDE_STREAMS; i++ ) {
+    s = &cache->stride_streams[i];
+    if( s->stride == 0 || s->node != node ) continue;
+    delta = (intptr_t) (raddr - s->last_addr);
+    if( delta % s->stride == 0 &&
+        delta / s->stride >= 1 &&
+        delta / s->stride <= STRIDE_PREFETCH_DEPTH + 1 ) {
+      stream = s;
+      break;
+    }
+  }
+
+  if( ! stream ) {
+    // Look for two earlier misses that form a stream with this one,
+    // ie for x and y where raddr - x == x - y.
+    stride = 0;
+    for( i = 0; i < STRIDE_HISTORY && stride == 0; i++ ) {
+      if( cache->stride_history_node[i] != node ) continue;
+      delta = (intptr_t) (raddr - cache->stride_history_addr[i]);
+      distance = (delta < 0) ? -delta : delta;
+      if( distance < MIN_STRIDE_BYTES || distance > MAX_STRIDE_BYTES ) continue;
+      for( j = 0; j < STRIDE_HISTORY; j++ ) {
+        if( cache->stride_history_node[j] == node &&
+            (intptr_t) (cache->stride_history_addr[i] -
+                        cache->stride_history_addr[j]) == delta ) {
+          stride = delta;
+          break;
+        }
+      }
+    }
+
+    // Remember this miss.
+    cache->stride_history_node[cache->stride_history_next] = node;
+    cache->stride_history_addr[cache->stride_history_next] = raddr;
+    cache->stride_history_next = (cache->stride_history_next + 1) % STRIDE_HISTORY;
+
+    if( stride == 0 ) return;
+
+    // Start a new stream in place of the least recently used one.
+    stream = &cache->stride_streams[0];
+    for( i = 1; i < STRIDE_STREAMS; i++ ) {
+      if( cache->stride_streams[i].last_use < stream->last_use )
+        stream = &cache->stride_streams[i];
+    }
+    stream->node = node;
+    stream->stride = stride;
+    stream->next_prefetch = raddr + stride;
+
+    INFO_PRINT(("%i stride prefetch stream %i:%p stride %i\n",
+                (int) chpl_nodeID, (int) node, (void*) raddr, (int) stride));
+  }
+
+  stream->last_addr = raddr;
+  stream->last_use = cache->next_request_number;
+
+  // Don't prefetch anything the program has already passed.
+  if( (intptr_t) (stream->next_prefetch - raddr) / stream->stride < 1 )
+    stream->next_prefetch = raddr + stream->stride;
+
+  page_mask = sys_page_size() - 1;
+
+  while( (intptr_t) (stream->next_prefetch - raddr) / stream->stride <=
+         STRIDE_PREFETCH_DEPTH ) {
+    // Don't wait for room to start another operation.
+    if( is_congested(cache) ||
+        fifo_circleb_isfull(cache->pending_first_entry,
+                            cache->pending_last_entry,
+                            cache->pending_len) )
+      break;
+
+    // Prefetch the same number of bytes as this access, but stay
+    // within one cache page so that the prefetch is a single GET.
+    pf_addr = stream->next_prefetch;
+    pf_end = raddr_min(pf_addr + size,
+                       round_down_to_mask(pf_addr, CACHEPAGE_MASK) +
+                       CACHEPAGE_SIZE);
+
+    // As with readahead, if we can't tell that the prefetch is in
+    // registered memory, only prefetch within the system page that
+    // the program is accessing.
+    if( ! chpl_comm_addr_gettable(node, (void*) pf_addr, pf_end - pf_addr) &&
+        round_down_to_mask(pf_addr, page_mask) !=
+        round_down_to_mask(raddr, page_mask) )
+      break;
+
+    cache_get(cache, NULL /* prefetch */,
+              node, pf_addr, pf_end - pf_addr,
+              last_acquire, 0, ln, fn);
+
+    entry = find_in_tree(cache, node, round_down_to_mask(pf_addr, CACHEPAGE_MASK));
+    if( entry && entry->prefetched ) entry->prefetched = PREFETCHED_STRIDE;
+
+    stream->next_prefetch += stream->stride;
+  }
+}
+
 
 // If addr == NULL, this will prefetch.
 static
@@ -2252,6 +2675,7 @@ void cache_get(struct rdcache_s* cache,
   chpl_comm_nb_handle_t handle;
   uintptr_t readahead_len, readahead_skip;
   int ra;
+  int stride_event = 0;
 #ifdef TIME
   struct timespec start_get1, start_get2, wait1, wait2;
 #endif
@@ -2406,6 +2830,12 @@ void cache_get(struct rdcache_s* cache,
         // If the cache line is in Am, move it to the front of Am.
         use_entry(cache, entry);
         if( ! isprefetch ) {
+          CACHE_DIAGS_INC(cache_get_hits);
+          if( entry->prefetched ) {
+            CACHE_DIAGS_INC(cache_prefetch_useful);
+            if( entry->prefetched == PREFETCHED_STRIDE ) stride_event = 1;
+            entry->prefetched = PREFETCHED_NONE;
+          }
       
           //printf("cache hit on page %i:%p %p ra_len %i\n", 
           //       node, (void*) ra_page, (void*) requested_start,
@@ -2457,6 +2887,11 @@ void cache_get(struct rdcache_s* cache,
 
     // Otherwise -- start a get !
 
+    if( ! isprefetch ) {
+      CACHE_DIAGS_INC(cache_get_misses);
+      stride_event = 1;
+    }
+
     if( ! page ) {
       // get a page from the free list.
       page = allocate_page(cache);
@@ -2505,6 +2940,7 @@ void cache_get(struct rdcache_s* cache,
       // This will increment next request number so cache events are recorded.
       sn = pending_push(cache, handle);
       entry->max_prefetch_sequence_number = seqn_max(entry->max_prefetch_sequence_number, sn);
+      entry->prefetched = PREFETCHED_OTHER;
     }
 
     // Set the minimum sequence number
@@ -2578,6 +3014,11 @@ void cache_get(struct rdcache_s* cache,
     }
   }
 
+  // Look for strided access now that we aren't using any entries.
+  if( ENABLE_STRIDE_PREFETCH && stride_event ) {
+    stride_prefetch(cache, node, raddr, size, last_acquire, ln, fn);
+  }
+
   if( VERIFY ) validate_cache(cache);
 
 #ifdef DUMP
@@ -2699,11 +3140,68 @@ void destroy_pthread_local_cache(void* arg)
   cache_destroy(s);
 }
 
+// Read the CHPL_RT_CACHE_* settings. This must happen before any
+// cache is created, since everything in a cache is sized using them.
+static
+void cache_read_config(void)
+{
+  char msg[200];
+  const char* policy;
+  size_t page_size;
+  size_t size;
+  int64_t pages_per_node;
+  int bits;
+
+  page_size = chpl_get_rt_env_size("CACHE_PAGE_SIZE", 0);
+  if( page_size != 0 ) {
+    for( bits = MIN_CACHEPAGE_BITS; bits <= MAX_CACHEPAGE_BITS; bits += 2 ) {
+      if( page_size == ((size_t) 1) << bits ) break;
+    }
+    if( bits > MAX_CACHEPAGE_BITS || page_size > sys_page_size() ) {
+      snprintf(msg, sizeof(msg),
+               "CHPL_RT_CACHE_PAGE_SIZE must be one of 64, 256, 1k, or 4k "
+               "and no larger than the system page size; using %d",
+               1 << DEFAULT_CACHEPAGE_BITS);
+      chpl_warning(msg, 0, 0);
+    } else {
+      cachepage_bits = bits;
+    }
+  }
+
+  pages_per_node = chpl_get_rt_env_int("CACHE_PAGES_PER_NODE",
+                                       CACHE_PAGES_PER_NODE);
+  if( pages_per_node <= 0 || pages_per_node > INT32_MAX / chpl_numNodes ) {
+    chpl_warning("CHPL_RT_CACHE_PAGES_PER_NODE out of range; ignoring", 0, 0);
+  } else {
+    cache_pages_per_node = (int) pages_per_node;
+  }
+
+  size = chpl_get_rt_env_size("CACHE_SIZE", 0);
+  if( size / CACHEPAGE_SIZE > INT32_MAX / 4 ) {
+    chpl_warning("CHPL_RT_CACHE_SIZE is too large; ignoring", 0, 0);
+  } else {
+    cache_data_size = size;
+  }
+
+  policy = chpl_get_rt_env("CACHE_POLICY", NULL);
+  if( policy != NULL ) {
+    if( strcmp(policy, "2q") == 0 || strcmp(policy, "2Q") == 0 ) {
+      cache_policy = CACHE_POLICY_2Q;
+    } else if( strcmp(policy, "arc") == 0 || strcmp(policy, "ARC") == 0 ) {
+      cache_policy = CACHE_POLICY_ARC;
+    } else {
+      chpl_warning("CHPL_RT_CACHE_POLICY must be 2q or arc; using 2q", 0, 0);
+    }
+  }
+}
+
 static
 void chpl_cache_do_init(void)
 {
   static int inited = 0;
   if( ! inited ) {
+
+    cache_read_config();
   
     // Quick configuration check...
     assert(OTHER_BITS+TOP_BITS+OTHER_BITS+BOTTOM_BITS+CACHEPAGE_BITS == 64);
@@ -2739,6 +3237,14 @@ void chpl_cache_init(void) {
     CHPL_CACHE_REMOTE = 0;
   }*/
 
+  atomic_init_uint_least64_t(&cache_get_hits, 0);
+  atomic_init_uint_least64_t(&cache_get_misses, 0);
+  atomic_init_uint_least64_t(&cache_put_hits, 0);
+  atomic_init_uint_least64_t(&cache_put_misses, 0);
+  atomic_init_uint_least64_t(&cache_evictions, 0);
+  atomic_init_uint_least64_t(&cache_prefetch_useful, 0);
+  atomic_init_uint_least64_t(&cache_prefetch_wasted, 0);
+
   // Don't initialize TLS if the cache is not enabled.
   if( ! chpl_cache_enabled() ) {
     return;
@@ -2907,6 +3413,28 @@ void chpl_cache_print(void)
   rdcache_print(cache);
 }
 
+void chpl_cache_getCommDiagnostics(chpl_commDiagnostics *cd)
+{
+  cd->cache_get_hits = atomic_load_uint_least64_t(&cache_get_hits);
+  cd->cache_get_misses = atomic_load_uint_least64_t(&cache_get_misses);
+  cd->cache_put_hits = atomic_load_uint_least64_t(&cache_put_hits);
+  cd->cache_put_misses = atomic_load_uint_least64_t(&cache_put_misses);
+  cd->cache_evictions = atomic_load_uint_least64_t(&cache_evictions);
+  cd->cache_prefetch_useful = atomic_load_uint_least64_t(&cache_prefetch_useful);
+  cd->cache_prefetch_wasted = atomic_load_uint_least64_t(&cache_prefetch_wasted);
+}
+
+void chpl_cache_resetCommDiagnostics(void)
+{
+  atomic_store_uint_least64_t(&cache_get_hits, 0);
+  atomic_store_uint_least64_t(&cache_get_misses, 0);
+  atomic_store_uint_least64_t(&cache_put_hits, 0);
+  atomic_store_uint_least64_t(&cache_put_misses, 0);
+  atomic_store_uint_least64_t(&cache_evictions, 0);
+  atomic_store_uint_least64_t(&cache_prefetch_useful, 0);
+  atomic_store_uint_least64_t(&cache_prefetch_wasted, 0);
+}
+
 /*
 // Turn the cache on or off for debug purposes.
 void chpl_cache_set_enabled(int enabled)
@@ -23,6 +23,7 @@
 #include "chpltypes.h"
 #include "error.h"
 
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -56,3 +57,47 @@ chpl_bool chpl_get_rt_env_bool(const char* evs, chpl_bool dflt) {
            evs, (dflt ? 'T' : 'F'));
   return dflt;
 }
+
+
+int64_t chpl_get_rt_env_int(const char* evs, int64_t dflt) {
+  const char* evVal = chpl_get_rt_env(evs, NULL);
+  int64_t val;
+
+  if (evVal == NULL)
+    return dflt;
+  if (sscanf(evVal, "%" SCNi64, &val) == 1)
+    return val;
+
+  chpl_msg(1,
+           "warning: unknown CHPL_RT_%s value; should be an integer, "
+           "assuming %" PRId64 "\n",
+           evs, dflt);
+  return dflt;
+}
+
+
+size_t chpl_get_rt_env_size(const char* evs, size_t dflt) {
+  const char* evVal = chpl_get_rt_env(evs, NULL);
+  size_t val;
+  int    scan_cnt;
+  char   units;
+
+  if (evVal == NULL)
+    return dflt;
+  if ((scan_cnt = sscanf(evVal, "%zu%c", &val, &units)) == 1)
+    return val;
+  if (scan_cnt == 2 && strchr("kKmMgG", units) != NULL) {
+    switch (units) {
+    case 'k' : case 'K': val <<= 10; break;
+    case 'm' : case 'M': val <<= 20; break;
+    case 'g' : case 'G': val <<= 30; break;
+    }
+    return val;
+  }
+
+  chpl_msg(1,
+           "warning: unknown CHPL_RT_%s value; should be a size in bytes "
+           "with an optional k, m, or g suffix, assuming %zu\n",
+           evs, dflt);
+  return dflt;
+}
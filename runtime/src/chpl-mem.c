@@ -26,6 +26,8 @@
 #include "chpltypes.h"
 #include "error.h"
 #include "chplsys.h"
+#include "chpl-atomics.h"
+#include "chpl-env.h"
 
 static int heapInitialized = 0;
 
@@ -105,3 +107,143 @@ void* chpl_pvalloc(size_t size)
 }
 
 
+
+
+//
+// Task arena support; see chpl-mem-arena.h.  The per-arena counters
+// are folded into these when each task releases its arena, so they
+// cover finished tasks only.
+//
+chpl_bool chpl_mem_taskArenaOn = false;
+
+static size_t taskArenaChunkSize;
+static atomic_uint_least64_t taskArenaAllocs;
+static atomic_uint_least64_t taskArenaHeap;
+static atomic_uint_least64_t taskArenaChunks;
+static atomic_uint_least64_t taskArenaReleased;
+
+//
+// Called by the tasking layers that release task arenas at task end,
+// from chpl_task_init().
+//
+void chpl_mem_taskArenaInit(void) {
+  atomic_init_uint_least64_t(&taskArenaAllocs, 0);
+  atomic_init_uint_least64_t(&taskArenaHeap, 0);
+  atomic_init_uint_least64_t(&taskArenaChunks, 0);
+  atomic_init_uint_least64_t(&taskArenaReleased, 0);
+
+  if (!chpl_get_rt_env_bool("TASK_ARENA", false))
+    return;
+
+  taskArenaChunkSize = chpl_get_rt_env_size("TASK_ARENA_SIZE", 16 * 1024);
+  if (taskArenaChunkSize < 1024)
+    taskArenaChunkSize = 1024;
+  chpl_mem_taskArenaOn = true;
+}
+
+
+void* chpl_mem_taskAllocSlow(chpl_mem_taskArena_t* a,
+                             size_t size, size_t need,
+                             chpl_mem_descInt_t description,
+                             int32_t lineno, int32_t filename) {
+  chpl_mem_taskArenaHdr_t* h;
+
+  //
+  // Anything bigger than a quarter chunk goes straight to the heap, so
+  // one large request can't strand most of a chunk.
+  //
+  if (need > taskArenaChunkSize / 4) {
+    h = (chpl_mem_taskArenaHdr_t*)
+        chpl_mem_alloc(need, description, lineno, filename);
+    h->size = need;
+    h->fromHeap = 1;
+    a->nHeap++;
+    return h + 1;
+  }
+
+  {
+    chpl_mem_taskArenaChunk_t* c;
+
+    c = (chpl_mem_taskArenaChunk_t*)
+        chpl_mem_alloc(taskArenaChunkSize, CHPL_RT_MD_TASK_ARENA_CHUNK,
+                       lineno, filename);
+    c->prev = a->chunk;
+    c->size = taskArenaChunkSize;
+    a->chunk = c;
+    a->top = (char*) (c + 1);
+    a->limit = (char*) c + taskArenaChunkSize;
+    a->nChunks++;
+  }
+
+  chpl_memhook_malloc_pre(1, size, description, lineno, filename);
+  h = (chpl_mem_taskArenaHdr_t*) a->top;
+  h->size = need;
+  h->fromHeap = 0;
+  a->top += need;
+  a->live++;
+  a->nAllocs++;
+  chpl_memhook_malloc_post(h + 1, 1, size, description, lineno, filename);
+  return h + 1;
+}
+
+
+//
+// Free all but the newest chunk.  Only called when nothing is live.
+//
+void chpl_mem_taskArenaTrim(chpl_mem_taskArena_t* a) {
+  chpl_mem_taskArenaChunk_t* c = a->chunk->prev;
+
+  while (c != NULL) {
+    chpl_mem_taskArenaChunk_t* prev = c->prev;
+    chpl_mem_free(c, 0, 0);
+    c = prev;
+  }
+  a->chunk->prev = NULL;
+}
+
+
+//
+// Called by the tasking layer when a task ends.  Whatever the task
+// allocated from its arena and did not free is freed here, in bulk.
+//
+void chpl_mem_taskArenaRelease(chpl_mem_taskArena_t* a) {
+  chpl_mem_taskArenaChunk_t* c;
+
+  if (a->nAllocs == 0 && a->nHeap == 0)
+    return;
+
+  c = a->chunk;
+  while (c != NULL) {
+    chpl_mem_taskArenaChunk_t* prev = c->prev;
+    chpl_mem_free(c, 0, 0);
+    c = prev;
+  }
+
+  atomic_fetch_add_uint_least64_t(&taskArenaAllocs, a->nAllocs);
+  atomic_fetch_add_uint_least64_t(&taskArenaHeap, a->nHeap);
+  atomic_fetch_add_uint_least64_t(&taskArenaChunks, a->nChunks);
+  atomic_fetch_add_uint_least64_t(&taskArenaReleased, 1);
+
+  memset(a, 0, sizeof(*a));
+}
+
+
+void chpl_mem_taskArenaStats(uint64_t* nAllocs, uint64_t* nHeap,
+                             uint64_t* nChunks, uint64_t* nReleased) {
+  *nAllocs = atomic_load_uint_least64_t(&taskArenaAllocs);
+  *nHeap = atomic_load_uint_least64_t(&taskArenaHeap);
+  *nChunks = atomic_load_uint_least64_t(&taskArenaChunks);
+  *nReleased = atomic_load_uint_least64_t(&taskArenaReleased);
+
+  //
+  // Include the calling task, which hasn't released its arena yet.
+  // Otherwise a program that only allocates in its main task would
+  // see nothing.
+  //
+  if (chpl_mem_taskArenaOn) {
+    chpl_mem_taskArena_t* a = &chpl_task_getPrvData()->mem_arena;
+    *nAllocs += a->nAllocs;
+    *nHeap += a->nHeap;
+    *nChunks += a->nChunks;
+  }
+}
@@ -19,52 +19,89 @@
 
 #include "chplrt.h"
 #include "chpl-privatization.h"
+#include "chpl-atomics.h"
+#include "chpl-bitops.h"
 #include "chpl-mem.h"
-#include "chpl-tasks.h"
 
-static int64_t chpl_capPrivateObjects = 0;
-static chpl_sync_aux_t privatizationSync;
+//
+// The privatized object table is split into segments whose sizes double:
+// segment 0 holds PRV_SEG0_SIZE entries, segment 1 twice that, and so on.
+// A pid maps to a (segment, offset) pair with a little bit arithmetic, so
+// growing the table only ever allocates a new segment.  Existing entries
+// are never copied, and nothing has to be leaked to keep concurrent readers
+// safe.
+//
+// Segments are installed with a compare-and-swap on prvSegmentsAtomic; a
+// task that loses the race frees its allocation and uses the winner's.
+// prvSegments is a plain mirror of the installed segments used for lookups.
+// An entry in it is written (always with the same value) by every task that
+// stores into that segment before the corresponding pid can be handed out,
+// so readers never need an atomic load.
+//
+#define PRV_SEG0_LOG2 6
+#define PRV_SEG0_SIZE (1 << PRV_SEG0_LOG2)
+#define PRV_NUM_SEGMENTS (64 - PRV_SEG0_LOG2)
 
-void** chpl_privateObjects;
+static atomic_uintptr_t prvSegmentsAtomic[PRV_NUM_SEGMENTS];
+static void** prvSegments[PRV_NUM_SEGMENTS];
 
-void chpl_privatization_init(void) {
-    chpl_sync_initAux(&privatizationSync);
+static inline
+void prvIndex(int64_t pid, int* seg, int64_t* offset) {
+  uint64_t biased = (uint64_t)pid + PRV_SEG0_SIZE;
+  int log2 = 63 - (int)chpl_bitops_clz_64(biased);
+  *seg = log2 - PRV_SEG0_LOG2;
+  *offset = (int64_t)(biased - ((uint64_t)1 << log2));
 }
 
-void chpl_newPrivatizedClass(void* v, int64_t pid) {
-  // We need to lock around this operation so two calls in rapid succession
-  // that pass the chpl_capPrivateObjects limit don't both try to create a new
-  // array. If they do, one of the calls will be leaked and an invalid pointer
-  // to be placed in the table.
-  chpl_sync_lock(&privatizationSync);
+static
+void** prvGetSegment(int seg) {
+  void** segment = prvSegments[seg];
+  uintptr_t installed;
+
+  if (segment != NULL)
+    return segment;
 
-  pid += 1;
-  if (pid == 1) {
-    chpl_capPrivateObjects = 8;
+  installed = atomic_load_uintptr_t(&prvSegmentsAtomic[seg]);
+  if (installed == 0) {
+    size_t size = (size_t)PRV_SEG0_SIZE << seg;
     // "private" means "node-private", so we can use the system allocator.
-    chpl_privateObjects =
-        chpl_mem_allocMany(chpl_capPrivateObjects, sizeof(void *),
-                           CHPL_RT_MD_COMM_PRV_OBJ_ARRAY, 0, 0);
-  } else {
-    if (pid > chpl_capPrivateObjects) {
-      void** tmp;
-      chpl_capPrivateObjects *= 2;
-      tmp = chpl_mem_allocMany(chpl_capPrivateObjects, sizeof(void *),
-                               CHPL_RT_MD_COMM_PRV_OBJ_ARRAY, 0, 0);
-      chpl_memcpy((void*)tmp, (void*)chpl_privateObjects, (pid-1)*sizeof(void*));
-      chpl_privateObjects = tmp;
-      // purposely leak old copies of chpl_privateObject to avoid the need to
-      // lock chpl_getPrivatizedClass; TODO: fix with lock free data structure
+    void** fresh = chpl_mem_allocManyZero(size, sizeof(void*),
+                                          CHPL_RT_MD_COMM_PRV_OBJ_ARRAY,
+                                          0, 0);
+    if (atomic_compare_exchange_strong_uintptr_t(&prvSegmentsAtomic[seg],
+                                                 0, (uintptr_t)fresh)) {
+      installed = (uintptr_t)fresh;
+    } else {
+      chpl_mem_free(fresh, 0, 0);
+      installed = atomic_load_uintptr_t(&prvSegmentsAtomic[seg]);
     }
   }
-  chpl_privateObjects[pid-1] = v;
 
-  chpl_sync_unlock(&privatizationSync);
+  segment = (void**)installed;
+  prvSegments[seg] = segment;
+  return segment;
 }
 
+void chpl_privatization_init(void) {
+  int i;
+  for (i = 0; i < PRV_NUM_SEGMENTS; i++) {
+    atomic_init_uintptr_t(&prvSegmentsAtomic[i], 0);
+    prvSegments[i] = NULL;
+  }
+}
 
-extern void* chpl_getPrivatizedClass(int64_t i) {
-  return chpl_privateObjects[i];
+void chpl_newPrivatizedClass(void* v, int64_t pid) {
+  int seg;
+  int64_t offset;
+
+  prvIndex(pid, &seg, &offset);
+  prvGetSegment(seg)[offset] = v;
 }
 
+extern void* chpl_getPrivatizedClass(int64_t i) {
+  int seg;
+  int64_t offset;
 
+  prvIndex(i, &seg, &offset);
+  return prvSegments[seg][offset];
+}
@@ -28,6 +28,8 @@ struct chpl_chpl____wide_chpl_string_s {
 };
 typedef struct chpl_chpl____wide_chpl_string_s chpl____wide_chpl_string;
 
+chpl_string defaultStringValue = "";
+
 chpl_string
 chpl_wide_string_copy(chpl____wide_chpl_string* x, int32_t lineno, int32_t filename) {
   if (chpl_rt_nodeFromLocaleID(x->locale) == chpl_nodeID)
@@ -27,6 +27,8 @@
 #include "chpl-comm.h"
 #include "chplcgfns.h"
 #include "chpl-linefile-support.h"
+#include "chpl-atomics.h"
+#include "chpl-thread-local-storage.h"
 #include "config.h"
 #include "error.h"
 
@@ -55,6 +57,7 @@ extern void chpl_memTracking_returnConfigVals(chpl_bool* memTrack,
                                               chpl_bool* memLeaks,
                                               size_t* memMax,
                                               size_t* memThreshold,
+                                              size_t* memSample,
                                               c_string* memLog,
                                               c_string* memLeaksLog);
 
@@ -73,16 +76,34 @@ typedef struct memTableEntry_struct { /* table entry */
   struct memTableEntry_struct* nextInBucket;
 } memTableEntry;
 
-#define NUM_HASH_SIZE_INDICES 20
+#define NUM_HASH_SIZE_INDICES 24
 
-static int hashSizes[NUM_HASH_SIZE_INDICES] = { 1543, 3079, 6151, 12289, 24593, 49157, 98317,
+static int hashSizes[NUM_HASH_SIZE_INDICES] = { 97, 193, 389, 769,
+                                                1543, 3079, 6151, 12289, 24593, 49157, 98317,
                                                 196613, 393241, 786433, 1572869, 3145739,
                                                 6291469, 12582917, 25165843, 50331653,
                                                 100663319, 201326611, 402653189, 805306457 };
-static int hashSizeIndex = 0;
-static int hashSize = 0;
 
-static memTableEntry** memTable = NULL;
+//
+// The tracked allocations are split by address into shards, each with
+// its own lock, hash table, and statistics, so that tasks allocating
+// and freeing memory at the same time rarely wait for each other and
+// growing a table only rehashes one shard.  The reports merge the
+// shards when they run.
+//
+#define NUM_MEMTRACK_SHARDS 64
+
+typedef struct memTrackShard_struct {
+  chpl_sync_aux_t sync;
+  int hashSizeIndex;
+  int hashSize;
+  memTableEntry** memTable;
+  size_t totalAllocated; /* total memory allocated */
+  size_t totalFreed;     /* total memory freed */
+  size_t totalEntries;   /* number of entries in hash table */
+} memTrackShard;
+
+static memTrackShard memTrackShards[NUM_MEMTRACK_SHARDS];
 
 static _Bool memStats = false;
 static _Bool memLeaksByType = false;
@@ -90,17 +111,17 @@ static c_string memLeaksByDesc = "";
 static _Bool memLeaks = false;
 static size_t memMax = 0;
 static size_t memThreshold = 0;
+static size_t memSample = 1;
 static c_string memLog = NULL;
 static FILE* memLogFile = NULL;
 static c_string memLeaksLog = NULL;
 
-static size_t totalMem = 0;       /* total memory currently allocated */
-static size_t maxMem = 0;         /* maximum total memory during run  */
-static size_t totalAllocated = 0; /* total memory allocated */
-static size_t totalFreed = 0;     /* total memory freed */
-static size_t totalEntries = 0;     /* number of entries in hash table */
+static atomic_uint_least64_t totalMem; /* total memory currently allocated */
+static size_t maxMem = 0;              /* maximum total memory during run  */
+static chpl_sync_aux_t maxMem_sync;
 
-static chpl_sync_aux_t memTrack_sync;
+// With --memSample=N, each thread tracks one of every N allocations.
+CHPL_TLS_DECL(uintptr_t, memSampleCount);
 
 
 void chpl_setMemFlags(void) {
@@ -128,6 +149,7 @@ void chpl_setMemFlags(void) {
                                     &memLeaks,
                                     &memMax,
                                     &memThreshold,
+                                    &memSample,
                                     &memLog,
                                     &memLeaksLog);
 
@@ -154,11 +176,21 @@ void chpl_setMemFlags(void) {
     }
   }
 
+  if (memSample == 0)
+    memSample = 1;
+
   if (chpl_memTrack) {
-    chpl_sync_initAux(&memTrack_sync);
-    hashSizeIndex = 0;
-    hashSize = hashSizes[hashSizeIndex];
-    memTable = calloc(hashSize, sizeof(memTableEntry*));
+    int i;
+    for (i = 0; i < NUM_MEMTRACK_SHARDS; i++) {
+      memTrackShard* shard = &memTrackShards[i];
+      chpl_sync_initAux(&shard->sync);
+      shard->hashSizeIndex = 0;
+      shard->hashSize = hashSizes[shard->hashSizeIndex];
+      shard->memTable = calloc(shard->hashSize, sizeof(memTableEntry*));
+    }
+    atomic_init_uint_least64_t(&totalMem, 0);
+    chpl_sync_initAux(&maxMem_sync);
+    CHPL_TLS_INIT(memSampleCount);
   }
 }
 
@@ -175,37 +207,82 @@ static unsigned hash(void* memAlloc, int hashSize) {
 }
 
 
-static void increaseMemStat(size_t chunk, int32_t lineno, int32_t filename) {
-  totalMem += chunk;
-  totalAllocated += chunk;
-  if (memMax && (totalMem > memMax)) {
+static memTrackShard* getShard(void* memAlloc) {
+  uintptr_t a = (uintptr_t)memAlloc >> 4; // allocations are 16-byte aligned
+  return &memTrackShards[(a ^ (a >> 6) ^ (a >> 12)) % NUM_MEMTRACK_SHARDS];
+}
+
+
+// Should this thread track the allocation it is about to make?
+static chpl_bool sampleAlloc(void) {
+  uintptr_t count;
+
+  if (memSample == 1)
+    return true;
+
+  count = (uintptr_t)CHPL_TLS_GET(memSampleCount) + 1;
+  if (count == memSample)
+    count = 0;
+  CHPL_TLS_SET(memSampleCount, count);
+  return count == 0;
+}
+
+
+// The shards are locked in order so that reports can look at all of
+// them at once without deadlocking.
+static void lockAllShards(void) {
+  int i;
+  for (i = 0; i < NUM_MEMTRACK_SHARDS; i++)
+    chpl_sync_lock(&memTrackShards[i].sync);
+}
+
+
+static void unlockAllShards(void) {
+  int i;
+  for (i = NUM_MEMTRACK_SHARDS-1; i >= 0; i--)
+    chpl_sync_unlock(&memTrackShards[i].sync);
+}
+
+
+static void increaseMemStat(memTrackShard* shard, size_t chunk,
+                            int32_t lineno, int32_t filename) {
+  uint64_t curMem;
+
+  shard->totalAllocated += chunk;
+  curMem = atomic_fetch_add_uint_least64_t(&totalMem, chunk) + chunk;
+  if (memMax && (curMem * memSample > memMax)) {
     chpl_error("Exceeded memory limit", lineno, filename);
   }
-  if (totalMem > maxMem)
-    maxMem = totalMem;
+  // Only take the lock when we might have reached a new maximum.
+  if (curMem > maxMem) {
+    chpl_sync_lock(&maxMem_sync);
+    if (curMem > maxMem)
+      maxMem = curMem;
+    chpl_sync_unlock(&maxMem_sync);
+  }
 }
 
 
-static void decreaseMemStat(size_t chunk) {
-  totalMem -= chunk; // > totalMem ? 0 : totalMem - chunk;
-  totalFreed += chunk;
+static void decreaseMemStat(memTrackShard* shard, size_t chunk) {
+  atomic_fetch_sub_uint_least64_t(&totalMem, chunk);
+  shard->totalFreed += chunk;
 }
 
 
 static void
-resizeTable(int direction) {
+resizeTable(memTrackShard* shard, int direction) {
   memTableEntry** newMemTable = NULL;
   int newHashSizeIndex, newHashSize, newHashValue;
   int i;
   memTableEntry* me;
   memTableEntry* next;
 
-  newHashSizeIndex = hashSizeIndex + direction;
+  newHashSizeIndex = shard->hashSizeIndex + direction;
   newHashSize = hashSizes[newHashSizeIndex];
   newMemTable = calloc(newHashSize, sizeof(memTableEntry*));
 
-  for (i = 0; i < hashSize; i++) {
-    for (me = memTable[i]; me != NULL; me = next) {
+  for (i = 0; i < shard->hashSize; i++) {
+    for (me = shard->memTable[i]; me != NULL; me = next) {
       next = me->nextInBucket;
       newHashValue = hash(me->memAlloc, newHashSize);
       me->nextInBucket = newMemTable[newHashValue];
@@ -213,20 +290,22 @@ resizeTable(int direction) {
     }
   }
 
-  free(memTable);
-  memTable = newMemTable;
-  hashSize = newHashSize;
-  hashSizeIndex = newHashSizeIndex;
+  free(shard->memTable);
+  shard->memTable = newMemTable;
+  shard->hashSize = newHashSize;
+  shard->hashSizeIndex = newHashSizeIndex;
 }
 
-static void addMemTableEntry(void *memAlloc, size_t number, size_t size,
+static void addMemTableEntry(memTrackShard* shard,
+                             void *memAlloc, size_t number, size_t size,
                              chpl_mem_descInt_t description, int32_t lineno,
                              int32_t filename) {
   unsigned hashValue;
   memTableEntry* memEntry;
 
-  if ((totalEntries+1)*2 > hashSize && hashSizeIndex < NUM_HASH_SIZE_INDICES-1)
-    resizeTable(1);
+  if ((shard->totalEntries+1)*2 > shard->hashSize &&
+      shard->hashSizeIndex < NUM_HASH_SIZE_INDICES-1)
+    resizeTable(shard, 1);
 
   memEntry = (memTableEntry*) calloc(1, sizeof(memTableEntry));
   if (!memEntry) {
@@ -234,33 +313,34 @@ static void addMemTableEntry(void *memAlloc, size_t number, size_t size,
                lineno, filename);
   }
 
-  hashValue = hash(memAlloc, hashSize);
-  memEntry->nextInBucket = memTable[hashValue];
-  memTable[hashValue] = memEntry;
+  hashValue = hash(memAlloc, shard->hashSize);
+  memEntry->nextInBucket = shard->memTable[hashValue];
+  shard->memTable[hashValue] = memEntry;
   memEntry->description = description;
   memEntry->memAlloc = memAlloc;
   memEntry->lineno = lineno;
   memEntry->filename = filename;
   memEntry->number = number;
   memEntry->size = size;
-  increaseMemStat(number*size, lineno, filename);
-  totalEntries += 1;
+  increaseMemStat(shard, number*size, lineno, filename);
+  shard->totalEntries += 1;
 }
 
 
-static memTableEntry* removeMemTableEntry(void* address) {
-  unsigned hashValue = hash(address, hashSize);
-  memTableEntry* thisBucketEntry = memTable[hashValue];
+static memTableEntry* removeMemTableEntry(memTrackShard* shard,
+                                          void* address) {
+  unsigned hashValue = hash(address, shard->hashSize);
+  memTableEntry* thisBucketEntry = shard->memTable[hashValue];
   memTableEntry* deletedBucket = NULL;
 
   if (!thisBucketEntry)
     return NULL;
 
   if (thisBucketEntry->memAlloc == address) {
-    memTable[hashValue] = thisBucketEntry->nextInBucket;
+    shard->memTable[hashValue] = thisBucketEntry->nextInBucket;
     deletedBucket = thisBucketEntry;
   } else {
-    for (thisBucketEntry = memTable[hashValue];
+    for (thisBucketEntry = shard->memTable[hashValue];
          thisBucketEntry != NULL;
          thisBucketEntry = thisBucketEntry->nextInBucket) {
 
@@ -273,10 +353,10 @@ static memTableEntry* removeMemTableEntry(void* address) {
     }
   }
   if (deletedBucket) {
-    decreaseMemStat(deletedBucket->number * deletedBucket->size);
-    totalEntries -= 1;
-    if (totalEntries*8 < hashSize && hashSizeIndex > 0)
-      resizeTable(-1);
+    decreaseMemStat(shard, deletedBucket->number * deletedBucket->size);
+    shard->totalEntries -= 1;
+    if (shard->totalEntries*8 < shard->hashSize && shard->hashSizeIndex > 0)
+      resizeTable(shard, -1);
   }
   return deletedBucket;
 }
@@ -289,7 +369,21 @@ uint64_t chpl_memoryUsed(int32_t lineno, int32_t filename) {
     return 0;
   }
 
-  return (uint64_t)totalMem;
+  return atomic_load_uint_least64_t(&totalMem);
+}
+
+
+// Add up the statistics kept by the shards in the given table, which
+// may be a copy of another locale's.
+static void sumShardStats(memTrackShard* shards,
+                          size_t* allocated, size_t* freed) {
+  int i;
+  *allocated = 0;
+  *freed = 0;
+  for (i = 0; i < NUM_MEMTRACK_SHARDS; i++) {
+    *allocated += shards[i].totalAllocated;
+    *freed += shards[i].totalFreed;
+  }
 }
 
 
@@ -300,12 +394,15 @@ void chpl_printMemAllocStats(int32_t lineno, int32_t filename) {
     return;
   }
 
-  chpl_sync_lock(&memTrack_sync);
   fprintf(memLogFile, "=================\n");
   fprintf(memLogFile, "Memory Statistics\n");
+  if (memSample > 1)
+    fprintf(memLogFile, "(tracking 1 of every %zu allocations)\n", memSample);
   if (chpl_numNodes == 1) {
+    size_t totalAllocated, totalFreed;
+    sumShardStats(memTrackShards, &totalAllocated, &totalFreed);
     fprintf(memLogFile, "==============================================================\n");
-    fprintf(memLogFile, "Current Allocated Memory               %zd\n", totalMem);
+    fprintf(memLogFile, "Current Allocated Memory               %zd\n", totalAllocated - totalFreed);
     fprintf(memLogFile, "Maximum Simultaneous Allocated Memory  %zd\n", maxMem);
     fprintf(memLogFile, "Total Allocated Memory                 %zd\n", totalAllocated);
     fprintf(memLogFile, "Total Freed Memory                     %zd\n", totalFreed);
@@ -320,16 +417,18 @@ void chpl_printMemAllocStats(int32_t lineno, int32_t filename) {
     fprintf(memLogFile, "                                            Total Freed Memory\n");
     fprintf(memLogFile, "==============================================================\n");
     for (i = 0; i < chpl_numNodes; i++) {
-      static size_t m1, m2, m3, m4;
-      chpl_gen_comm_get(&m1, i, &totalMem, sizeof(size_t), -1 /* broke for hetero */, lineno, filename);
+      // Copy the remote shard table to read its statistics, but
+      // don't touch the locks in the copy.
+      static memTrackShard shards[NUM_MEMTRACK_SHARDS];
+      static size_t m2;
+      size_t m3, m4;
+      chpl_gen_comm_get(shards, i, memTrackShards, sizeof(memTrackShards), -1 /* broke for hetero */, lineno, filename);
       chpl_gen_comm_get(&m2, i, &maxMem, sizeof(size_t), -1 /* broke for hetero */, lineno, filename);
-      chpl_gen_comm_get(&m3, i, &totalAllocated,  sizeof(size_t), -1 /* broke for hetero */, lineno, filename);
-      chpl_gen_comm_get(&m4, i, &totalFreed, sizeof(size_t), -1 /*broke for hetero */, lineno, filename);
-      fprintf(memLogFile, "%-9d  %-9zu  %-9zu  %-9zu  %-9zu\n", i, m1, m2, m3, m4);
+      sumShardStats(shards, &m3, &m4);
+      fprintf(memLogFile, "%-9d  %-9zu  %-9zu  %-9zu  %-9zu\n", i, m3 - m4, m2, m3, m4);
     }
     fprintf(memLogFile, "==============================================================\n");
   }
-  chpl_sync_unlock(&memTrack_sync);
 }
 
 
@@ -343,7 +442,7 @@ static void printMemAllocsByType(_Bool forLeaks,
                                  int32_t lineno, int32_t filename) {
   size_t* table;
   memTableEntry* me;
-  int i;
+  int i, s;
   const int numberWidth   = 9;
   const int numEntries = CHPL_RT_MD_NUM+chpl_mem_numDescs;
 
@@ -356,13 +455,18 @@ static void printMemAllocsByType(_Bool forLeaks,
 
   table = (size_t*)calloc(numEntries, 3*sizeof(size_t));
 
-  for (i = 0; i < hashSize; i++) {
-    for (me = memTable[i]; me != NULL; me = me->nextInBucket) {
-      table[3*me->description] += me->number*me->size;
-      table[3*me->description+1] += 1;
-      table[3*me->description+2] = me->description;
+  lockAllShards();
+  for (s = 0; s < NUM_MEMTRACK_SHARDS; s++) {
+    memTrackShard* shard = &memTrackShards[s];
+    for (i = 0; i < shard->hashSize; i++) {
+      for (me = shard->memTable[i]; me != NULL; me = me->nextInBucket) {
+        table[3*me->description] += me->number*me->size;
+        table[3*me->description+1] += 1;
+        table[3*me->description+2] = me->description;
+      }
     }
   }
+  unlockAllShards();
 
   qsort(table, numEntries, 3*sizeof(size_t), memTableEntryCmp);
 
@@ -462,7 +566,7 @@ printMemAllocs(chpl_mem_descInt_t description, int64_t threshold,
 
   memTableEntry* memEntry;
   c_string memEntryFilename;
-  int n, i;
+  int n, i, s;
   char* loc;
   memTableEntry** table;
 
@@ -472,21 +576,28 @@ printMemAllocs(chpl_mem_descInt_t description, int64_t threshold,
     return;
   }
 
+  // Hold on to all of the shards until we have finished printing
+  // their entries.
+  lockAllShards();
+
   n = 0;
   filenameWidth = strlen("Allocated Memory (Bytes)");
-  for (i = 0; i < hashSize; i++) {
-    for (memEntry = memTable[i]; memEntry != NULL; memEntry = memEntry->nextInBucket) {
-      size_t chunk = memEntry->number * memEntry->size;
-      if (chunk < threshold)
-        continue;
-      if (description != -1 && memEntry->description != description)
-        continue;
-      n += 1;
-      if (memEntry->filename) {
-        memEntryFilename = chpl_lookupFilename(memEntry->filename);
-        filenameLength = strlen(memEntryFilename);
-        if (filenameLength > filenameWidth)
-          filenameWidth = filenameLength;
+  for (s = 0; s < NUM_MEMTRACK_SHARDS; s++) {
+    memTrackShard* shard = &memTrackShards[s];
+    for (i = 0; i < shard->hashSize; i++) {
+      for (memEntry = shard->memTable[i]; memEntry != NULL; memEntry = memEntry->nextInBucket) {
+        size_t chunk = memEntry->number * memEntry->size;
+        if (chunk < threshold)
+          continue;
+        if (description != -1 && memEntry->description != description)
+          continue;
+        n += 1;
+        if (memEntry->filename) {
+          memEntryFilename = chpl_lookupFilename(memEntry->filename);
+          filenameLength = strlen(memEntryFilename);
+          if (filenameLength > filenameWidth)
+            filenameWidth = filenameLength;
+        }
       }
     }
   }
@@ -511,14 +622,17 @@ printMemAllocs(chpl_mem_descInt_t description, int64_t threshold,
     chpl_error("out of memory printing memory table", lineno, filename);
 
   n = 0;
-  for (i = 0; i < hashSize; i++) {
-    for (memEntry = memTable[i]; memEntry != NULL; memEntry = memEntry->nextInBucket) {
-      size_t chunk = memEntry->number * memEntry->size;
-      if (chunk < threshold)
-        continue;
-      if (description != -1 && memEntry->description != description)
-        continue;
-      table[n++] = memEntry;
+  for (s = 0; s < NUM_MEMTRACK_SHARDS; s++) {
+    memTrackShard* shard = &memTrackShards[s];
+    for (i = 0; i < shard->hashSize; i++) {
+      for (memEntry = shard->memTable[i]; memEntry != NULL; memEntry = memEntry->nextInBucket) {
+        size_t chunk = memEntry->number * memEntry->size;
+        if (chunk < threshold)
+          continue;
+        if (description != -1 && memEntry->description != description)
+          continue;
+        table[n++] = memEntry;
+      }
     }
   }
   qsort(table, n, sizeof(memTableEntry*), descCmp);
@@ -546,6 +660,8 @@ printMemAllocs(chpl_mem_descInt_t description, int64_t threshold,
   fprintf(memLogFile, "\n");
   putchar('\n');
 
+  unlockAllShards();
+
   free(table);
   free(loc);
 }
@@ -586,10 +702,12 @@ void chpl_track_malloc(void* memAlloc, size_t number, size_t size,
                        chpl_mem_descInt_t description,
                        int32_t lineno, int32_t filename) {
   if (number * size > memThreshold) {
-    if (chpl_memTrack && chpl_mem_descTrack(description)) {
-      chpl_sync_lock(&memTrack_sync);
-      addMemTableEntry(memAlloc, number, size, description, lineno, filename);
-      chpl_sync_unlock(&memTrack_sync);
+    if (chpl_memTrack && chpl_mem_descTrack(description) && sampleAlloc()) {
+      memTrackShard* shard = getShard(memAlloc);
+      chpl_sync_lock(&shard->sync);
+      addMemTableEntry(shard, memAlloc, number, size, description,
+                       lineno, filename);
+      chpl_sync_unlock(&shard->sync);
     }
     if (chpl_verbose_mem) {
       fprintf(memLogFile, "%" FORMAT_c_nodeid_t ": %s:%" PRId32
@@ -605,8 +723,9 @@ void chpl_track_malloc(void* memAlloc, size_t number, size_t size,
 void chpl_track_free(void* memAlloc, int32_t lineno, int32_t filename) {
   memTableEntry* memEntry = NULL;
   if (chpl_memTrack) {
-    chpl_sync_lock(&memTrack_sync);
-    memEntry = removeMemTableEntry(memAlloc);
+    memTrackShard* shard = getShard(memAlloc);
+    chpl_sync_lock(&shard->sync);
+    memEntry = removeMemTableEntry(shard, memAlloc);
     if (memEntry) {
       if (chpl_verbose_mem) {
         fprintf(memLogFile, "%" FORMAT_c_nodeid_t ": %s:%" PRId32
@@ -617,7 +736,7 @@ void chpl_track_free(void* memAlloc, int32_t lineno, int32_t filename) {
       }
       free(memEntry);
     }
-    chpl_sync_unlock(&memTrack_sync);
+    chpl_sync_unlock(&shard->sync);
   } else if (chpl_verbose_mem && !memEntry) {
     fprintf(memLogFile, "%" FORMAT_c_nodeid_t ": %s:%" PRId32 ": free at %p\n",
             chpl_nodeID, (filename ? chpl_lookupFilename(filename) : "--"),
@@ -631,14 +750,13 @@ void chpl_track_realloc_pre(void* memAlloc, size_t size,
                          int32_t lineno, int32_t filename) {
   memTableEntry* memEntry = NULL;
 
-  if (chpl_memTrack && size > memThreshold) {
-    chpl_sync_lock(&memTrack_sync);
-    if (memAlloc) {
-      memEntry = removeMemTableEntry(memAlloc);
-      if (memEntry)
-        free(memEntry);
-    }
-    chpl_sync_unlock(&memTrack_sync);
+  if (chpl_memTrack && size > memThreshold && memAlloc) {
+    memTrackShard* shard = getShard(memAlloc);
+    chpl_sync_lock(&shard->sync);
+    memEntry = removeMemTableEntry(shard, memAlloc);
+    if (memEntry)
+      free(memEntry);
+    chpl_sync_unlock(&shard->sync);
   }
 }
 
@@ -648,10 +766,12 @@ void chpl_track_realloc_post(void* moreMemAlloc,
                          chpl_mem_descInt_t description,
                          int32_t lineno, int32_t filename) {
   if (size > memThreshold) {
-    if (chpl_memTrack && chpl_mem_descTrack(description)) {
-      chpl_sync_lock(&memTrack_sync);
-      addMemTableEntry(moreMemAlloc, 1, size, description, lineno, filename);
-      chpl_sync_unlock(&memTrack_sync);
+    if (chpl_memTrack && chpl_mem_descTrack(description) && sampleAlloc()) {
+      memTrackShard* shard = getShard(moreMemAlloc);
+      chpl_sync_lock(&shard->sync);
+      addMemTableEntry(shard, moreMemAlloc, 1, size, description,
+                       lineno, filename);
+      chpl_sync_unlock(&shard->sync);
     }
     if (chpl_verbose_mem) {
       fprintf(memLogFile, "%" FORMAT_c_nodeid_t ": %s:%" PRId32
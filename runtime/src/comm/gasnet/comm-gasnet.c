@@ -26,6 +26,7 @@
 #include "chpl-comm.h"
 #include "chpl-mem.h"
 #include "chplsys.h"
+#include "chpl-env.h"
 #include "chpl-tasks.h"
 #include "chplcgfns.h"
 #include "chpl-gen-includes.h"
@@ -41,6 +42,7 @@
 
 #include <signal.h>
 #include <sched.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -99,24 +101,6 @@ void* get_ptr_from_args(gasnet_handlerarg_t a0, gasnet_handlerarg_t a1 )
     }                                                                   \
   } while(0)
 
-//
-// Adapted from the above, this one is for the case where the caller
-// needs to do the fncall separately (see chpl_comm_barrier()).  Here
-// the fn is not actually called; fncall is only used to produce the
-// message.
-//
-#define GASNET_Safe_Retval(fncall, _retval) do {                        \
-    if (_retval != GASNET_OK) {                                         \
-      fprintf(stderr, "ERROR calling: %s\n"                             \
-              " at: %s:%i\n"                                            \
-              " error: %s (%s)\n",                                      \
-              #fncall, __FILE__, __LINE__,                              \
-              gasnet_ErrorName(_retval), gasnet_ErrorDesc(_retval));    \
-      fflush(stderr);                                                   \
-      gasnet_exit(_retval);                                             \
-    }                                                                   \
-  } while(0)
-
 //
 // This is the type of object we use to manage GASNet acknowledgements.
 //
@@ -167,20 +151,20 @@ typedef struct {
   char          arg[0];       // variable-sized data here
 } fork_t;
 
-typedef struct {
-  void*   ack;
-  int     id;       // private broadcast table entry to update
-  int     size;     // size of data
-  char    data[0];  // data
-} priv_bcast_t;
+typedef enum {
+  BCAST_PRIVATE,        // an entry in chpl_private_broadcast_table[]
+  BCAST_GLOBALS         // the wide pointers for chpl_globals_registry[]
+} tree_bcast_kind_t;
 
 typedef struct {
-  void* ack;
-  int   id;       // private broadcast table entry to update
-  int   size;     // size of data
-  int   offset;   // offset of piece of data
-  char  data[0];  // data
-} priv_bcast_large_t;
+  void*      ack;       // done_t on the sender
+  c_nodeid_t root;      // node the broadcast started from
+  int        kind;      // a tree_bcast_kind_t
+  int        id;        // private broadcast table entry to update
+  size_t     offset;    // offset of piece of data
+  size_t     size;      // size of piece of data
+  char       data[0];   // data
+} tree_bcast_t;
 
 typedef struct {
   void* ack; // acknowledgement object
@@ -201,13 +185,19 @@ typedef enum {
   FORK_FAST,            // run the function in the handler (use with care)
   SIGNAL,               // ack to a done_t via gasnet_AMReplyShortM()
   SIGNAL_LONG,          // ack to a done_t via gasnet_AMReplyLongM()
-  PRIV_BCAST,           // put data at addr (used for private broadcast)
-  PRIV_BCAST_LARGE,     // put data at addr (used for private broadcast)
+  TREE_BCAST,           // store data here and pass it down the tree
+  BARRIER_SIGNAL,       // a dissemination barrier partner arrived
   FREE,                 // free data at addr
   EXIT_ANY,             // <unused> to be used for exit_any() cleanup
   BCAST_SEGINFO,        // broadcast for segment info table
   DO_REPLY_PUT,         // do a PUT here from another locale
-  DO_COPY_PAYLOAD       // copy AM payload to another address
+  DO_COPY_PAYLOAD,      // copy AM payload to another address
+  AGG_PUT,              // do a batch of aggregated PUTs here
+  AGG_PUT_ACK,          // ack to an AGG_PUT
+  AGG_GET,              // reply with the data for a batch of GETs
+  AGG_GET_REPLY,        // data for a batch of GETs
+  FORK_BATCH,           // run a batch of blocking 'on' bodies in one task
+  FORK_BATCH_DONE       // ack to a FORK_BATCH
 } AM_handler_function_idx_t;
 
 static void AM_fork_fast(gasnet_token_t token, void* buf, size_t nbytes) {
@@ -228,6 +218,8 @@ static void fork_wrapper(fork_t *f) {
     chpl_ftable_call(f->fid, &f->arg);
   else
     chpl_ftable_call(f->fid, NULL);
+  // The caller may read what we wrote as soon as it sees the signal.
+  chpl_comm_aggregate_flush();
   GASNET_Safe(gasnet_AMRequestShort2(f->caller, SIGNAL,
                                      AckArg0(f->ack), AckArg1(f->ack)));
 
@@ -259,6 +251,7 @@ static void fork_large_wrapper(fork_t* f) {
   chpl_comm_get(arg, f->caller, f_arg, f->arg_size, -1 /*typeIndex: unused*/,
                 0, CHPL_FILE_IDX_FORK_LARGE);
   chpl_ftable_call(f->fid, arg);
+  chpl_comm_aggregate_flush();
   GASNET_Safe(gasnet_AMRequestShort2(f->caller, SIGNAL,
                                      AckArg0(f->ack), AckArg1(f->ack)));
 
@@ -347,24 +340,6 @@ static void AM_signal_long(gasnet_token_t token, void *buf, size_t nbytes,
     done->flag = 1;
 }
 
-static void AM_priv_bcast(gasnet_token_t token, void* buf, size_t nbytes) {
-  priv_bcast_t* pbp = buf;
-  chpl_memcpy(chpl_private_broadcast_table[pbp->id], pbp->data, pbp->size);
-
-  // Signal that the handler has completed
-  GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL,
-                                   AckArg0(pbp->ack), AckArg1(pbp->ack)));
-}
-
-static void AM_priv_bcast_large(gasnet_token_t token, void* buf, size_t nbytes) {
-  priv_bcast_large_t* pblp = buf;
-  chpl_memcpy((char*)chpl_private_broadcast_table[pblp->id]+pblp->offset, pblp->data, pblp->size);
-
-  // Signal that the handler has completed
-  GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL,
-                                   AckArg0(pblp->ack), AckArg1(pblp->ack)));
-}
-
 static void AM_free(gasnet_token_t token, void* buf, size_t nbytes) {
   fork_t* f;
   void* f_arg;
@@ -426,6 +401,843 @@ void AM_copy_payload(gasnet_token_t token, void* buf, size_t nbytes,
   GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL, ack0, ack1));
 }
 
+////////////////////////////////////////////////////////////////////////////
+//
+// Aggregation of small PUTs and GETs
+//
+// When CHPL_RT_COMM_AGGREGATE is set, PUTs of at most agg_max_size bytes
+// are not sent right away.  They are appended to a buffer for the
+// destination node, and the whole buffer goes out as one AGG_PUT active
+// message when it is full, when it has waited longer than agg_timeout_us
+// (the polling task checks this), or when something needs the PUTs to
+// be complete.  The target copies each PUT into place and replies with
+// an AGG_PUT_ACK.  Only one batch per destination is in flight at a time,
+// so PUTs to the same address land in the order they were made.
+//
+// An aggregated PUT is only known to be complete after a flush.  To keep
+// the memory model intact we flush:
+//   - the destination's buffer before any other PUT or GET to that node,
+//     so a task reads its own writes and larger transfers can't overtake
+//     smaller ones;
+//   - every buffer before starting an 'on' body, local or remote, or a
+//     task for one, before an AM that reports that an 'on' body has
+//     finished, and before a barrier, since whoever runs next may read
+//     the data;
+//   - every buffer at a release fence (chpl_rmem_consist_release()).
+//     Sync variables always do one.  Atomic operations with release or
+//     seq_cst order do one too: the compiler adds the memory consistency
+//     calls to the atomic methods for CHPL_COMM=gasnet, not only with
+//     --cache-remote.
+//
+// Small GETs are combined rather than buffered, since the task asking
+// has to wait for the data anyway.  A GET to a node that has no GET
+// outstanding is done directly.  GETs that other tasks make in the
+// meantime are collected into a batch, which is sent as one AGG_GET as
+// soon as the outstanding GET completes.  The AGG_GET_REPLY carries all
+// of the data, and its handler scatters it into place.  A lone task sees
+// no extra latency, while many tasks reading from one node share
+// messages.
+//
+
+chpl_bool chpl_comm_aggregating = false;
+
+static size_t   agg_max_size;      // largest PUT or GET we aggregate
+static size_t   agg_buf_size;      // bytes per PUT buffer or GET batch
+static uint64_t agg_timeout_us;    // how long a PUT may sit in a buffer
+static size_t   agg_get_max_count; // GETs per batch
+
+// In a PUT buffer, each PUT is this header followed by the data, padded
+// so that the next header is 8-byte aligned.
+typedef struct {
+  uint64_t raddr;
+  uint64_t size;
+} agg_xfer_t;
+
+#define AGG_PAD(size) (((size) + 7) & ~((size_t) 7))
+
+// A batch of GETs to one node.  The requests are sent as the AGG_GET
+// payload; addrs[] are the local destinations for the replied data.
+typedef struct {
+  c_nodeid_t            node;
+  atomic_uint_least32_t refs;   // tasks still waiting on this batch
+  volatile int          done;
+  size_t                count;
+  size_t                reply_len;
+  agg_xfer_t*           reqs;
+  void**                addrs;
+} agg_get_batch_t;
+
+typedef struct {
+  chpl_sync_aux_t       lock;
+  char*                 put_buf;
+  size_t                put_len;
+  gasnett_tick_t        put_start;  // when put_buf became non-empty
+  uint64_t              put_sent;   // PUT batches sent
+  atomic_uint_least64_t put_acked;  // PUT batches acknowledged
+  atomic_uint_least32_t get_busy;   // a GET or GET batch is outstanding
+  agg_get_batch_t*      get_batch;  // GETs waiting for get_busy to clear
+} agg_node_t;
+
+static agg_node_t* agg_nodes;
+
+// Aggregated PUTs that have not yet been acknowledged, on all nodes.
+static atomic_uint_least64_t agg_puts_pending;
+
+static void AM_agg_put(gasnet_token_t token, void* buf, size_t nbytes) {
+  char* p = (char*) buf;
+  char* end = p + nbytes;
+  uint32_t count = 0;
+
+  while (p < end) {
+    agg_xfer_t x;
+    chpl_memcpy(&x, p, sizeof(x));
+    p += sizeof(x);
+    memcpy((void*)(uintptr_t) x.raddr, p, x.size);
+    p += AGG_PAD(x.size);
+    count++;
+  }
+
+  GASNET_Safe(gasnet_AMReplyShort1(token, AGG_PUT_ACK, count));
+}
+
+static void AM_agg_put_ack(gasnet_token_t token, gasnet_handlerarg_t count) {
+  gasnet_node_t src;
+
+  GASNET_Safe(gasnet_AMGetMsgSource(token, &src));
+  atomic_fetch_sub_uint_least64_t(&agg_puts_pending, (uint32_t) count);
+  atomic_fetch_add_uint_least64_t(&agg_nodes[src].put_acked, 1);
+}
+
+static void AM_agg_get(gasnet_token_t token, void* buf, size_t nbytes,
+                       gasnet_handlerarg_t a0, gasnet_handlerarg_t a1) {
+  size_t count = nbytes / sizeof(agg_xfer_t);
+  size_t total = 0;
+  size_t i;
+  char* reply;
+  char* p;
+
+  for (i = 0; i < count; i++)
+    total += ((agg_xfer_t*) buf)[i].size;
+
+  reply = chpl_mem_alloc(total, CHPL_RT_MD_COMM_XMIT_RCV_BUF, 0, 0);
+  for (p = reply, i = 0; i < count; i++) {
+    agg_xfer_t* x = &((agg_xfer_t*) buf)[i];
+    memcpy(p, (void*)(uintptr_t) x->raddr, x->size);
+    p += x->size;
+  }
+
+  GASNET_Safe(gasnet_AMReplyMedium2(token, AGG_GET_REPLY, reply, total,
+                                    a0, a1));
+  chpl_mem_free(reply, 0, 0);
+}
+
+static void AM_agg_get_reply(gasnet_token_t token, void* buf, size_t nbytes,
+                             gasnet_handlerarg_t a0, gasnet_handlerarg_t a1) {
+  agg_get_batch_t* b = (agg_get_batch_t*) get_ptr_from_args(a0, a1);
+  char* p = (char*) buf;
+  size_t i;
+
+  for (i = 0; i < b->count; i++) {
+    memcpy(b->addrs[i], p, b->reqs[i].size);
+    p += b->reqs[i].size;
+  }
+
+  // The waiting tasks may free the batch as soon as done is set, so
+  // this must be the last thing we do with it.
+  atomic_store_uint_least32_t(&agg_nodes[b->node].get_busy, 0);
+  gasnett_local_wmb();
+  b->done = 1;
+}
+
+static void agg_init(void) {
+  int i;
+
+  chpl_comm_aggregating = chpl_get_rt_env_bool("COMM_AGGREGATE", false);
+  if (!chpl_comm_aggregating)
+    return;
+
+  agg_max_size = chpl_get_rt_env_size("COMM_AGGREGATE_MAX_SIZE", 64);
+  agg_buf_size = chpl_get_rt_env_size("COMM_AGGREGATE_BUFFER_SIZE", 8192);
+  agg_timeout_us = chpl_get_rt_env_int("COMM_AGGREGATE_TIMEOUT", 100);
+
+  if (agg_buf_size > gasnet_AMMaxMedium())
+    agg_buf_size = gasnet_AMMaxMedium();
+  if (agg_max_size + sizeof(agg_xfer_t) > agg_buf_size)
+    agg_max_size = agg_buf_size - sizeof(agg_xfer_t);
+  agg_get_max_count = agg_buf_size / sizeof(agg_xfer_t);
+
+  agg_nodes = chpl_mem_allocManyZero(chpl_numNodes, sizeof(agg_node_t),
+                                     CHPL_RT_MD_COMM_PER_LOC_INFO, 0, 0);
+  for (i = 0; i < chpl_numNodes; i++) {
+    chpl_sync_initAux(&agg_nodes[i].lock);
+    atomic_init_uint_least64_t(&agg_nodes[i].put_acked, 0);
+    atomic_init_uint_least32_t(&agg_nodes[i].get_busy, 0);
+  }
+  atomic_init_uint_least64_t(&agg_puts_pending, 0);
+}
+
+static inline
+void agg_wait(void) {
+  (void) gasnet_AMPoll();
+  chpl_task_yield();
+}
+
+//
+// Send node's PUT buffer if it isn't empty and the previous batch has
+// been acknowledged.  Must be called with the node's lock held; the
+// AM payload is copied before gasnet_AMRequestMedium0() returns, so the
+// buffer can be reused right away.
+//
+static void agg_put_send_locked(c_nodeid_t node, agg_node_t* n) {
+  if (n->put_len == 0 ||
+      n->put_sent != atomic_load_uint_least64_t(&n->put_acked))
+    return;
+
+  n->put_sent++;
+  GASNET_Safe(gasnet_AMRequestMedium0(node, AGG_PUT, n->put_buf, n->put_len));
+  n->put_len = 0;
+}
+
+static void agg_put(void* addr, c_nodeid_t node, void* raddr, size_t size) {
+  agg_node_t* n = &agg_nodes[node];
+  size_t need = sizeof(agg_xfer_t) + AGG_PAD(size);
+  agg_xfer_t x;
+
+  chpl_sync_lock(&n->lock);
+
+  if (n->put_buf == NULL)
+    n->put_buf = chpl_mem_alloc(agg_buf_size, CHPL_RT_MD_COMM_XMIT_RCV_BUF,
+                                0, 0);
+
+  // If there is no room, send the buffer, waiting for the previous
+  // batch to be acknowledged first if need be.
+  while (n->put_len + need > agg_buf_size) {
+    agg_put_send_locked(node, n);
+    if (n->put_len + need <= agg_buf_size)
+      break;
+    chpl_sync_unlock(&n->lock);
+    agg_wait();
+    chpl_sync_lock(&n->lock);
+  }
+
+  if (n->put_len == 0)
+    n->put_start = gasnett_ticks_now();
+
+  x.raddr = (uint64_t)(uintptr_t) raddr;
+  x.size = size;
+  chpl_memcpy(n->put_buf + n->put_len, &x, sizeof(x));
+  chpl_memcpy(n->put_buf + n->put_len + sizeof(x), addr, size);
+  n->put_len += need;
+  atomic_fetch_add_uint_least64_t(&agg_puts_pending, 1);
+
+  chpl_sync_unlock(&n->lock);
+}
+
+//
+// Make sure every PUT to node aggregated before this call has completed.
+//
+static void agg_put_flush(c_nodeid_t node) {
+  agg_node_t* n = &agg_nodes[node];
+  uint64_t target;
+
+  if (atomic_load_uint_least64_t(&agg_puts_pending) == 0)
+    return;
+
+  chpl_sync_lock(&n->lock);
+  target = n->put_sent + (n->put_len > 0 ? 1 : 0);
+  agg_put_send_locked(node, n);
+  chpl_sync_unlock(&n->lock);
+
+  while (atomic_load_uint_least64_t(&n->put_acked) < target) {
+    agg_wait();
+    chpl_sync_lock(&n->lock);
+    agg_put_send_locked(node, n);
+    chpl_sync_unlock(&n->lock);
+  }
+}
+
+void chpl_comm_aggregate_flush(void) {
+  int node;
+
+  if (!chpl_comm_aggregating ||
+      atomic_load_uint_least64_t(&agg_puts_pending) == 0)
+    return;
+
+  // Start all of the sends before waiting on any of them.
+  for (node = 0; node < chpl_numNodes; node++) {
+    chpl_sync_lock(&agg_nodes[node].lock);
+    agg_put_send_locked(node, &agg_nodes[node]);
+    chpl_sync_unlock(&agg_nodes[node].lock);
+  }
+  for (node = 0; node < chpl_numNodes; node++)
+    agg_put_flush(node);
+}
+
+//
+// Called by the polling task to send PUT buffers that have waited too
+// long.  We look at put_len without the lock first since this runs
+// constantly; a stale value only delays the send to the next call.
+//
+static void agg_poll(void) {
+  static gasnett_tick_t last_check;
+  gasnett_tick_t now;
+  int node;
+
+  if (atomic_load_uint_least64_t(&agg_puts_pending) == 0)
+    return;
+
+  now = gasnett_ticks_now();
+  if (gasnett_ticks_to_us(now - last_check) < agg_timeout_us / 2)
+    return;
+  last_check = now;
+
+  for (node = 0; node < chpl_numNodes; node++) {
+    agg_node_t* n = &agg_nodes[node];
+    if (n->put_len == 0)
+      continue;
+    chpl_sync_lock(&n->lock);
+    if (n->put_len > 0 &&
+        gasnett_ticks_to_us(now - n->put_start) >= agg_timeout_us)
+      agg_put_send_locked(node, n);
+    chpl_sync_unlock(&n->lock);
+  }
+}
+
+//
+// Send node's pending GET batch if there is one and no other GET is
+// outstanding.  Must be called with the node's lock held.
+//
+static void agg_get_send_locked(c_nodeid_t node, agg_node_t* n) {
+  agg_get_batch_t* b = n->get_batch;
+
+  if (b == NULL || atomic_load_uint_least32_t(&n->get_busy) != 0)
+    return;
+
+  n->get_batch = NULL;
+  atomic_store_uint_least32_t(&n->get_busy, 1);
+  GASNET_Safe(gasnet_AMRequestMedium2(node, AGG_GET, b->reqs,
+                                      b->count * sizeof(agg_xfer_t),
+                                      AckArg0(b), AckArg1(b)));
+}
+
+static void do_remote_get(void* addr, c_nodeid_t node, void* raddr,
+                          size_t size);
+
+static void agg_get(void* addr, c_nodeid_t node, void* raddr, size_t size) {
+  agg_node_t* n = &agg_nodes[node];
+  agg_get_batch_t* b;
+
+  chpl_sync_lock(&n->lock);
+
+  // Nothing outstanding: do this GET directly, and let any GETs that
+  // arrive in the meantime collect into a batch.
+  if (atomic_load_uint_least32_t(&n->get_busy) == 0 && n->get_batch == NULL) {
+    atomic_store_uint_least32_t(&n->get_busy, 1);
+    chpl_sync_unlock(&n->lock);
+
+    do_remote_get(addr, node, raddr, size);
+
+    chpl_sync_lock(&n->lock);
+    atomic_store_uint_least32_t(&n->get_busy, 0);
+    agg_get_send_locked(node, n);
+    chpl_sync_unlock(&n->lock);
+    return;
+  }
+
+  // Otherwise join the batch being collected, starting a new one if
+  // there isn't one or it is full.
+  while ((b = n->get_batch) != NULL &&
+         (b->count == agg_get_max_count ||
+          b->reply_len + size > agg_buf_size)) {
+    agg_get_send_locked(node, n);
+    if (n->get_batch == b) {
+      chpl_sync_unlock(&n->lock);
+      agg_wait();
+      chpl_sync_lock(&n->lock);
+    }
+  }
+
+  if (b == NULL) {
+    b = chpl_mem_alloc(sizeof(agg_get_batch_t) +
+                       agg_get_max_count * (sizeof(agg_xfer_t) +
+                                            sizeof(void*)),
+                       CHPL_RT_MD_COMM_XMIT_RCV_BUF, 0, 0);
+    b->node = node;
+    atomic_init_uint_least32_t(&b->refs, 0);
+    b->done = 0;
+    b->count = 0;
+    b->reply_len = 0;
+    b->reqs = (agg_xfer_t*) (b + 1);
+    b->addrs = (void**) (b->reqs + agg_get_max_count);
+    n->get_batch = b;
+  }
+
+  b->reqs[b->count].raddr = (uint64_t)(uintptr_t) raddr;
+  b->reqs[b->count].size = size;
+  b->addrs[b->count] = addr;
+  b->count++;
+  b->reply_len += size;
+  atomic_fetch_add_uint_least32_t(&b->refs, 1);
+
+  agg_get_send_locked(node, n);
+  chpl_sync_unlock(&n->lock);
+
+  // Wait for the reply.  Whoever notices get_busy clear sends the batch.
+  while (!b->done) {
+    agg_wait();
+    if (!b->done && atomic_load_uint_least32_t(&n->get_busy) == 0) {
+      chpl_sync_lock(&n->lock);
+      agg_get_send_locked(node, n);
+      chpl_sync_unlock(&n->lock);
+    }
+  }
+
+  if (atomic_fetch_sub_uint_least32_t(&b->refs, 1) == 1)
+    chpl_mem_free(b, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////
+//
+// Batched 'on' statements
+//
+// The compiler calls chpl_comm_execute_on_batch() instead of
+// chpl_comm_execute_on() for a blocking 'on' statement whose body never
+// waits for another task, when it appears in an order-independent loop
+// (typically a forall).  Such bodies can be run one after another in a
+// single task on the target without risk of deadlock.
+//
+// As with GETs above, we combine rather than delay.  An 'on' to a node
+// with nothing outstanding goes out as an ordinary FORK.  'on's that
+// other tasks start in the meantime are collected into a batch, which
+// is sent as one FORK_BATCH as soon as nothing is outstanding or it is
+// full.  The target runs the whole batch in one task and answers with a
+// single FORK_BATCH_DONE.  A lone task sees no extra latency, while many
+// tasks hammering one node share both messages and task creation.
+//
+// What is outstanding may itself be waiting, through a nested 'on', on
+// a task that has joined the batch.  So a batch that has waited longer
+// than batch_timeout_us is sent regardless.
+//
+// CHPL_RT_COMM_BATCH_ON (default true) turns this on or off,
+// CHPL_RT_COMM_BATCH_ON_SIZE (default 16) limits the number of 'on'
+// bodies in a batch, and CHPL_RT_COMM_BATCH_ON_TIMEOUT (default 100)
+// sets batch_timeout_us.
+//
+
+static chpl_bool batch_on;
+static uint32_t  batch_max_count; // 'on' bodies per batch
+static size_t    batch_buf_size;  // bytes of records per batch
+static uint64_t  batch_timeout_us; // how long a batch may wait to be sent
+
+// Each 'on' body in a FORK_BATCH payload is this header followed by the
+// argument bundle, padded so that the next header and every bundle are
+// 16-byte aligned.
+typedef struct {
+  chpl_fn_int_t fid;
+  chpl_bool     serial_state;
+  uint32_t      arg_size;
+} batch_rec_t;
+
+#define BATCH_PAD(size) (((size) + 15) & ~((size_t) 15))
+
+// The target's copy of a FORK_BATCH payload; the records follow the
+// header at BATCH_PAD(sizeof(fork_batch_t)).
+typedef struct {
+  c_nodeid_t caller;
+  void*      ack;
+  size_t     len;
+} fork_batch_t;
+
+// A batch of 'on' bodies for one node and sublocale.  The records are
+// kept at BATCH_PAD(sizeof(batch_t)) past the start.
+typedef struct {
+  c_nodeid_t            node;
+  c_sublocid_t          subloc;
+  atomic_uint_least32_t refs;   // tasks still waiting on this batch
+  volatile int          done;
+  gasnett_tick_t        start;  // when the batch was started
+  uint32_t              count;
+  size_t                len;
+} batch_t;
+
+#define BATCH_RECS(b) ((char*) (b) + BATCH_PAD(sizeof(batch_t)))
+
+typedef struct {
+  chpl_sync_aux_t       lock;
+  atomic_uint_least32_t outstanding; // 'on's and batches in flight
+  batch_t*              batch;       // 'on's waiting to be sent
+} batch_node_t;
+
+static batch_node_t* batch_nodes;
+
+static void fork_batch_wrapper(fork_batch_t* f) {
+  char* p = (char*) f + BATCH_PAD(sizeof(fork_batch_t));
+  char* end = p + f->len;
+
+  while (p < end) {
+    batch_rec_t* r = (batch_rec_t*) p;
+    char* arg = p + BATCH_PAD(sizeof(batch_rec_t));
+
+    chpl_task_setSerial(r->serial_state);
+    chpl_ftable_call(r->fid, r->arg_size ? arg : NULL);
+    p = arg + BATCH_PAD(r->arg_size);
+  }
+
+  // The caller may read what we wrote as soon as it sees the signal.
+  chpl_comm_aggregate_flush();
+  GASNET_Safe(gasnet_AMRequestShort2(f->caller, FORK_BATCH_DONE,
+                                     AckArg0(f->ack), AckArg1(f->ack)));
+
+  chpl_mem_free(f, 0, 0);
+}
+
+static void AM_fork_batch(gasnet_token_t token, void* buf, size_t nbytes,
+                          gasnet_handlerarg_t subloc,
+                          gasnet_handlerarg_t a0, gasnet_handlerarg_t a1) {
+  size_t hdr_size = BATCH_PAD(sizeof(fork_batch_t));
+  fork_batch_t* f = chpl_mem_allocMany(1, hdr_size + nbytes,
+                                       CHPL_RT_MD_COMM_FRK_RCV_INFO, 0, 0);
+  gasnet_node_t src;
+
+  GASNET_Safe(gasnet_AMGetMsgSource(token, &src));
+  f->caller = src;
+  f->ack = get_ptr_from_args(a0, a1);
+  f->len = nbytes;
+  chpl_memcpy((char*) f + hdr_size, buf, nbytes);
+  chpl_task_startMovedTask((chpl_fn_p)fork_batch_wrapper, (void*)f,
+                           (c_sublocid_t) subloc, chpl_nullTaskID, false);
+}
+
+static void AM_fork_batch_done(gasnet_token_t token,
+                               gasnet_handlerarg_t a0, gasnet_handlerarg_t a1) {
+  batch_t* b = (batch_t*) get_ptr_from_args(a0, a1);
+
+  // The waiting tasks may free the batch as soon as done is set, so
+  // this must be the last thing we do with it.
+  atomic_fetch_sub_uint_least32_t(&batch_nodes[b->node].outstanding, 1);
+  gasnett_local_wmb();
+  b->done = 1;
+}
+
+static void batch_init(void) {
+  int64_t max_count, fit;
+  int i;
+
+  batch_on = chpl_get_rt_env_bool("COMM_BATCH_ON", true);
+  if (!batch_on)
+    return;
+
+  max_count = chpl_get_rt_env_int("COMM_BATCH_ON_SIZE", 16);
+  if (max_count < 2) {
+    batch_on = false;
+    return;
+  }
+  batch_buf_size = gasnet_AMMaxMedium();
+  // Every record takes at least a padded header, so no more than this
+  // many fit in a batch anyway.
+  fit = (int64_t) (batch_buf_size / BATCH_PAD(sizeof(batch_rec_t)));
+  if (max_count > fit)
+    max_count = fit;
+  batch_max_count = (uint32_t) max_count;
+  batch_timeout_us = chpl_get_rt_env_int("COMM_BATCH_ON_TIMEOUT", 100);
+
+  batch_nodes = chpl_mem_allocManyZero(chpl_numNodes, sizeof(batch_node_t),
+                                       CHPL_RT_MD_COMM_PER_LOC_INFO, 0, 0);
+  for (i = 0; i < chpl_numNodes; i++) {
+    chpl_sync_initAux(&batch_nodes[i].lock);
+    atomic_init_uint_least32_t(&batch_nodes[i].outstanding, 0);
+  }
+}
+
+//
+// Send node's pending batch if there is one, and either nothing else is
+// outstanding or force is set.  Must be called with the node's lock
+// held.
+//
+static void batch_send_locked(c_nodeid_t node, batch_node_t* n,
+                              chpl_bool force) {
+  batch_t* b = n->batch;
+
+  if (b == NULL ||
+      (!force && atomic_load_uint_least32_t(&n->outstanding) != 0))
+    return;
+
+  n->batch = NULL;
+  atomic_fetch_add_uint_least32_t(&n->outstanding, 1);
+  GASNET_Safe(gasnet_AMRequestMedium3(node, FORK_BATCH, BATCH_RECS(b), b->len,
+                                      b->subloc, AckArg0(b), AckArg1(b)));
+}
+
+static void batch_execute_on(c_nodeid_t node, c_sublocid_t subloc,
+                             chpl_fn_int_t fid, void *arg, size_t arg_size) {
+  batch_node_t* n = &batch_nodes[node];
+  size_t need = BATCH_PAD(sizeof(batch_rec_t)) + BATCH_PAD(arg_size);
+  batch_rec_t r;
+  batch_t* b;
+
+  chpl_sync_lock(&n->lock);
+
+  // Nothing outstanding: do this 'on' directly, and let any that arrive
+  // in the meantime collect into a batch.
+  if (atomic_load_uint_least32_t(&n->outstanding) == 0 && n->batch == NULL) {
+    atomic_fetch_add_uint_least32_t(&n->outstanding, 1);
+    chpl_sync_unlock(&n->lock);
+
+    chpl_comm_execute_on(node, subloc, fid, arg, arg_size);
+
+    chpl_sync_lock(&n->lock);
+    atomic_fetch_sub_uint_least32_t(&n->outstanding, 1);
+    batch_send_locked(node, n, false);
+    chpl_sync_unlock(&n->lock);
+    return;
+  }
+
+  // Visual Debug Support
+  chpl_vdebug_log_fork(node, subloc, fid, arg, arg_size);
+
+  if (chpl_verbose_comm && !chpl_comm_no_debug_private)
+    printf("%d: remote task created on %d\n", chpl_nodeID, node);
+  if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
+    chpl_sync_lock(&chpl_comm_diagnostics_sync);
+    chpl_comm_commDiagnostics.execute_on++;
+    chpl_sync_unlock(&chpl_comm_diagnostics_sync);
+  }
+
+  // Otherwise join the batch being collected.  If it is full or for a
+  // different sublocale, send it along regardless and start a new one.
+  b = n->batch;
+  if (b != NULL &&
+      (b->count == batch_max_count || b->len + need > batch_buf_size ||
+       b->subloc != subloc)) {
+    batch_send_locked(node, n, true);
+    b = NULL;
+  }
+
+  if (b == NULL) {
+    b = chpl_mem_alloc(BATCH_PAD(sizeof(batch_t)) + batch_buf_size,
+                       CHPL_RT_MD_COMM_FRK_SND_INFO, 0, 0);
+    b->node = node;
+    b->subloc = subloc;
+    atomic_init_uint_least32_t(&b->refs, 0);
+    b->done = 0;
+    b->start = gasnett_ticks_now();
+    b->count = 0;
+    b->len = 0;
+    n->batch = b;
+  }
+
+  r.fid = fid;
+  r.serial_state = chpl_task_getSerial();
+  r.arg_size = arg_size;
+  chpl_memcpy(BATCH_RECS(b) + b->len, &r, sizeof(r));
+  if (arg_size)
+    chpl_memcpy(BATCH_RECS(b) + b->len + BATCH_PAD(sizeof(r)), arg, arg_size);
+  b->len += need;
+  b->count++;
+  atomic_fetch_add_uint_least32_t(&b->refs, 1);
+
+  batch_send_locked(node, n, false);
+  chpl_sync_unlock(&n->lock);
+
+  // Wait for the batch to finish.  Whoever notices that nothing is
+  // outstanding, or that the batch has waited too long, sends it.
+  while (!b->done) {
+    chpl_bool late;
+
+    agg_wait();
+    if (b->done)
+      break;
+    late = gasnett_ticks_to_us(gasnett_ticks_now() - b->start)
+           >= batch_timeout_us;
+    if (late || atomic_load_uint_least32_t(&n->outstanding) == 0) {
+      chpl_sync_lock(&n->lock);
+      if (n->batch == b)
+        batch_send_locked(node, n, late);
+      chpl_sync_unlock(&n->lock);
+    }
+  }
+
+  if (atomic_fetch_sub_uint_least32_t(&b->refs, 1) == 1)
+    chpl_mem_free(b, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////
+//
+// Collectives: tree broadcast and dissemination barrier
+//
+// Broadcasts go down a coll_fanout-ary tree rooted at the broadcasting
+// node, numbering nodes relative to the root.  Each node stores the
+// data as soon as the TREE_BCAST arrives.  A leaf acknowledges right
+// from the handler.  An interior node can't send requests from a
+// handler, so it starts a task that passes the message on to its
+// children and acknowledges to its parent once they all have.  When
+// the root's children have acknowledged, every node has the data.
+//
+// The barrier is a dissemination barrier with coll_fanout partners per
+// round: in round r, each node signals the nodes j*(coll_fanout+1)^r
+// after it (for j = 1..coll_fanout) and waits to be signaled by the
+// same number before it.  After ceil(log_{coll_fanout+1}(numNodes))
+// rounds, every node has heard from every other.  Signals carry the
+// round and the parity of the barrier, since a node that has finished
+// one barrier may signal a slow partner for the next.
+//
+// CHPL_RT_COMM_FANOUT sets coll_fanout; it defaults to 4.
+//
+
+static int coll_fanout;
+
+#define BARRIER_MAX_ROUNDS 64
+
+static atomic_uint_least32_t barrier_count[2][BARRIER_MAX_ROUNDS];
+
+// Bytes of the global variables table that have arrived here.
+static atomic_uint_least64_t bcast_globals_received;
+
+typedef struct {
+  c_nodeid_t   parent;
+  void*        parent_ack;
+  size_t       nbytes;
+  tree_bcast_t tb;      // must be last; its data follows
+} tree_relay_t;
+
+static void coll_init(void) {
+  int p, r;
+
+  coll_fanout = chpl_get_rt_env_int("COMM_FANOUT", 4);
+  if (coll_fanout < 1)
+    coll_fanout = 1;
+
+  for (p = 0; p < 2; p++)
+    for (r = 0; r < BARRIER_MAX_ROUNDS; r++)
+      atomic_init_uint_least32_t(&barrier_count[p][r], 0);
+  atomic_init_uint_least64_t(&bcast_globals_received, 0);
+}
+
+static int tree_num_children(c_nodeid_t root) {
+  int64_t rel = (chpl_nodeID - root + chpl_numNodes) % chpl_numNodes;
+  int64_t first = rel * coll_fanout + 1;
+
+  if (first >= chpl_numNodes)
+    return 0;
+  if (chpl_numNodes - first < coll_fanout)
+    return chpl_numNodes - first;
+  return coll_fanout;
+}
+
+//
+// Send tb to this node's children in the tree, asking each to signal
+// done.  The caller sets up done with a target that counts them.
+//
+static void tree_send_children(tree_bcast_t* tb, size_t nbytes,
+                               done_t* done) {
+  int64_t rel = (chpl_nodeID - tb->root + chpl_numNodes) % chpl_numNodes;
+  int n = tree_num_children(tb->root);
+  int i;
+
+  tb->ack = done;
+  for (i = 0; i < n; i++) {
+    c_nodeid_t child = (rel * coll_fanout + 1 + i + tb->root) % chpl_numNodes;
+    GASNET_Safe(gasnet_AMRequestMedium0(child, TREE_BCAST, tb, nbytes));
+  }
+}
+
+static void tree_deliver(tree_bcast_t* tb) {
+  if (tb->kind == BCAST_PRIVATE) {
+    chpl_memcpy((char*)chpl_private_broadcast_table[tb->id] + tb->offset,
+                tb->data, tb->size);
+  } else {
+    size_t first = tb->offset / sizeof(wide_ptr_t);
+    size_t i;
+
+    for (i = 0; i < tb->size / sizeof(wide_ptr_t); i++)
+      chpl_memcpy(chpl_globals_registry[first + i],
+                  tb->data + i * sizeof(wide_ptr_t), sizeof(wide_ptr_t));
+    atomic_fetch_add_uint_least64_t(&bcast_globals_received, tb->size);
+  }
+}
+
+static void tree_relay(tree_relay_t* r) {
+  done_t done;
+
+  init_done_obj(&done, tree_num_children(r->tb.root));
+  tree_send_children(&r->tb, r->nbytes, &done);
+  wait_done_obj(&done);
+  GASNET_Safe(gasnet_AMRequestShort2(r->parent, SIGNAL,
+                                     AckArg0(r->parent_ack),
+                                     AckArg1(r->parent_ack)));
+  chpl_mem_free(r, 0, 0);
+}
+
+static void AM_tree_bcast(gasnet_token_t token, void* buf, size_t nbytes) {
+  tree_bcast_t* tb = buf;
+  tree_relay_t* r;
+  gasnet_node_t src;
+
+  tree_deliver(tb);
+
+  if (tree_num_children(tb->root) == 0) {
+    GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL,
+                                     AckArg0(tb->ack), AckArg1(tb->ack)));
+    return;
+  }
+
+  r = chpl_mem_allocMany(1, offsetof(tree_relay_t, tb) + nbytes,
+                         CHPL_RT_MD_COMM_PRV_BCAST_DATA, 0, 0);
+  GASNET_Safe(gasnet_AMGetMsgSource(token, &src));
+  r->parent = src;
+  r->parent_ack = tb->ack;
+  r->nbytes = nbytes;
+  chpl_memcpy(&r->tb, buf, nbytes);
+  chpl_task_startMovedTask((chpl_fn_p)tree_relay, (void*)r,
+                           c_sublocid_any, chpl_nullTaskID, false);
+}
+
+//
+// Broadcast size bytes at data from this node to all the others, in
+// pieces that fit in an AM Medium, and wait until every node has them.
+// The globals are delivered a wide pointer at a time, so for those each
+// piece holds a whole number of wide pointers.
+//
+static void tree_bcast(tree_bcast_kind_t kind, int id, void* data,
+                       size_t size) {
+  size_t maxsize = gasnet_AMMaxMedium() - sizeof(tree_bcast_t);
+  size_t npieces;
+  tree_bcast_t* tb;
+  size_t offset;
+  done_t done;
+
+  if (chpl_numNodes == 1 || size == 0)
+    return;
+
+  if (kind == BCAST_GLOBALS)
+    maxsize -= maxsize % sizeof(wide_ptr_t);
+  npieces = (size + maxsize - 1) / maxsize;
+
+  tb = chpl_mem_allocMany(1, sizeof(tree_bcast_t) +
+                             (size < maxsize ? size : maxsize),
+                          CHPL_RT_MD_COMM_PRV_BCAST_DATA, 0, 0);
+  tb->root = chpl_nodeID;
+  tb->kind = kind;
+  tb->id = id;
+
+  init_done_obj(&done, npieces * tree_num_children(chpl_nodeID));
+  for (offset = 0; offset < size; offset += maxsize) {
+    tb->offset = offset;
+    tb->size = size - offset < maxsize ? size - offset : maxsize;
+    chpl_memcpy(tb->data, (char*) data + offset, tb->size);
+    tree_send_children(tb, sizeof(tree_bcast_t) + tb->size, &done);
+  }
+  chpl_mem_free(tb, 0, 0);
+
+  wait_done_obj(&done);
+}
+
+static void AM_barrier_signal(gasnet_token_t token,
+                              gasnet_handlerarg_t round,
+                              gasnet_handlerarg_t parity) {
+  atomic_fetch_add_uint_least32_t(&barrier_count[parity][round], 1);
+}
+
 static gasnet_handlerentry_t ftable[] = {
   {FORK,          AM_fork},
   {FORK_LARGE,    AM_fork_large},
@@ -434,13 +1246,19 @@ static gasnet_handlerentry_t ftable[] = {
   {FORK_FAST,     AM_fork_fast},
   {SIGNAL,        AM_signal},
   {SIGNAL_LONG,   AM_signal_long},
-  {PRIV_BCAST,    AM_priv_bcast},
-  {PRIV_BCAST_LARGE, AM_priv_bcast_large},
+  {TREE_BCAST,    AM_tree_bcast},
+  {BARRIER_SIGNAL, AM_barrier_signal},
   {FREE,          AM_free},
   {EXIT_ANY,      AM_exit_any},
   {BCAST_SEGINFO, AM_bcast_seginfo},
   {DO_REPLY_PUT,  AM_reply_put},
-  {DO_COPY_PAYLOAD, AM_copy_payload}
+  {DO_COPY_PAYLOAD, AM_copy_payload},
+  {AGG_PUT,       AM_agg_put},
+  {AGG_PUT_ACK,   AM_agg_put_ack},
+  {AGG_GET,       AM_agg_get},
+  {AGG_GET_REPLY, AM_agg_get_reply},
+  {FORK_BATCH,    AM_fork_batch},
+  {FORK_BATCH_DONE, AM_fork_batch_done}
 };
 
 //
@@ -455,6 +1273,9 @@ chpl_comm_nb_handle_t chpl_comm_put_nb(void *addr, c_nodeid_t node, void* raddr,
   // Should be in the compiler macros file?
   chpl_vdebug_log_put_nb(addr, node, raddr, size, typeIndex, ln, fn);
 
+  if (chpl_comm_aggregating)
+    agg_put_flush(node);
+
   ret = gasnet_put_nb_bulk(node, raddr, addr, size);
 
   if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
@@ -475,6 +1296,9 @@ chpl_comm_nb_handle_t chpl_comm_get_nb(void* addr, c_nodeid_t node, void* raddr,
   // Visual Debug Support
   chpl_vdebug_log_get_nb(addr, node, raddr, size, typeIndex, ln, fn);
 
+  if (chpl_comm_aggregating)
+    agg_put_flush(node);
+
   ret = gasnet_get_nb_bulk(addr, node, raddr, size);
 
   if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
@@ -549,6 +1373,8 @@ static void polling(void* x) {
   pollingRunning = 1;
   while (!pollingQuit) {
     (void) gasnet_AMPoll();
+    if (chpl_comm_aggregating)
+      agg_poll();
     chpl_task_yield();
   }
   pollingRunning = 0;
@@ -600,6 +1426,8 @@ void chpl_comm_init(int *argc_p, char ***argv_p) {
   gasnet_init(argc_p, argv_p);
   chpl_nodeID = gasnet_mynode();
   chpl_numNodes = gasnet_nodes();
+  // Before attaching, since other nodes may signal us as soon as we do.
+  coll_init();
   GASNET_Safe(gasnet_attach(ftable, 
                             sizeof(ftable)/sizeof(gasnet_handlerentry_t),
                             gasnet_getMaxLocalSegmentSize(),
@@ -704,6 +1532,12 @@ void chpl_comm_post_task_init(void) {
   // clear diags
   memset(&chpl_comm_commDiagnostics, 0, sizeof(chpl_commDiagnostics));
 
+  // Set up PUT/GET aggregation, if it was asked for.
+  agg_init();
+
+  // Set up batching of 'on' statements.
+  batch_init();
+
   // Initialize the caching layer, if it is active.
   chpl_cache_init();
 }
@@ -727,76 +1561,29 @@ void chpl_comm_desired_shared_heap(void** start_p, size_t* size_p) {
 }
 
 void chpl_comm_broadcast_global_vars(int numGlobals) {
-  int i;
-  if (chpl_nodeID != 0) {
-    for (i = 0; i < numGlobals; i++) {
-      chpl_comm_get(chpl_globals_registry[i], 0,
-                    &((wide_ptr_t*)seginfo_table[0].addr)[i],
-                    sizeof(wide_ptr_t), -1 /*typeIndex: unused*/, 0, 0);
+  size_t size = numGlobals * sizeof(wide_ptr_t);
+
+  if (chpl_nodeID == 0) {
+    tree_bcast(BCAST_GLOBALS, 0, seginfo_table[0].addr, size);
+  } else {
+    // Wait for our copy to come down the tree.
+    while (atomic_load_uint_least64_t(&bcast_globals_received) < size) {
+      (void) gasnet_AMPoll();
+      chpl_task_yield();
     }
+    atomic_store_uint_least64_t(&bcast_globals_received, 0);
   }
 }
 
 void chpl_comm_broadcast_private(int id, size_t size, int32_t tid) {
-  int  node, offset;
-  int  payloadSize = size + sizeof(priv_bcast_t);
-  done_t* done;
-  int numOffsets=1;
-
-  // This can use the system allocator because it involves internode communication.
-  done = (done_t*) chpl_mem_allocManyZero(chpl_numNodes, sizeof(*done),
-                                          CHPL_RT_MD_COMM_FRK_DONE_FLAG,
-                                          0, 0);
-  if (payloadSize <= gasnet_AMMaxMedium()) {
-    priv_bcast_t* pbp = chpl_mem_allocMany(1, payloadSize, CHPL_RT_MD_COMM_PRV_BCAST_DATA, 0, 0);
-    chpl_memcpy(pbp->data, chpl_private_broadcast_table[id], size);
-    pbp->id = id;
-    pbp->size = size;
-    for (node = 0; node < chpl_numNodes; node++) {
-      if (node != chpl_nodeID) {
-        pbp->ack = &done[node];
-        init_done_obj(&done[node], 1);
-        GASNET_Safe(gasnet_AMRequestMedium0(node, PRIV_BCAST, pbp, payloadSize));
-      }
-    }
-    chpl_mem_free(pbp, 0, 0);
-  } else {
-    size_t maxpayloadsize = gasnet_AMMaxMedium();
-    size_t maxsize = maxpayloadsize - sizeof(priv_bcast_large_t);
-    priv_bcast_large_t* pblp = chpl_mem_allocMany(1, maxpayloadsize, CHPL_RT_MD_COMM_PRV_BCAST_DATA, 0, 0);
-    pblp->id = id;
-    numOffsets = (size+maxsize)/maxsize;
-    for (node = 0; node < chpl_numNodes; node++) {
-      if (node != chpl_nodeID)
-        init_done_obj(&done[node], numOffsets);
-    }
-    for (offset = 0; offset < size; offset += maxsize) {
-      size_t thissize = size - offset;
-      if (thissize > maxsize)
-        thissize = maxsize;
-      pblp->offset = offset;
-      pblp->size = thissize;
-      chpl_memcpy(pblp->data, (char*)chpl_private_broadcast_table[id]+offset, thissize);
-      for (node = 0; node < chpl_numNodes; node++) {
-        if (node != chpl_nodeID) {
-          pblp->ack = &done[node];
-          GASNET_Safe(gasnet_AMRequestMedium0(node, PRIV_BCAST_LARGE, pblp, sizeof(priv_bcast_large_t)+thissize));
-        }
-      }
-    }
-    chpl_mem_free(pblp, 0, 0);
-  }
-  // wait for the handlers to complete
-  for (node = 0; node < chpl_numNodes; node++) {
-    if (node != chpl_nodeID)
-      GASNET_BLOCKUNTIL(done[node].flag);
-  }
-  chpl_mem_free(done, 0, 0);
+  chpl_comm_aggregate_flush();
+  tree_bcast(BCAST_PRIVATE, id, chpl_private_broadcast_table[id], size);
 }
 
 void chpl_comm_barrier(const char *msg) {
-  int id = (int) msg[0];
-  int retval;
+  static int parity = 0;
+  int64_t dist;
+  int round;
 
 #ifdef CHPL_COMM_DEBUG
   chpl_msg(2, "%d: enter barrier for '%s'\n", chpl_nodeID, msg);
@@ -809,13 +1596,32 @@ void chpl_comm_barrier(const char *msg) {
   // We don't want to compete with that.  Also, the implementation is
   // required to do chpl_task_yield() while waiting for the barrier to
   // satisfy; see chpl_comm.h.  This prevents us from monopolizing the
-  // processor while waiting.
+  // processor while waiting.  We poll ourselves too, since the polling
+  // task may not have started yet or may already have stopped.
   //
-  gasnet_barrier_notify(id, 0);
-  while ((retval = gasnet_barrier_try(id, 0)) == GASNET_ERR_NOT_READY) {
-    chpl_task_yield();
+  chpl_comm_aggregate_flush();
+
+  for (round = 0, dist = 1; dist < chpl_numNodes;
+       round++, dist *= coll_fanout + 1) {
+    uint32_t expect = 0;
+    int j;
+
+    for (j = 1; j <= coll_fanout && j * dist < chpl_numNodes; j++) {
+      c_nodeid_t partner = (chpl_nodeID + j * dist) % chpl_numNodes;
+      GASNET_Safe(gasnet_AMRequestShort2(partner, BARRIER_SIGNAL,
+                                         round, parity));
+      expect++;
+    }
+
+    while (atomic_load_uint_least32_t(&barrier_count[parity][round])
+           < expect) {
+      (void) gasnet_AMPoll();
+      chpl_task_yield();
+    }
+    atomic_fetch_sub_uint_least32_t(&barrier_count[parity][round], expect);
   }
-  GASNET_Safe_Retval(gasnet_barrier_try(id, 0), retval);
+
+  parity = !parity;
 }
 
 void chpl_comm_pre_task_exit(int all) {
@@ -914,6 +1720,14 @@ void  chpl_comm_put(void* addr, c_nodeid_t node, void* raddr,
       chpl_sync_unlock(&chpl_comm_diagnostics_sync);
     }
 
+    if (chpl_comm_aggregating) {
+      if (size <= agg_max_size) {
+        agg_put(addr, node, raddr, size);
+        return;
+      }
+      agg_put_flush(node);
+    }
+
     // Handle remote address not in remote segment.
 #ifdef GASNET_SEGMENT_EVERYTHING
     remote_in_segment = 1;
@@ -971,122 +1785,138 @@ void  chpl_comm_put(void* addr, c_nodeid_t node, void* raddr,
 ////GASNET - pass trace info to gasnet_get
 ////GASNET - define GASNET_E_ PUTGET always REMOTE
 ////GASNET - look at GASNET tools at top of README.tools has atomic counters
-void  chpl_comm_get(void* addr, c_nodeid_t node, void* raddr,
-                    size_t size, int32_t typeIndex,
-                    int ln, int32_t fn) {
+//
+// The GET part of chpl_comm_get(), once we know the data is remote.
+//
+static void do_remote_get(void* addr, c_nodeid_t node, void* raddr,
+                          size_t size) {
   int remote_in_segment;
 
-  if (chpl_nodeID == node) {
-    memmove(addr, raddr, size);
-  } else {
-    // Visual Debug support
-    chpl_vdebug_log_get(addr, node, raddr, size, typeIndex, ln, fn);
-    
-    if (chpl_verbose_comm && !chpl_comm_no_debug_private)
-      printf("%d: %s:%d: remote get from %d\n", chpl_nodeID,
-             chpl_lookupFilename(fn), ln, node);
-    if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
-      chpl_sync_lock(&chpl_comm_diagnostics_sync);
-      chpl_comm_commDiagnostics.get++;
-      chpl_sync_unlock(&chpl_comm_diagnostics_sync);
-    }
-
-    // Handle remote address not in remote segment.
+  // Handle remote address not in remote segment.
 
-    // The GASNet Spec says:
-    //   The source memory address for all gets and the target memory address
-    //   for all puts must fall within the memory area registered for remote
-    //   access by the remote node (see gasnet_attach()), or the results are
-    //   undefined
+  // The GASNet Spec says:
+  //   The source memory address for all gets and the target memory address
+  //   for all puts must fall within the memory area registered for remote
+  //   access by the remote node (see gasnet_attach()), or the results are
+  //   undefined
 
-    // In other words, it is OK if the local side of a GET or PUT
-    // is not in the registered memory region.
+  // In other words, it is OK if the local side of a GET or PUT
+  // is not in the registered memory region.
 
 #ifdef GASNET_SEGMENT_EVERYTHING
-    remote_in_segment = 1;
+  remote_in_segment = 1;
 #else
-    remote_in_segment = chpl_comm_addr_gettable(node, raddr, size);
+  remote_in_segment = chpl_comm_addr_gettable(node, raddr, size);
 #endif
 
-    if( remote_in_segment ) {
-      // If it's in the remote segment, great, do a normal gasnet_get.
-      // GASNet will handle the local portion not being in the segment.
-      gasnet_get(addr, node, raddr, size); // dest, node, src, size
-    } else {
-      // If it's not in the remote segment, we need to send an
-      // active message so that the other node will PUT back to us.
-      // In order for that to work, the local side has to be in
-      // the registered memory segment.
-      int local_in_segment;
-      void* local_buf = NULL;
-      size_t buf_sz = 0;
-      size_t max_chunk = gasnet_AMMaxLongReply();
-      size_t start;
+  if( remote_in_segment ) {
+    // If it's in the remote segment, great, do a normal gasnet_get.
+    // GASNet will handle the local portion not being in the segment.
+    gasnet_get(addr, node, raddr, size); // dest, node, src, size
+  } else {
+    // If it's not in the remote segment, we need to send an
+    // active message so that the other node will PUT back to us.
+    // In order for that to work, the local side has to be in
+    // the registered memory segment.
+    int local_in_segment;
+    void* local_buf = NULL;
+    size_t buf_sz = 0;
+    size_t max_chunk = gasnet_AMMaxLongReply();
+    size_t start;
 
 #ifdef GASNET_SEGMENT_EVERYTHING
-      local_in_segment = 1;
+    local_in_segment = 1;
 #else
-      local_in_segment = chpl_comm_addr_gettable(chpl_nodeID, addr, size);
+    local_in_segment = chpl_comm_addr_gettable(chpl_nodeID, addr, size);
 #endif
 
-      // If the local address isn't in a registered segment,
-      // do the GET into a temporary buffer instead, and then
-      // copy the result back.
-      if( ! local_in_segment ) {
-        size_t buf_sz = size;
-        if( buf_sz > max_chunk ) {
-          buf_sz = max_chunk;
-        }
+    // If the local address isn't in a registered segment,
+    // do the GET into a temporary buffer instead, and then
+    // copy the result back.
+    if( ! local_in_segment ) {
+      size_t buf_sz = size;
+      if( buf_sz > max_chunk ) {
+        buf_sz = max_chunk;
+      }
 
-        local_buf = chpl_mem_alloc(buf_sz, CHPL_RT_MD_COMM_XMIT_RCV_BUF, 0, 0);
+      local_buf = chpl_mem_alloc(buf_sz, CHPL_RT_MD_COMM_XMIT_RCV_BUF, 0, 0);
 #ifdef GASNET_SEGMENT_EVERYTHING
-        // local_buf is definately in our segment
+      // local_buf is definately in our segment
 #else
-        assert(chpl_comm_addr_gettable(chpl_nodeID, local_buf, buf_sz));
+      assert(chpl_comm_addr_gettable(chpl_nodeID, local_buf, buf_sz));
 #endif
+    }
+
+    // do a PUT on the remote locale back to here.
+    // But do it in chunks of size gasnet_AMMaxLongReply()
+    // since we use gasnet_AMReplyLong to do the PUT.
+    for(start = 0; start < size; start += max_chunk) {
+      size_t this_size;
+      void* addr_chunk;
+      xfer_info_t info;
+      done_t done;
+
+      this_size = size - start;
+      if( this_size > max_chunk ) {
+        this_size = max_chunk;
       }
 
-      // do a PUT on the remote locale back to here.
-      // But do it in chunks of size gasnet_AMMaxLongReply()
-      // since we use gasnet_AMReplyLong to do the PUT.
-      for(start = 0; start < size; start += max_chunk) {
-        size_t this_size;
-        void* addr_chunk;
-        xfer_info_t info;
-        done_t done;
+      addr_chunk = ((char*) addr) + start;
 
-        this_size = size - start;
-        if( this_size > max_chunk ) {
-          this_size = max_chunk;
-        }
+      init_done_obj(&done, 1);
 
-        addr_chunk = ((char*) addr) + start;
+      info.ack = &done;
+      info.tgt = local_buf?local_buf:addr_chunk;
+      info.src = ((char*) raddr) + start;
+      info.size = this_size;
 
-        init_done_obj(&done, 1);
+      // Send an AM over to ask for a PUT back to us
+      GASNET_Safe(gasnet_AMRequestMedium0(node, DO_REPLY_PUT,
+                                          &info, sizeof(info)));
 
-        info.ack = &done;
-        info.tgt = local_buf?local_buf:addr_chunk;
-        info.src = ((char*) raddr) + start;
-        info.size = this_size;
+      // Wait for the PUT to complete.
+      wait_done_obj(&done);
 
-        // Send an AM over to ask for a PUT back to us
-        GASNET_Safe(gasnet_AMRequestMedium0(node, DO_REPLY_PUT,
-                                            &info, sizeof(info)));
+      // Now copy from local_buf back to addr if necessary.
+      if( local_buf ) {
+        memcpy(addr_chunk, local_buf, this_size);
+      }
+    }
 
-        // Wait for the PUT to complete.
-        wait_done_obj(&done);
+    // If we were using a temporary local buffer free it
+    if( local_buf ) {
+      chpl_mem_free(local_buf, 0, 0);
+    }
+  }
+}
 
-        // Now copy from local_buf back to addr if necessary.
-        if( local_buf ) {
-          memcpy(addr_chunk, local_buf, this_size);
-        }
-      }
+void  chpl_comm_get(void* addr, c_nodeid_t node, void* raddr,
+                    size_t size, int32_t typeIndex,
+                    int ln, int32_t fn) {
+  if (chpl_nodeID == node) {
+    memmove(addr, raddr, size);
+  } else {
+    // Visual Debug support
+    chpl_vdebug_log_get(addr, node, raddr, size, typeIndex, ln, fn);
+    
+    if (chpl_verbose_comm && !chpl_comm_no_debug_private)
+      printf("%d: %s:%d: remote get from %d\n", chpl_nodeID,
+             chpl_lookupFilename(fn), ln, node);
+    if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
+      chpl_sync_lock(&chpl_comm_diagnostics_sync);
+      chpl_comm_commDiagnostics.get++;
+      chpl_sync_unlock(&chpl_comm_diagnostics_sync);
+    }
 
-      // If we were using a temporary local buffer free it
-      if( local_buf ) {
-        chpl_mem_free(local_buf, 0, 0);
+    if (chpl_comm_aggregating) {
+      agg_put_flush(node);
+      if (size <= agg_max_size) {
+        agg_get(addr, node, raddr, size);
+        return;
       }
     }
+
+    do_remote_get(addr, node, raddr, size);
   }
 }
 
@@ -1152,6 +1982,9 @@ void  chpl_comm_get_strd(void* dstaddr, size_t* dststrides, c_nodeid_t srcnode_i
     chpl_sync_unlock(&chpl_comm_diagnostics_sync);
   }
 
+  if (chpl_comm_aggregating && srcnode != chpl_nodeID)
+    agg_put_flush(srcnode);
+
   // TODO -- handle strided get for non-registered memory
   gasnet_gets_bulk(dstaddr, dststr, srcnode, srcaddr, srcstr, cnt, strlvls); 
 }
@@ -1211,6 +2044,9 @@ void  chpl_comm_put_strd(void* dstaddr, size_t* dststrides, c_nodeid_t dstnode_i
     chpl_comm_commDiagnostics.put++;
     chpl_sync_unlock(&chpl_comm_diagnostics_sync);
   }
+  if (chpl_comm_aggregating && dstnode != chpl_nodeID)
+    agg_put_flush(dstnode);
+
   // TODO -- handle strided put for non-registered memory
   gasnet_puts_bulk(dstnode, dstaddr, dststr, srcaddr, srcstr, cnt, strlvls); 
 }
@@ -1227,6 +2063,7 @@ void  chpl_comm_execute_on(c_nodeid_t node, c_sublocid_t subloc,
 
 
   if (chpl_nodeID == node) {
+    chpl_comm_aggregate_flush();
     chpl_ftable_call(fid, arg);
   } else {
     // Visual Debug Support
@@ -1265,6 +2102,8 @@ void  chpl_comm_execute_on(c_nodeid_t node, c_sublocid_t subloc,
 
     init_done_obj(&done, 1);
 
+    chpl_comm_aggregate_flush();
+
     if (passArg) {
       if (arg_size)
         chpl_memcpy(&(info->arg), arg, arg_size);
@@ -1313,6 +2152,7 @@ void  chpl_comm_execute_on_nb(c_nodeid_t node, c_sublocid_t subloc,
   }
 
   if (chpl_nodeID == node) {
+    chpl_comm_aggregate_flush();
     // Visual Debug?  Should we generate a task here???
     if (info->serial_state)
       fork_nb_wrapper(info);
@@ -1331,6 +2171,7 @@ void  chpl_comm_execute_on_nb(c_nodeid_t node, c_sublocid_t subloc,
       chpl_comm_commDiagnostics.execute_on_nb++;
       chpl_sync_unlock(&chpl_comm_diagnostics_sync);
     }
+    chpl_comm_aggregate_flush();
     if (passArg) {
       GASNET_Safe(gasnet_AMRequestMedium0(node, FORK_NB, info, info_size));
       chpl_mem_free(info, 0, 0);
@@ -1350,6 +2191,7 @@ void  chpl_comm_execute_on_fast(c_nodeid_t node, c_sublocid_t subloc,
   int     passArg = info_size <= gasnet_AMMaxMedium();
 
   if (chpl_nodeID == node) {
+    chpl_comm_aggregate_flush();
     chpl_ftable_call(fid, arg);
   } else {
     // Visual Debug Support
@@ -1377,6 +2219,7 @@ void  chpl_comm_execute_on_fast(c_nodeid_t node, c_sublocid_t subloc,
 
       if (arg_size)
         chpl_memcpy(&(info->arg), arg, arg_size);
+      chpl_comm_aggregate_flush();
       GASNET_Safe(gasnet_AMRequestMedium0(node, FORK_FAST, info, info_size));
       // NOTE: We still have to wait for the handler to complete
 
@@ -1389,6 +2232,24 @@ void  chpl_comm_execute_on_fast(c_nodeid_t node, c_sublocid_t subloc,
   }
 }
 
+void  chpl_comm_execute_on_batch(c_nodeid_t node, c_sublocid_t subloc,
+                                 chpl_fn_int_t fid, void *arg,
+                                 size_t arg_size) {
+  size_t need = BATCH_PAD(sizeof(batch_rec_t)) + BATCH_PAD(arg_size);
+
+  if (chpl_nodeID == node) {
+    chpl_comm_aggregate_flush();
+    chpl_ftable_call(fid, arg);
+  } else if (!batch_on || need > batch_buf_size) {
+    chpl_comm_execute_on(node, subloc, fid, arg, arg_size);
+  } else {
+    // The body may read what this task wrote, and it may run before
+    // the batch it joins is sent.
+    chpl_comm_aggregate_flush();
+    batch_execute_on(node, subloc, fid, arg, arg_size);
+  }
+}
+
 void chpl_comm_make_progress(void)
 {
   gasnet_AMPoll();
@@ -1447,12 +2308,14 @@ void chpl_resetCommDiagnosticsHere() {
   chpl_sync_lock(&chpl_comm_diagnostics_sync);
   memset(&chpl_comm_commDiagnostics, 0, sizeof(chpl_commDiagnostics));
   chpl_sync_unlock(&chpl_comm_diagnostics_sync);
+  chpl_cache_resetCommDiagnostics();
 }
 
 void chpl_getCommDiagnosticsHere(chpl_commDiagnostics *cd) {
   chpl_sync_lock(&chpl_comm_diagnostics_sync);
   chpl_memcpy(cd, &chpl_comm_commDiagnostics, sizeof(chpl_commDiagnostics));
   chpl_sync_unlock(&chpl_comm_diagnostics_sync);
+  chpl_cache_getCommDiagnostics(cd);
 }
 
 void chpl_comm_gasnet_help_register_global_var(int i, wide_ptr_t wide_addr) {
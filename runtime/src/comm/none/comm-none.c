@@ -516,6 +516,14 @@ void chpl_comm_execute_on_fast(c_nodeid_t node, c_sublocid_t subloc,
   chpl_ftable_call(fid, arg);
 }
 
+// Same as chpl_comm_execute_on()
+void chpl_comm_execute_on_batch(c_nodeid_t node, c_sublocid_t subloc,
+                                chpl_fn_int_t fid, void *arg, size_t arg_size) {
+  assert(node==0);
+
+  chpl_ftable_call(fid, arg);
+}
+
 int chpl_comm_numPollingTasks(void) { return 0; }
 
 void chpl_comm_make_progress(void)
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* THIS FILE IS AUTOMATICALLY GENERATED */
+#ifndef _CHPL_ENV_H_
+#define _CHPL_ENV_H_
+#define CHPL_HOST_PLATFORM_LINUX64
+#define CHPL_HOST_COMPILER_GNU
+#define CHPL_TARGET_PLATFORM_LINUX64
+#define CHPL_TARGET_COMPILER_GNU
+#define CHPL_TARGET_ARCH_NATIVE
+#define CHPL_LOCALE_MODEL_FLAT
+#define CHPL_COMM_NONE
+#define CHPL_COMM_SUBSTRATE_NONE
+#define CHPL_GASNET_SEGMENT_NONE
+#define CHPL_TASKS_QTHREADS
+#define CHPL_LAUNCHER_NONE
+#define CHPL_TIMERS_GENERIC
+#define CHPL_MEM_JEMALLOC
+#define CHPL_MAKE_GMAKE
+#define CHPL_ATOMICS_INTRINSICS
+#define CHPL_NETWORK_ATOMICS_NONE
+#define CHPL_GMP_NONE
+#define CHPL_HWLOC_HWLOC
+#define CHPL_REGEXP_NONE
+#define CHPL_WIDE_POINTERS_STRUCT
+#define CHPL_LLVM_NONE
+#define CHPL_AUX_FILESYS_NONE
+#endif /* _CHPL_ENV_H_ */
@@ -41,3 +41,6 @@ void chpl_mem_layerInit(void) {
 
 
 void chpl_mem_layerExit(void) { }
+
+
+void chpl_mem_layerSetSubloc(c_sublocid_t subloc) { }
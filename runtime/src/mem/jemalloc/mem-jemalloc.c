@@ -19,14 +19,21 @@
 
 #include "chplrt.h"
 
+#include <dirent.h>
 #include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "chpl-comm.h"
+#include "chpl-env.h"
 #include "chpl-mem.h"
+#include "chpl-thread-local-storage.h"
 #include "chplmemtrack.h"
 #include "chpltypes.h"
 #include "error.h"
@@ -128,6 +135,98 @@ static bool null_merge(void *chunk_a, size_t size_a, void *chunk_b, size_t size_
 // *** End chunk hook replacements *** //
 
 
+// *** NUMA domain arenas *** //
+//
+// On a node with more than one NUMA domain we add one arena per domain.
+// Each one's chunk hook gets chunks the usual way (from the shared heap
+// if there is one, otherwise from jemalloc's default hook) and then
+// binds them to the domain with mbind().  Threads are attached to the
+// arena for the domain of the sublocale they run tasks for, by
+// chpl_mem_layerSetSubloc().  If mbind() isn't available or fails, the
+// pages are still first touched by threads in that domain.  Node ids
+// need not be dense, so sublocale i is paired with the i'th node the
+// kernel lists, modulo the number of nodes.
+//
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE (1 << 1)
+#endif
+
+static int numa_num_domains;          // 0: no NUMA domain arenas
+static unsigned* numa_arena;          // arena index, by domain
+static int* numa_node;                // kernel node id, by domain
+static chunk_alloc_t* numa_base_chunk_alloc;  // where chunks come from
+
+// 1 + the domain whose arena this thread uses, or 0 if not yet set
+CHPL_TLS_DECL_INIT(intptr_t, numa_thread_domain);
+
+#define NUMA_MAX_NODES (4 * 8 * sizeof(unsigned long))
+
+// Fill in the ids of the NUMA nodes the kernel reports, in increasing
+// order, and return how many there are; 0 if we can't tell.
+static int get_numa_nodes(int* nodes) {
+  int n = 0;
+#ifdef __linux__
+  bool present[NUMA_MAX_NODES] = { false };
+  DIR* dir;
+  struct dirent* ent;
+  int node;
+
+  if ((dir = opendir("/sys/devices/system/node")) == NULL)
+    return 0;
+  while ((ent = readdir(dir)) != NULL) {
+    if (sscanf(ent->d_name, "node%d", &node) == 1
+        && node >= 0 && node < (int) NUMA_MAX_NODES)
+      present[node] = true;
+  }
+  closedir(dir);
+
+  for (node = 0; node < (int) NUMA_MAX_NODES; node++) {
+    if (present[node])
+      nodes[n++] = node;
+  }
+#endif
+  return n;
+}
+
+static void numa_bind_chunk(void* chunk, size_t size, int node) {
+#ifdef __linux__
+  unsigned long nodemask[NUMA_MAX_NODES / (8 * sizeof(unsigned long))]
+    = { 0 };
+  const unsigned long bits = 8 * sizeof(nodemask[0]);
+  unsigned long flags;
+
+  nodemask[node / bits] = 1UL << (node % bits);
+  // Pages of the shared heap may already be registered with the network,
+  // so leave them where they are and only steer pages not yet touched.
+  flags = (heap.base != NULL) ? 0 : MPOL_MF_MOVE;
+  // Ignore failure; first touch still places untouched pages well.
+  (void) syscall(SYS_mbind, chunk, size, MPOL_PREFERRED, nodemask,
+                 NUMA_MAX_NODES + 1, flags);
+#endif
+}
+
+static void* numa_chunk_alloc(void *chunk, size_t size, size_t alignment, bool *zero, bool *commit, unsigned arena_ind) {
+  void* p;
+  int domain;
+
+  p = numa_base_chunk_alloc(chunk, size, alignment, zero, commit, arena_ind);
+  if (p == NULL)
+    return NULL;
+
+  for (domain = 0; domain < numa_num_domains; domain++) {
+    if (numa_arena[domain] == arena_ind) {
+      numa_bind_chunk(p, size, numa_node[domain]);
+      break;
+    }
+  }
+  return p;
+}
+// *** End NUMA domain arenas *** //
+
+
 // helper routine to get a mallctl value
 #define DECLARE_GET_MALLCTL_VALUE(type) \
 static type get_ ## type ##_mallctl_value(const char* mallctl_string) { \
@@ -290,6 +389,49 @@ static void useUpMemNotInHeap(void) {
   }
 }
 
+// Add an arena for each NUMA domain, if there is more than one. The new
+// arenas get their chunks from wherever arena 0 does, so this must be done
+// after the shared heap (if any) is set up.
+static void initialize_numa_arenas(void) {
+  int nodes[NUMA_MAX_NODES];
+  int n;
+  int domain;
+  chunk_hooks_t hooks;
+  size_t sz;
+
+  n = get_numa_nodes(nodes);
+  if (n < 2 || !chpl_get_rt_env_bool("MEM_NUMA_ARENAS", true))
+    return;
+
+  sz = sizeof(hooks);
+  if (je_mallctl("arena.0.chunk_hooks", &hooks, &sz, NULL, 0) != 0) {
+    chpl_internal_error("could not get the chunk hooks");
+  }
+  numa_base_chunk_alloc = hooks.alloc;
+  hooks.alloc = numa_chunk_alloc;
+
+  if ((numa_arena = je_malloc(n * sizeof(*numa_arena))) == NULL
+      || (numa_node = je_malloc(n * sizeof(*numa_node))) == NULL) {
+    chpl_internal_error("cannot allocate NUMA domain arena table");
+  }
+  memcpy(numa_node, nodes, n * sizeof(*numa_node));
+
+  for (domain = 0; domain < n; domain++) {
+    char path[128];
+    sz = sizeof(numa_arena[domain]);
+    if (je_mallctl("arenas.extend", &numa_arena[domain], &sz, NULL, 0) != 0) {
+      chpl_internal_error("could not create a NUMA domain arena");
+    }
+    snprintf(path, sizeof(path), "arena.%u.chunk_hooks", numa_arena[domain]);
+    if (je_mallctl(path, NULL, NULL, &hooks, sizeof(chunk_hooks_t)) != 0) {
+      chpl_internal_error("could not update the chunk hooks");
+    }
+  }
+
+  CHPL_TLS_INIT(numa_thread_domain);
+  numa_num_domains = n;
+}
+
 // Have jemalloc use our shared heap. Initialize all the arenas, then replace
 // the chunk hooks with our custom ones, and finally use up any memory jemalloc
 // got from the system that's not in our shared heap.
@@ -331,6 +473,30 @@ void chpl_mem_layerInit(void) {
     }
     je_free(p);
   }
+
+  initialize_numa_arenas();
+}
+
+
+void chpl_mem_layerSetSubloc(c_sublocid_t subloc) {
+  intptr_t domain;
+
+  if (numa_num_domains == 0 || subloc < 0)
+    return;
+
+  domain = 1 + subloc % numa_num_domains;
+  if ((intptr_t) CHPL_TLS_GET(numa_thread_domain) == domain)
+    return;
+
+  if (je_mallctl("thread.arena", NULL, NULL, &numa_arena[domain - 1],
+                 sizeof(unsigned)) != 0) {
+    chpl_internal_error("could not change current thread's arena");
+  }
+
+  // Don't keep handing out regions cached from the previous arena.
+  (void) je_mallctl("thread.tcache.flush", NULL, NULL, NULL, 0);
+
+  CHPL_TLS_SET(numa_thread_domain, domain);
 }
 
 
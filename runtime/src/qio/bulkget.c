@@ -61,48 +61,276 @@ qbytes_t* bulk_get_bytes(int64_t src_locale, qbytes_t* src_addr)
   return ret; 
 }
 
-qioerr bulk_put_buffer(int64_t dst_locale, void* dst_addr, int64_t dst_len,
-                      qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end)
+// How many non-blocking PUTs or GETs to keep in flight at once.
+#define BULK_MAX_PENDING 16
+
+// How much of a channel's buffer to work on at a time.  This is also
+// the size of the bounce buffer used for channels that can't lend us
+// their buffer.
+#define BULK_CHUNK_SIZE (1024*1024)
+
+static
+void bulk_wait_all(chpl_comm_nb_handle_t* h, size_t n)
+{
+  size_t i;
+
+  for( i = 0; i < n; i++ ) {
+    while( ! chpl_comm_test_nb_complete(h[i]) ) {
+      chpl_comm_wait_nb_some(&h[i], n - i);
+    }
+  }
+}
+
+// Move data between the local regions in iov and the contiguous region
+// starting at raddr on locale: from iov to raddr if put is set, from
+// raddr into iov otherwise.  The transfers for the different regions
+// overlap with each other, but all of them have completed on return.
+static
+void bulk_xfer_iov(int put, int64_t locale, void* raddr,
+                   const struct iovec* iov, size_t iovcnt)
+{
+  chpl_comm_nb_handle_t pending[BULK_MAX_PENDING];
+  size_t npending = 0;
+  int use_nb = 1;
+  int64_t off = 0;
+  size_t i;
+
+#ifdef HAS_CHPL_CACHE_FNS
+  // The remote data cache has to see these so it stays coherent,
+  // and it overlaps the transfers itself.
+  if( chpl_cache_enabled() ) use_nb = 0;
+#endif
+
+  for( i = 0; i < iovcnt; i++ ) {
+    void* local = iov[i].iov_base;
+    void* remote = PTR_ADDBYTES(raddr, off);
+    size_t len = iov[i].iov_len;
+
+    off += len;
+    if( len == 0 ) continue;
+
+    if( locale == chpl_nodeID || ! use_nb ) {
+      if( put ) {
+        chpl_gen_comm_put(local, locale, remote,
+                          sizeof(uint8_t)*len, CHPL_TYPE_uint8_t,
+                          -1, CHPL_FILE_IDX_INTERNAL);
+      } else {
+        chpl_gen_comm_get(local, locale, remote,
+                          sizeof(uint8_t)*len, CHPL_TYPE_uint8_t,
+                          -1, CHPL_FILE_IDX_INTERNAL);
+      }
+      continue;
+    }
+
+    if( npending == BULK_MAX_PENDING ) {
+      bulk_wait_all(pending, npending);
+      npending = 0;
+    }
+
+    if( put ) {
+      pending[npending++] = chpl_comm_put_nb(local, locale, remote,
+                                             sizeof(uint8_t)*len,
+                                             CHPL_TYPE_uint8_t,
+                                             -1, CHPL_FILE_IDX_INTERNAL);
+    } else {
+      pending[npending++] = chpl_comm_get_nb(local, locale, remote,
+                                             sizeof(uint8_t)*len,
+                                             CHPL_TYPE_uint8_t,
+                                             -1, CHPL_FILE_IDX_INTERNAL);
+    }
+  }
+
+  bulk_wait_all(pending, npending);
+}
+
+// Move the bytes in buf between start and end to or from raddr.
+static
+qioerr bulk_xfer_buffer(int put, int64_t locale, void* raddr,
+                        qbuffer_t* buf, qbuffer_iter_t start,
+                        qbuffer_iter_t end)
 {
-  int64_t num_bytes = qbuffer_iter_num_bytes(start, end);
   ssize_t num_parts = qbuffer_iter_num_parts(start, end);
   struct iovec* iov = NULL;
   size_t iovcnt;
-  size_t i,j;
   MAYBE_STACK_SPACE(struct iovec, iov_onstack);
   qioerr err;
- 
-  if( num_bytes < 0 || num_parts < 0 || start.offset < buf->offset_start || end.offset > buf->offset_end )  QIO_RETURN_CONSTANT_ERROR(EINVAL, "range outside of buffer");
+
+  if( num_parts < 0 ) QIO_RETURN_CONSTANT_ERROR(EINVAL, "range outside of buffer");
 
   MAYBE_STACK_ALLOC(struct iovec, num_parts, iov, iov_onstack);
   if( ! iov ) return QIO_ENOMEM;
 
   err = qbuffer_to_iov(buf, start, end, num_parts, iov, NULL, &iovcnt);
-  if( err ) goto error;
+  if( ! err ) bulk_xfer_iov(put, locale, raddr, iov, iovcnt);
 
-  j = 0;
-  for( i = 0; i < iovcnt; i++ ) {
-    if( j + iov[i].iov_len > dst_len ) goto error_nospace;
-    //chpl_memcpy(PTR_ADDBYTES(ptr, j), iov[i].iov_base, iov[i].iov_len);
-
-    // TODO -- note -- technically, this should be gasnet_put_bulk,
-    // since we don't want to require src/dst to have a particular alignment.
-    chpl_gen_comm_put( iov[i].iov_base,
-                       dst_locale,
-                       PTR_ADDBYTES(dst_addr, j),
-                       sizeof(uint8_t)*iov[i].iov_len, CHPL_TYPE_uint8_t,
-                       -1, CHPL_FILE_IDX_INTERNAL );
-
-    j += iov[i].iov_len;
+  MAYBE_STACK_FREE(iov, iov_onstack);
+  return err;
+}
+
+qioerr bulk_put_buffer(int64_t dst_locale, void* dst_addr, int64_t dst_len,
+                      qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end)
+{
+  int64_t num_bytes = qbuffer_iter_num_bytes(start, end);
+
+  if( num_bytes < 0 || start.offset < buf->offset_start || end.offset > buf->offset_end )  QIO_RETURN_CONSTANT_ERROR(EINVAL, "range outside of buffer");
+
+  if( num_bytes > dst_len ) QIO_RETURN_CONSTANT_ERROR(EMSGSIZE, "no space in buffer");
+
+  return bulk_xfer_buffer(1, dst_locale, dst_addr, buf, start, end);
+}
+
+static
+int bulk_can_peek(qio_channel_t* ch)
+{
+  return (ch->hints & QIO_CHTYPEMASK) != QIO_CH_ALWAYS_UNBUFFERED;
+}
+
+// Get up to a chunk of the channel's buffer to read from or write into.
+// If the channel can't supply that much, settle for what it has.
+static
+qioerr bulk_peek(qio_channel_t* ch, int64_t want, int writing,
+                 qbuffer_t** buf, qbuffer_iter_t* start, qbuffer_iter_t* end)
+{
+  qioerr before = qio_channel_error(ch);
+  qioerr err;
+
+  if( want > BULK_CHUNK_SIZE ) want = BULK_CHUNK_SIZE;
+
+  err = qio_channel_begin_peek_buffer(false, ch, want, writing,
+                                      buf, start, end);
+  if( qio_err_to_int(err) == EEOF && want > 1 ) {
+    // The failed peek left EEOF on the channel.  Put back the error it
+    // had before; the retry records EEOF again if nothing is left.
+    qio_channel_clear_error(ch);
+    _qio_channel_set_error_unlocked(ch, before);
+    err = qio_channel_begin_peek_buffer(false, ch, 1, writing,
+                                        buf, start, end);
+  }
+  return err;
+}
+
+qioerr bulk_put_channel(int64_t dst_locale, void* dst_addr, int64_t dst_len,
+                        qio_channel_t* ch, int64_t* amt_read)
+{
+  qbuffer_t* buf;
+  qbuffer_iter_t start;
+  qbuffer_iter_t end;
+  int64_t done = 0;
+  int64_t n;
+  ssize_t got;
+  void* bounce;
+  qioerr err = 0;
+
+  if( dst_locale == chpl_nodeID ) {
+    // qio_channel_read will already read large requests
+    // straight into dst_addr.
+    err = qio_channel_read(false, ch, dst_addr, dst_len, &got);
+    *amt_read = got;
+    return err;
   }
 
-  MAYBE_STACK_FREE(iov, iov_onstack);
-  return 0;
+  if( ! bulk_can_peek(ch) ) {
+    bounce = qio_malloc(BULK_CHUNK_SIZE);
+    if( ! bounce ) return QIO_ENOMEM;
+    while( done < dst_len ) {
+      n = dst_len - done;
+      if( n > BULK_CHUNK_SIZE ) n = BULK_CHUNK_SIZE;
+      got = 0;
+      err = qio_channel_read(false, ch, bounce, n, &got);
+      if( got > 0 ) {
+        chpl_gen_comm_put(bounce, dst_locale, PTR_ADDBYTES(dst_addr, done),
+                          sizeof(uint8_t)*got, CHPL_TYPE_uint8_t,
+                          -1, CHPL_FILE_IDX_INTERNAL);
+        done += got;
+      }
+      if( err ) break;
+    }
+    qio_free(bounce);
+    *amt_read = done;
+    return err;
+  }
 
-error_nospace:
-  QIO_RETURN_CONSTANT_ERROR(EMSGSIZE, "no space in buffer");
-error:
-  MAYBE_STACK_FREE(iov, iov_onstack);
+  while( done < dst_len ) {
+    err = bulk_peek(ch, dst_len - done, 0, &buf, &start, &end);
+    if( err ) break;
+
+    n = qbuffer_iter_num_bytes(start, end);
+    if( n > dst_len - done ) {
+      n = dst_len - done;
+      end = start;
+      qbuffer_iter_advance(buf, &end, n);
+    }
+
+    err = bulk_xfer_buffer(1, dst_locale, PTR_ADDBYTES(dst_addr, done),
+                           buf, start, end);
+    if( err ) {
+      qio_channel_end_peek_buffer(false, ch, 0);
+      break;
+    }
+
+    done += n;
+    err = qio_channel_end_peek_buffer(false, ch, n);
+    if( err ) break;
+  }
+
+  *amt_read = done;
   return err;
 }
 
+qioerr bulk_get_channel(qio_channel_t* ch,
+                        int64_t src_locale, void* src_addr, int64_t src_len)
+{
+  qbuffer_t* buf;
+  qbuffer_iter_t start;
+  qbuffer_iter_t end;
+  int64_t done = 0;
+  int64_t n;
+  ssize_t wrote;
+  void* bounce;
+  qioerr err = 0;
+
+  if( src_locale == chpl_nodeID ) {
+    return qio_channel_write(false, ch, src_addr, src_len, &wrote);
+  }
+
+  if( ! bulk_can_peek(ch) ) {
+    bounce = qio_malloc(BULK_CHUNK_SIZE);
+    if( ! bounce ) return QIO_ENOMEM;
+    while( done < src_len ) {
+      n = src_len - done;
+      if( n > BULK_CHUNK_SIZE ) n = BULK_CHUNK_SIZE;
+      chpl_gen_comm_get(bounce, src_locale, PTR_ADDBYTES(src_addr, done),
+                        sizeof(uint8_t)*n, CHPL_TYPE_uint8_t,
+                        -1, CHPL_FILE_IDX_INTERNAL);
+      err = qio_channel_write(false, ch, bounce, n, &wrote);
+      if( err ) break;
+      done += n;
+    }
+    qio_free(bounce);
+    return err;
+  }
+
+  while( done < src_len ) {
+    err = bulk_peek(ch, src_len - done, 1, &buf, &start, &end);
+    if( err ) break;
+
+    // Like _qio_buffered_write, fill whatever buffer space there is.
+    n = qbuffer_iter_num_bytes_after(buf, start);
+    if( n > src_len - done ) n = src_len - done;
+    end = start;
+    qbuffer_iter_advance(buf, &end, n);
+
+    err = bulk_xfer_buffer(0, src_locale, PTR_ADDBYTES(src_addr, done),
+                           buf, start, end);
+    if( err ) {
+      qio_channel_end_peek_buffer(false, ch, 0);
+      break;
+    }
+
+    done += n;
+    err = qio_channel_end_peek_buffer(false, ch, n);
+    if( err ) break;
+  }
+
+  return err;
+}
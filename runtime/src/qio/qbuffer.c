@@ -21,6 +21,7 @@
 
 #ifndef CHPL_RT_UNIT_TEST
 #include "chplrt.h"
+#include "chpl-env.h"
 #endif
 
 #include "qbuffer.h"
@@ -29,6 +30,8 @@
 
 #include "sys.h"
 
+#include "chpl-thread-local-storage.h"
+
 #include <limits.h>
 #include <sys/mman.h>
 
@@ -85,9 +88,231 @@ void qbytes_free_qio_free(qbytes_t* b) {
   qio_free(b->data);
   _qbytes_free_qbytes(b);
 }
+
+
+// *** iobuf pool *** //
+//
+// Freed iobufs are kept for reuse instead of going back to the heap.
+// Each thread keeps a few of each size in a private cache.  When that
+// fills up, half of them move to a global depot, which a thread with
+// an empty cache refills from.  The depot is bounded; iobufs that don't
+// fit in it are freed.  Only power-of-two sizes from 4K to 4M are
+// pooled, which covers any sensible qbytes_iobuf_size.
+
+// The per-thread caches are not counted as Chapel allocations, any more
+// than the iobufs themselves are (see qio_valloc).
+#ifndef CHPL_RT_UNIT_TEST
+#define qio_iobuf_env_size(name, dflt) chpl_get_rt_env_size(name, dflt)
+#define qio_iobuf_sys_calloc(n, size) chpl_calloc(n, size)
+#define qio_iobuf_sys_free(ptr) chpl_free(ptr)
+#else
+#define qio_iobuf_env_size(name, dflt) (dflt)
+#define qio_iobuf_sys_calloc(n, size) calloc(n, size)
+#define qio_iobuf_sys_free(ptr) free(ptr)
+#endif
+
+#define QIO_IOBUF_MIN_SHIFT 12
+#define QIO_IOBUF_MAX_SHIFT 22
+#define QIO_IOBUF_NCLASSES (QIO_IOBUF_MAX_SHIFT - QIO_IOBUF_MIN_SHIFT + 1)
+
+// How many iobufs of each size a thread keeps for itself.
+#define QIO_IOBUF_THREAD_CACHE 8
+
+typedef struct {
+  int n[QIO_IOBUF_NCLASSES];
+  void* bufs[QIO_IOBUF_NCLASSES][QIO_IOBUF_THREAD_CACHE];
+} qio_iobuf_cache_t;
+
+// The depot for each size class is a list linked through the first
+// word of each free iobuf.
+typedef struct {
+  pthread_mutex_t lock;
+  void* head;
+} qio_iobuf_depot_t;
+
+static qio_iobuf_depot_t iobuf_depot[QIO_IOBUF_NCLASSES];
+static size_t iobuf_depot_max;     // bytes; 0 turns the pool off
+static size_t iobuf_depot_bytes;   // in all classes; updated atomically
+static pthread_once_t iobuf_pool_once = PTHREAD_ONCE_INIT;
+static pthread_key_t iobuf_cache_key;
+CHPL_TLS_DECL(qio_iobuf_cache_t*, iobuf_cache);
+
+// Statistics, updated with relaxed atomics.
+static uint64_t iobuf_stat_allocs;
+static uint64_t iobuf_stat_hits;
+static uint64_t iobuf_stat_held;
+
+static inline
+void iobuf_stat_add(uint64_t* stat, int64_t n)
+{
+  __atomic_fetch_add(stat, n, __ATOMIC_RELAXED);
+}
+
+static
+int iobuf_class(size_t size)
+{
+  int shift;
+
+  for( shift = QIO_IOBUF_MIN_SHIFT; shift <= QIO_IOBUF_MAX_SHIFT; shift++ ) {
+    if( size == ((size_t) 1 << shift) ) return shift - QIO_IOBUF_MIN_SHIFT;
+  }
+  return -1;
+}
+
+static
+void iobuf_depot_put(int c, void* buf)
+{
+  size_t size = (size_t) 1 << (c + QIO_IOBUF_MIN_SHIFT);
+  size_t old;
+
+  // Reserve room in the budget, which all the size classes share,
+  // before taking the class's lock.
+  old = __atomic_fetch_add(&iobuf_depot_bytes, size, __ATOMIC_RELAXED);
+  if( old + size > iobuf_depot_max ) {
+    __atomic_fetch_sub(&iobuf_depot_bytes, size, __ATOMIC_RELAXED);
+    iobuf_stat_add(&iobuf_stat_held, -(int64_t) size);
+    qio_free(buf);
+    return;
+  }
+
+  pthread_mutex_lock(&iobuf_depot[c].lock);
+  *(void**) buf = iobuf_depot[c].head;
+  iobuf_depot[c].head = buf;
+  pthread_mutex_unlock(&iobuf_depot[c].lock);
+}
+
+static
+void* iobuf_depot_get(int c)
+{
+  size_t size = (size_t) 1 << (c + QIO_IOBUF_MIN_SHIFT);
+  void* buf;
+
+  pthread_mutex_lock(&iobuf_depot[c].lock);
+  buf = iobuf_depot[c].head;
+  if( buf ) iobuf_depot[c].head = *(void**) buf;
+  pthread_mutex_unlock(&iobuf_depot[c].lock);
+
+  if( buf ) __atomic_fetch_sub(&iobuf_depot_bytes, size, __ATOMIC_RELAXED);
+
+  return buf;
+}
+
+// Runs when a thread exits: hand its iobufs to the depot.
+static
+void iobuf_cache_destroy(void* arg)
+{
+  qio_iobuf_cache_t* cache = (qio_iobuf_cache_t*) arg;
+  int c;
+
+  for( c = 0; c < QIO_IOBUF_NCLASSES; c++ ) {
+    while( cache->n[c] > 0 ) {
+      iobuf_depot_put(c, cache->bufs[c][--cache->n[c]]);
+    }
+  }
+  qio_iobuf_sys_free(cache);
+}
+
+static
+void iobuf_pool_init(void)
+{
+  int c;
+
+  iobuf_depot_max = qio_iobuf_env_size("QIO_IOBUF_POOL", 16*1024*1024);
+  for( c = 0; c < QIO_IOBUF_NCLASSES; c++ ) {
+    pthread_mutex_init(&iobuf_depot[c].lock, NULL);
+  }
+  pthread_key_create(&iobuf_cache_key, iobuf_cache_destroy);
+  CHPL_TLS_INIT(iobuf_cache);
+}
+
+static
+qio_iobuf_cache_t* iobuf_thread_cache(void)
+{
+  qio_iobuf_cache_t* cache;
+
+  pthread_once(&iobuf_pool_once, iobuf_pool_init);
+  if( iobuf_depot_max == 0 ) return NULL;
+
+  cache = (qio_iobuf_cache_t*) CHPL_TLS_GET(iobuf_cache);
+  if( ! cache ) {
+    cache = (qio_iobuf_cache_t*) qio_iobuf_sys_calloc(1, sizeof(qio_iobuf_cache_t));
+    if( ! cache ) return NULL;
+    CHPL_TLS_SET(iobuf_cache, cache);
+    pthread_setspecific(iobuf_cache_key, cache);
+  }
+  return cache;
+}
+
+static
+void* iobuf_pool_get(size_t size)
+{
+  qio_iobuf_cache_t* cache;
+  int c = iobuf_class(size);
+  int i;
+  void* buf = NULL;
+
+  iobuf_stat_add(&iobuf_stat_allocs, 1);
+
+  if( c < 0 ) return NULL;
+  cache = iobuf_thread_cache();
+  if( ! cache ) return NULL;
+
+  if( cache->n[c] == 0 ) {
+    // Refill half the cache from the depot.
+    for( i = 0; i < QIO_IOBUF_THREAD_CACHE / 2; i++ ) {
+      buf = iobuf_depot_get(c);
+      if( ! buf ) break;
+      cache->bufs[c][cache->n[c]++] = buf;
+    }
+  }
+
+  if( cache->n[c] == 0 ) return NULL;
+
+  buf = cache->bufs[c][--cache->n[c]];
+  iobuf_stat_add(&iobuf_stat_hits, 1);
+  iobuf_stat_add(&iobuf_stat_held, -(int64_t) size);
+  return buf;
+}
+
+static
+void iobuf_pool_put(void* buf, size_t size)
+{
+  qio_iobuf_cache_t* cache;
+  int c = iobuf_class(size);
+  int i;
+
+  cache = (c < 0) ? NULL : iobuf_thread_cache();
+  if( ! cache ) {
+    qio_free(buf);
+    return;
+  }
+
+  iobuf_stat_add(&iobuf_stat_held, size);
+
+  if( cache->n[c] == QIO_IOBUF_THREAD_CACHE ) {
+    // Move the older half of the cache to the depot.
+    for( i = 0; i < QIO_IOBUF_THREAD_CACHE / 2; i++ ) {
+      iobuf_depot_put(c, cache->bufs[c][i]);
+    }
+    for( i = QIO_IOBUF_THREAD_CACHE / 2; i < QIO_IOBUF_THREAD_CACHE; i++ ) {
+      cache->bufs[c][i - QIO_IOBUF_THREAD_CACHE / 2] = cache->bufs[c][i];
+    }
+    cache->n[c] -= QIO_IOBUF_THREAD_CACHE / 2;
+  }
+
+  cache->bufs[c][cache->n[c]++] = buf;
+}
+
+void qio_iobuf_pool_stats(uint64_t* allocs, uint64_t* hits, uint64_t* held_bytes)
+{
+  *allocs = __atomic_load_n(&iobuf_stat_allocs, __ATOMIC_RELAXED);
+  *hits = __atomic_load_n(&iobuf_stat_hits, __ATOMIC_RELAXED);
+  *held_bytes = __atomic_load_n(&iobuf_stat_held, __ATOMIC_RELAXED);
+}
+
 void qbytes_free_iobuf(qbytes_t* b) {
-  // iobuf is just something to be freed with free()
-  qbytes_free_qio_free(b);
+  iobuf_pool_put(b->data, b->len);
+  _qbytes_free_qbytes(b);
 }
 
 void debug_print_bytes(qbytes_t* b)
@@ -148,9 +373,12 @@ qioerr _qbytes_init_iobuf(qbytes_t* ret)
 {
   void* data = NULL;
   
-  // allocate 4K-aligned (or page size aligned)
-  // multiple of 4K
-  data = qio_valloc(qbytes_iobuf_size);
+  data = iobuf_pool_get(qbytes_iobuf_size);
+  if( !data ) {
+    // allocate 4K-aligned (or page size aligned)
+    // multiple of 4K
+    data = qio_valloc(qbytes_iobuf_size);
+  }
   if( !data ) return QIO_ENOMEM;
   // We used to use posix_memalign, but that didn't work on an old Mac;
   // also, this should be page-aligned (vs iobuf_size aligned).
@@ -543,7 +771,7 @@ void qbuffer_trim_back(qbuffer_t* buf, int64_t remove_bytes)
         qbytes_t* bytes = qbp->bytes;
         // starts entirely after new_end, remove the chunk.
         // Remove it from the deque
-        deque_pop_front(sizeof(qbuffer_part_t), &buf->deque);
+        deque_pop_back(sizeof(qbuffer_part_t), &buf->deque);
         // release the bytes.
         qbytes_release(bytes);
       } else {
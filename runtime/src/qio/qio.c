@@ -36,6 +36,7 @@
 #endif
 
 #include "qio.h"
+#include "qio_async.h"
 #include "qbuffer.h"
 
 #include "error.h"
@@ -47,6 +48,7 @@
 #include <errno.h>
 #include <limits.h>
 #include <sys/time.h>
+#include <time.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netdb.h>
@@ -223,7 +225,9 @@ error:
   return err;
 }
 
-qioerr qio_preadv(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int64_t seek_to_offset, ssize_t* num_read)
+// async: use qio_async_preadv (for QIO_METHOD_ASYNC channels)
+static
+qioerr _qio_preadv(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int64_t seek_to_offset, int async, ssize_t* num_read)
 {
   ssize_t nread = 0;
   int64_t num_bytes = qbuffer_iter_num_bytes(start, end);
@@ -249,6 +253,9 @@ qioerr qio_preadv(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffe
   if( err ) goto error;
 
   // read into our buffer.
+  if (file->fd != -1 && async)
+    err = qio_int_to_err(qio_async_preadv(file->fd, iov, iovcnt, seek_to_offset, &nread));
+  else
   if (file->fd != -1) // Do we have an fd?
     err = qio_int_to_err(sys_preadv(file->fd, iov, iovcnt, seek_to_offset, &nread));
   else 
@@ -268,6 +275,11 @@ error:
 
 }
 
+qioerr qio_preadv(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int64_t seek_to_offset, ssize_t* num_read)
+{
+  return _qio_preadv(file, buf, start, end, seek_to_offset, 0, num_read);
+}
+
 qioerr qio_freadv(FILE* fp, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, ssize_t* num_read)
 {
   int64_t total_read = 0;
@@ -365,7 +377,9 @@ error:
 
 
 
-qioerr qio_pwritev(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int64_t seek_to_offset, ssize_t* num_written)
+// async: use qio_async_pwritev (for QIO_METHOD_ASYNC channels)
+static
+qioerr _qio_pwritev(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int64_t seek_to_offset, int async, ssize_t* num_written)
 {
   ssize_t nwritten = 0;
   int64_t num_bytes = qbuffer_iter_num_bytes(start, end);
@@ -391,6 +405,9 @@ qioerr qio_pwritev(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuff
   if( err ) goto error;
 
   // write from our buffer
+  if (file->fd != -1 && async)
+    err = qio_int_to_err(qio_async_pwritev(file->fd, iov, iovcnt, seek_to_offset, &nwritten));
+  else
   if (file->fd != -1) // So see if we have an fd we can use
     err = qio_int_to_err(sys_pwritev(file->fd, iov, iovcnt, seek_to_offset, &nwritten));
   else // Don't have an fd
@@ -410,6 +427,11 @@ error:
   return err;
 }
 
+qioerr qio_pwritev(qio_file_t* file, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int64_t seek_to_offset, ssize_t* num_written)
+{
+  return _qio_pwritev(file, buf, start, end, seek_to_offset, 0, num_written);
+}
+
 qioerr qio_recv(fd_t sockfd, qbuffer_t* buf, qbuffer_iter_t start, qbuffer_iter_t end, int flags,
               sys_sockaddr_t* src_addr_out, /* can be NULL */
               void* ancillary_out, socklen_t* ancillary_len_inout, /* can be NULL */
@@ -532,7 +554,11 @@ qio_hint_t choose_io_method(qio_file_t* file, qio_hint_t hints, qio_hint_t defau
   ret &= ~(QIO_METHODMASK|QIO_CHTYPEMASK); // clear method number, channel type
 
   // 'or' in hints from default_hints.
-  ret |= (default_hints & ~(QIO_METHODMASK|QIO_CHTYPEMASK));
+  ret |= (default_hints & ~(QIO_METHODMASK|QIO_CHTYPEMASK|QIO_HINT_PIPELINE_MASK));
+
+  // a pipeline depth for the channel replaces the file's.
+  if( ! (hints & QIO_HINT_PIPELINE_MASK) )
+    ret |= (default_hints & QIO_HINT_PIPELINE_MASK);
 
   if (file->fsfns) { // We have a foreign FS
     if(fdflags & QIO_FDFLAG_SEEKABLE) { // We can seek
@@ -587,6 +613,11 @@ qio_hint_t choose_io_method(qio_file_t* file, qio_hint_t hints, qio_hint_t defau
       }
     } else {
       // method already chosen in hints.
+      if( method == QIO_METHOD_ASYNC ) {
+        // async I/O is positional, so it needs a seekable fd.
+        if( isfilestar ) method = QIO_METHOD_FREADFWRITE;
+        else if( ! (fdflags & QIO_FDFLAG_SEEKABLE) ) method = QIO_METHOD_READWRITE;
+      }
     }
   }
 
@@ -1430,6 +1461,81 @@ qioerr qio_file_length(qio_file_t* f, int64_t *len_out)
   return err;
 }
 
+qioerr qio_file_map_region(qio_file_t* f, int64_t offset, int64_t len,
+                           int writeback, qio_hint_t hints,
+                           void** region_out, void** data_out)
+{
+  struct stat stats;
+  long pagesize;
+  int64_t map_start;
+  int64_t skip;
+  int prot = PROT_READ | PROT_WRITE;
+  int flags;
+  void* data;
+  qbytes_t* bytes;
+  qioerr err;
+
+  *region_out = NULL;
+  *data_out = NULL;
+
+  if( f->fd == -1 ) QIO_RETURN_CONSTANT_ERROR(ENOSYS, "file has no descriptor to map");
+  if( offset < 0 || len <= 0 ) QIO_RETURN_CONSTANT_ERROR(EINVAL, "invalid region to map");
+  if( writeback && ! (f->fdflags & QIO_FDFLAG_WRITEABLE) ) {
+    QIO_RETURN_CONSTANT_ERROR(EBADF, "write-back mapping of a file not open for writing");
+  }
+
+  if( hints == 0 ) hints = f->hints;
+
+  // mmap wants a page-aligned file offset.
+  pagesize = sys_page_size();
+  map_start = (offset / pagesize) * pagesize;
+  skip = offset - map_start;
+
+  // This check is (only) important for 32-bit systems.
+  if( len + skip > SSIZE_MAX ) QIO_RETURN_CONSTANT_ERROR(EOVERFLOW, "overflow in mmap");
+
+  err = qio_int_to_err(sys_fstat(f->fd, &stats));
+  if( err ) return err;
+
+  if( offset + len > stats.st_size ) {
+    // Touching a mapped page past the end of the file is a SIGBUS,
+    // so either grow the file or refuse.
+    if( ! writeback ) QIO_RETURN_CONSTANT_ERROR(EEOF, "file too short for mapped region");
+    err = qio_int_to_err(sys_ftruncate(f->fd, offset + len));
+    if( err ) return err;
+  }
+
+  // Without write-back, stores go to private copies of the pages.
+  flags = writeback ? MAP_SHARED : MAP_PRIVATE;
+#ifdef MAP_POPULATE
+  if( hints & QIO_HINT_CACHED ) flags |= MAP_POPULATE;
+#endif
+
+  err = qio_int_to_err(sys_mmap(NULL, len + skip, prot, flags, f->fd, map_start, &data));
+  if( err ) return err;
+
+  err = qio_madvise_for_hints(data, len + skip, hints);
+  if( err ) {
+    sys_munmap(data, len + skip);
+    return err;
+  }
+
+  err = qbytes_create_generic(&bytes, data, len + skip, qbytes_free_munmap);
+  if( err ) {
+    sys_munmap(data, len + skip);
+    return err;
+  }
+
+  *region_out = bytes;
+  *data_out = qio_ptr_add(data, skip);
+  return 0;
+}
+
+void qio_file_unmap_region(void* region)
+{
+  qbytes_release((qbytes_t*) region);
+}
+
 /* CHANNELS ----------------------------- */
 static
 qioerr _qio_channel_init(qio_channel_t* ch, qio_chtype_t type)
@@ -1808,6 +1914,299 @@ qioerr qio_channel_path_offset(const int threadsafe, qio_channel_t* ch, const ch
   return err;
 }
 
+// ---- Pipelined read-ahead and write-behind ----
+//
+// A buffered channel with QIO_HINT_PIPELINE(depth) keeps up to 'depth'
+// qio_async requests in flight, each covering at most one iobuf.
+//
+// A reading channel starts reads for the iobufs after av_end before
+// they are needed. While any are in flight, the end of the buffer is
+// the end of the last read started, and the oldest read starts at
+// av_end.
+//
+// A writing channel starts a write for each part _qio_buffered_behind
+// would have written, holding a reference to the part's bytes until
+// the write finishes. Errors from these writes are reported by the
+// next write-behind or flush.
+//
+// Channels that both read and write do ordinary I/O.
+
+typedef struct qio_pipeline_ent_s {
+  qio_async_req_t req;
+  struct iovec iov;
+  qbytes_t* bytes; // retained while a write is in flight
+} qio_pipeline_ent_t;
+
+typedef struct qio_pipeline_s {
+  int depth;
+  int head;  // index of the oldest request
+  int count; // number of requests in flight
+  qioerr error; // first write-behind error
+  int64_t stall_ns;
+  qio_pipeline_ent_t ent[QIO_MAX_PIPELINE_DEPTH];
+} qio_pipeline_t;
+
+static
+int _qio_pipeline_depth(qio_channel_t* ch)
+{
+  qio_method_t method = (qio_method_t) (ch->hints & QIO_METHODMASK);
+  int readable = (ch->flags & QIO_FDFLAG_READABLE) != 0;
+  int writeable = (ch->flags & QIO_FDFLAG_WRITEABLE) != 0;
+
+  if( method != QIO_METHOD_PREADPWRITE && method != QIO_METHOD_ASYNC ) return 0;
+  if( ch->hints & QIO_HINT_DIRECT ) return 0;
+  if( readable == writeable ) return 0;
+  if( ! ch->file || ch->file->fsfns || ch->file->fd == -1 ) return 0;
+
+  return (ch->hints & QIO_HINT_PIPELINE_MASK) >> QIO_HINT_PIPELINE_SHIFT;
+}
+
+// Returns NULL if the channel is not pipelined. If we can't allocate
+// the pipeline we just do synchronous I/O.
+static
+qio_pipeline_t* _qio_pipeline_get(qio_channel_t* ch)
+{
+  int depth;
+
+  if( ch->pipe ) return ch->pipe;
+
+  depth = _qio_pipeline_depth(ch);
+  if( depth == 0 ) return NULL;
+
+  ch->pipe = (qio_pipeline_t*) qio_calloc(1, sizeof(qio_pipeline_t));
+  if( ch->pipe ) ch->pipe->depth = depth;
+  return ch->pipe;
+}
+
+static inline
+int64_t _qio_now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline
+qio_pipeline_ent_t* _qio_pipeline_next(qio_pipeline_t* p)
+{
+  return &p->ent[(p->head + p->count) % QIO_MAX_PIPELINE_DEPTH];
+}
+
+// Waits for the oldest request and removes it from the pipeline.
+// The returned entry stays valid until the next request is started.
+static
+err_t _qio_pipeline_wait_oldest(qio_pipeline_t* p, qio_pipeline_ent_t** ent_out, ssize_t* num_out)
+{
+  qio_pipeline_ent_t* ent = &p->ent[p->head];
+  int64_t start;
+  err_t errcode;
+
+  if( qio_async_test(&ent->req) ) {
+    errcode = qio_async_wait(&ent->req, num_out);
+  } else {
+    start = _qio_now_ns();
+    errcode = qio_async_wait(&ent->req, num_out);
+    p->stall_ns += _qio_now_ns() - start;
+  }
+
+  p->head = (p->head + 1) % QIO_MAX_PIPELINE_DEPTH;
+  p->count--;
+  *ent_out = ent;
+  return errcode;
+}
+
+// Start reads of whole iobufs after the end of the buffer until
+// the pipeline is full or the channel's end is covered.
+static
+qioerr _qio_pipeline_issue_reads(qio_channel_t* ch, qio_pipeline_t* p)
+{
+  qio_pipeline_ent_t* ent;
+  qbytes_t* tmp;
+  int64_t offset;
+  int64_t len;
+  qioerr err;
+
+  while( p->count < p->depth ) {
+    offset = qbuffer_end_offset(&ch->buf);
+    if( offset >= ch->end_pos ) break;
+
+    err = qbytes_create_iobuf(&tmp);
+    if( err ) return err;
+    len = tmp->len;
+    if( len > ch->end_pos - offset ) len = ch->end_pos - offset;
+
+    ent = _qio_pipeline_next(p);
+    ent->iov.iov_base = tmp->data;
+    ent->iov.iov_len = len;
+    ent->bytes = NULL;
+
+    // The buffer keeps tmp alive until the read is retired.
+    err = qbuffer_append(&ch->buf, tmp, 0, len);
+    qbytes_release(tmp);
+    if( err ) return err;
+
+    qio_async_start(&ent->req, QIO_ASYNC_READ, ch->file->fd,
+                    &ent->iov, 1, offset);
+    p->count++;
+  }
+
+  return 0;
+}
+
+// Waits for any reads in flight and drops the buffer space after av_end.
+static
+void _qio_pipeline_cancel_reads(qio_channel_t* ch, qio_pipeline_t* p)
+{
+  qio_pipeline_ent_t* ent;
+  ssize_t num_read;
+  int64_t end;
+
+  while( p->count > 0 ) {
+    (void) _qio_pipeline_wait_oldest(p, &ent, &num_read);
+  }
+
+  if( qbuffer_is_initialized(&ch->buf) ) {
+    end = qbuffer_end_offset(&ch->buf);
+    if( end > ch->av_end ) qbuffer_trim_back(&ch->buf, end - ch->av_end);
+  }
+}
+
+// Like _buffered_read_atleast, for a pipelined channel.
+// amt must not take av_end past end_pos.
+static
+qioerr _buffered_read_pipelined(qio_channel_t* ch, qio_pipeline_t* p, int64_t amt)
+{
+  qio_pipeline_ent_t* ent;
+  int64_t target = ch->av_end + amt;
+  ssize_t num_read;
+  err_t errcode;
+  int interrupted;
+  qioerr err = 0;
+
+  // Drop any space a short read left after av_end.
+  if( p->count == 0 ) _qio_pipeline_cancel_reads(ch, p);
+
+  while( ch->av_end < target ) {
+    err = _qio_pipeline_issue_reads(ch, p);
+    if( err ) break;
+    if( p->count == 0 ) break;
+
+    errcode = _qio_pipeline_wait_oldest(p, &ent, &num_read);
+    assert( ent->req.offset == ch->av_end );
+    interrupted = (errcode == EINTR);
+    if( interrupted ) errcode = 0;
+
+    ch->av_end += num_read;
+
+    if( errcode || num_read < (ssize_t) ent->iov.iov_len ) {
+      // The later reads don't start at av_end any more (or are past EOF).
+      _qio_pipeline_cancel_reads(ch, p);
+      if( errcode ) {
+        err = qio_int_to_err(errcode);
+        break;
+      }
+      if( num_read == 0 && ! interrupted ) {
+        err = QIO_EEOF;
+        break;
+      }
+    }
+  }
+
+  if( ! err ) err = _qio_pipeline_issue_reads(ch, p);
+
+  return err;
+}
+
+// Waits for the oldest write, finishing it synchronously if it was
+// short, and drops our reference to its bytes.
+static
+void _qio_pipeline_retire_write(qio_channel_t* ch, qio_pipeline_t* p)
+{
+  qio_pipeline_ent_t* ent;
+  ssize_t num_written;
+  ssize_t done;
+  err_t errcode;
+
+  errcode = _qio_pipeline_wait_oldest(p, &ent, &num_written);
+  done = num_written;
+  if( errcode == EINTR ) errcode = 0;
+
+  while( ! errcode && done < (ssize_t) ent->iov.iov_len ) {
+    errcode = sys_pwrite(ch->file->fd, qio_ptr_add(ent->iov.iov_base, done),
+                         ent->iov.iov_len - done, ent->req.offset + done,
+                         &num_written);
+    if( errcode == EINTR ) errcode = 0;
+    done += num_written;
+  }
+
+  if( errcode && ! p->error ) p->error = qio_int_to_err(errcode);
+
+  qbytes_release(ent->bytes);
+  ent->bytes = NULL;
+}
+
+// Starts writes for the parts in [*write_start, write_end) and moves
+// *write_start to write_end. Waits for the oldest writes when the
+// pipeline is full, and for all of them if flushall is set.
+static
+qioerr _qio_buffered_behind_pipelined(qio_channel_t* ch, qio_pipeline_t* p, qbuffer_iter_t* write_start, qbuffer_iter_t write_end, int flushall)
+{
+  qio_pipeline_ent_t* ent;
+  qbuffer_iter_t cur = *write_start;
+  qbytes_t* bytes;
+  int64_t skip;
+  int64_t len;
+
+  while( qbuffer_iter_num_bytes(cur, write_end) > 0 ) {
+    qbuffer_iter_get(cur, write_end, &bytes, &skip, &len);
+
+    if( len > 0 ) {
+      if( p->count == p->depth ) _qio_pipeline_retire_write(ch, p);
+
+      qbytes_retain(bytes);
+      ent = _qio_pipeline_next(p);
+      ent->iov.iov_base = qio_ptr_add(bytes->data, skip);
+      ent->iov.iov_len = len;
+      ent->bytes = bytes;
+      qio_async_start(&ent->req, QIO_ASYNC_WRITE, ch->file->fd,
+                      &ent->iov, 1, cur.offset);
+      p->count++;
+    }
+
+    qbuffer_iter_next_part(&ch->buf, &cur);
+  }
+  *write_start = write_end;
+
+  if( flushall ) {
+    while( p->count > 0 ) _qio_pipeline_retire_write(ch, p);
+  }
+
+  return p->error;
+}
+
+// Finishes or cancels whatever the pipeline has in flight.
+static
+qioerr _qio_pipeline_drain(qio_channel_t* ch)
+{
+  qio_pipeline_t* p = ch->pipe;
+
+  if( ! p ) return 0;
+
+  if( ch->flags & QIO_FDFLAG_WRITEABLE ) {
+    while( p->count > 0 ) _qio_pipeline_retire_write(ch, p);
+    return p->error;
+  }
+
+  _qio_pipeline_cancel_reads(ch, p);
+  return 0;
+}
+
+int64_t qio_channel_stall_time_unlocked(qio_channel_t* ch)
+{
+  if( ! ch->pipe ) return 0;
+  return ch->pipe->stall_ns;
+}
+
 qioerr _qio_channel_final_flush_unlocked(qio_channel_t* ch)
 {
   qioerr err = 0;
@@ -1822,6 +2221,9 @@ qioerr _qio_channel_final_flush_unlocked(qio_channel_t* ch)
   if( ! ch->file ) return 0;
 
   err = _qio_channel_flush_unlocked(ch);
+  // Nothing may be in flight once the buffer is gone.
+  if( ! err ) err = _qio_pipeline_drain(ch);
+  else (void) _qio_pipeline_drain(ch);
   if( ! err ) {
     // If we have a buffered writing MMAP channel, we need to truncate
     // the file under the right circumstances. See the comment
@@ -1886,6 +2288,14 @@ qioerr _qio_channel_final_flush_unlocked(qio_channel_t* ch)
 
   ch->hints |= QIO_CHTYPE_CLOSED; // set to invalid type so funcs return EINVAL
 
+  // A plugin file used only by this channel (such as the filter made by
+  // qio_channel_create_compress) is closed now, so that errors from
+  // finishing its output are reported by this close.
+  if( ch->file->fsfns && DO_GET_REFCNT(ch->file) == 1 ) {
+    err = qio_file_close(ch->file);
+    if( ! flush_or_truncate_error ) flush_or_truncate_error = err;
+  }
+
   qio_file_release(ch->file);
   ch->file = NULL;
 
@@ -1912,6 +2322,9 @@ void _qio_channel_destroy(qio_channel_t* ch)
   qio_file_release(ch->file);
   ch->file = NULL;
 
+  qio_free(ch->pipe);
+  ch->pipe = NULL;
+
   DO_DESTROY_REFCNT(ch);
 
   qio_free(ch);
@@ -2281,6 +2694,7 @@ qioerr _buffered_read_atleast(qio_channel_t* ch, int64_t amt)
   int return_eof = 0;
   qioerr err;
   qio_method_t method = (qio_method_t) (ch->hints & QIO_METHODMASK);
+  qio_pipeline_t* pipe;
 
   err = _qio_channel_needbuffer_unlocked(ch);
   if( err ) return err;
@@ -2297,6 +2711,14 @@ qioerr _buffered_read_atleast(qio_channel_t* ch, int64_t amt)
     return_eof = 1;
   }
 
+  pipe = _qio_pipeline_get(ch);
+  if( pipe ) {
+    err = _buffered_read_pipelined(ch, pipe, amt);
+    if( err ) return err;
+    if( return_eof ) return QIO_EEOF;
+    else return 0;
+  }
+
   //printf("Allocating bufferspace %lli\n", (long long int) amt);
   err = _buffered_allocate_bufferspace(ch, amt, max_amt);
   if( err ) return err;
@@ -2320,6 +2742,9 @@ qioerr _buffered_read_atleast(qio_channel_t* ch, int64_t amt)
       case QIO_METHOD_PREADPWRITE:
         err = qio_preadv(ch->file, &ch->buf, read_start, read_end, read_start.offset, &num_read);
         break;
+      case QIO_METHOD_ASYNC:
+        err = _qio_preadv(ch->file, &ch->buf, read_start, read_end, read_start.offset, 1, &num_read);
+        break;
       case QIO_METHOD_FREADFWRITE:
         err = qio_freadv(ch->file->fp, &ch->buf, read_start, read_end, &num_read);
         break;
@@ -2504,6 +2929,7 @@ qioerr _qio_buffered_behind(qio_channel_t* ch, int flushall)
   qioerr err;
   ssize_t num_written;
   qio_method_t method = (qio_method_t) (ch->hints & QIO_METHODMASK);
+  qio_pipeline_t* pipe = NULL;
 
   // If we are a FILE* type buffer, we want to automatically
   // flush after every write, so that C I/O can be intermixed
@@ -2539,7 +2965,12 @@ qioerr _qio_buffered_behind(qio_channel_t* ch, int flushall)
     qbuffer_iter_ceil_part(&ch->buf, &write_end);
   }
 
-  if(ch->flags & QIO_FDFLAG_WRITEABLE) {
+  if(ch->flags & QIO_FDFLAG_WRITEABLE) pipe = _qio_pipeline_get(ch);
+
+  if( pipe ) {
+    err = _qio_buffered_behind_pipelined(ch, pipe, &write_start, write_end, flushall);
+    if( err ) goto error;
+  } else if(ch->flags & QIO_FDFLAG_WRITEABLE) {
     while( qbuffer_iter_num_bytes(write_start, write_end) > 0 ) {
       QIO_GET_CONSTANT_ERROR(err, EINVAL, "write method not implemented");
       num_written = 0;
@@ -2550,6 +2981,9 @@ qioerr _qio_buffered_behind(qio_channel_t* ch, int flushall)
         case QIO_METHOD_PREADPWRITE:
           err = qio_pwritev(ch->file, &ch->buf, write_start, write_end, write_start.offset, &num_written);
           break;
+        case QIO_METHOD_ASYNC:
+          err = _qio_pwritev(ch->file, &ch->buf, write_start, write_end, write_start.offset, 1, &num_written);
+          break;
         case QIO_METHOD_FREADFWRITE:
           err = qio_fwritev(ch->file->fp, &ch->buf, write_start, write_end, &num_written);
           break;
@@ -2589,7 +3023,9 @@ error:
   //debug_print_qbuffer(&ch->buf);
 
 done:
-  if( !err ) {
+  // A pipelined write error is from an earlier write-behind,
+  // and the buffer was still trimmed.
+  if( !err || pipe ) {
     _qio_buffered_setup_cached(ch);
   }
 
@@ -2644,17 +3080,16 @@ qioerr _qio_buffered_read(qio_channel_t* ch, void* ptr, ssize_t len, ssize_t* am
   qbuffer_iter_t start;
   qbuffer_iter_t end;
   int64_t gotlen = 0;
+  qioerr read_err;
   qioerr err;
-  int eof;
 
   // handle channel position beyond end.
   if( _right_mark_start(ch) > ch->end_pos ) return QIO_EEOF;
 
   // do the actual read. (require calls advance_cached)
-  err = _qio_channel_require_unlocked(ch, len, 0);
-  eof = 0;
-  if( qio_err_to_int(err) == EEOF ) eof = 1;
-  else if( err ) goto error;
+  // Whatever was read before an error (or EOF) is still returned, along
+  // with the error.
+  read_err = _qio_channel_require_unlocked(ch, len, 0);
 
   // figure out the end of the data to copy
   gotlen = ch->av_end - _right_mark_start(ch);
@@ -2679,8 +3114,7 @@ qioerr _qio_buffered_read(qio_channel_t* ch, void* ptr, ssize_t len, ssize_t* am
   err = _qio_buffered_behind(ch, false);
   if( err ) goto error;
 
-  err = 0;
-  if( eof ) err = QIO_EEOF;
+  err = read_err;
 
 error:
   *amt_read = gotlen;
@@ -2777,6 +3211,14 @@ qioerr _qio_unbuffered_write(qio_channel_t* ch, const void* ptr, ssize_t len_in,
         case QIO_METHOD_PREADPWRITE:
           err = qio_int_to_err(sys_pwrite(ch->file->fd, ptr, len, _right_mark_start(ch), &num_written));
           break;
+        case QIO_METHOD_ASYNC:
+          {
+            struct iovec iov;
+            iov.iov_base = (void*) ptr;
+            iov.iov_len = len;
+            err = qio_int_to_err(qio_async_pwritev(ch->file->fd, &iov, 1, _right_mark_start(ch), &num_written));
+          }
+          break;
         case QIO_METHOD_FREADFWRITE:
           if( ch->file->fp ) {
             num_written_u = fwrite(ptr, 1, len, ch->file->fp);
@@ -2867,6 +3309,14 @@ qioerr _qio_unbuffered_read(qio_channel_t* ch, void* ptr, ssize_t len_in, ssize_
         case QIO_METHOD_PREADPWRITE:
           err = qio_int_to_err(sys_pread(ch->file->fd, ptr, len, _right_mark_start(ch), &num_read));
           break;
+        case QIO_METHOD_ASYNC:
+          {
+            struct iovec iov;
+            iov.iov_base = ptr;
+            iov.iov_len = len;
+            err = qio_int_to_err(qio_async_preadv(ch->file->fd, &iov, 1, _right_mark_start(ch), &num_read));
+          }
+          break;
         case QIO_METHOD_FREADFWRITE:
           if( ch->file->fp ) {
             num_read_u = fread(ptr, 1, len, ch->file->fp);
@@ -2974,7 +3424,9 @@ int _use_buffered(qio_channel_t* ch, ssize_t len)
   qio_chtype_t type = (qio_chtype_t) (ch->hints & QIO_CHTYPEMASK);
   int64_t offset = qio_channel_offset_unlocked(ch);
 
-  if( type == QIO_CH_ALWAYS_UNBUFFERED ) return 0;
+  // Plugin files have no fd for unbuffered I/O to use.
+  if( ch->file && ch->file->fsfns ) return 1;
+  else if( type == QIO_CH_ALWAYS_UNBUFFERED ) return 0;
   // There are cases in which a buffer is required
   else if( type == QIO_CH_ALWAYS_BUFFERED ) return 1;
   else if (qbuffer_is_initialized(&ch->buf)) return 1;
@@ -3392,7 +3844,9 @@ qioerr qio_channel_begin_peek_buffer(const int threadsafe, qio_channel_t* ch, in
   err = _qio_channel_require_unlocked(ch, require, writing);
   if( err ) {
     _qio_channel_set_error_unlocked(ch, err);
-    qio_unlock(&ch->lock);
+    if( threadsafe ) {
+      qio_unlock(&ch->lock);
+    }
     return err;
   }
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHPL_RT_UNIT_TEST
+#include "chplrt.h"
+#endif
+
+#include "qio_array.h"
+#include "bswap.h"
+
+#include <string.h>
+
+static const char qio_array_magic[8] = "CHPLARR";
+
+static inline
+int host_is_big_endian(void)
+{
+  return htobe16(1) == 1;
+}
+
+void qio_array_header_init(qio_array_header_t* hdr, qio_array_kind_t kind, int64_t elt_size, int64_t rank)
+{
+  memset(hdr, 0, sizeof(qio_array_header_t));
+  hdr->kind = kind;
+  hdr->elt_size = elt_size;
+  hdr->rank = rank;
+  hdr->compression = QIO_ARRAY_COMPRESS_NONE;
+}
+
+int64_t qio_array_header_len(int64_t rank)
+{
+  int64_t len = 40 + 16 * rank;
+  return (len + 63) & ~ (int64_t) 63;
+}
+
+static inline
+void put32(unsigned char* p, uint32_t x)
+{
+  x = htole32(x);
+  memcpy(p, &x, 4);
+}
+
+static inline
+void put64(unsigned char* p, int64_t x)
+{
+  uint64_t u = htole64((uint64_t) x);
+  memcpy(p, &u, 8);
+}
+
+static inline
+uint32_t get32(const unsigned char* p)
+{
+  uint32_t x;
+  memcpy(&x, p, 4);
+  return le32toh(x);
+}
+
+static inline
+int64_t get64(const unsigned char* p)
+{
+  uint64_t x;
+  memcpy(&x, p, 8);
+  return (int64_t) le64toh(x);
+}
+
+qioerr qio_array_header_write(const int threadsafe, qio_channel_t* ch, qio_array_header_t* hdr)
+{
+  unsigned char buf[40 + 16 * QIO_ARRAY_MAX_RANK + 64];
+  int64_t len;
+  int64_t nelts = 1;
+  uint32_t d;
+  qioerr err;
+
+  if( hdr->rank < 1 || hdr->rank > QIO_ARRAY_MAX_RANK )
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "unsupported array rank");
+
+  for( d = 0; d < hdr->rank; d++ ) {
+    if( hdr->size[d] < 0 ) hdr->size[d] = 0;
+    nelts *= hdr->size[d];
+  }
+  hdr->data_len = nelts * hdr->elt_size;
+
+  len = qio_array_header_len(hdr->rank);
+  memset(buf, 0, len);
+  memcpy(buf, qio_array_magic, 8);
+  put32(buf + 8, QIO_ARRAY_VERSION);
+  put32(buf + 12, host_is_big_endian() ? QIO_ARRAY_BIG_ENDIAN : 0);
+  put32(buf + 16, hdr->kind);
+  put32(buf + 20, hdr->elt_size);
+  put32(buf + 24, hdr->rank);
+  put32(buf + 28, hdr->compression);
+  put64(buf + 32, hdr->data_len);
+  for( d = 0; d < hdr->rank; d++ ) {
+    put64(buf + 40 + 16*d, hdr->low[d]);
+    put64(buf + 48 + 16*d, hdr->size[d]);
+  }
+
+  err = qio_channel_write_amt(threadsafe, ch, buf, len);
+  return err;
+}
+
+qioerr qio_array_header_read(const int threadsafe, qio_channel_t* ch, qio_array_header_t* hdr)
+{
+  unsigned char buf[40 + 16 * QIO_ARRAY_MAX_RANK + 64];
+  int64_t len;
+  int64_t nelts = 1;
+  uint32_t flags;
+  uint32_t d;
+  qioerr err;
+
+  memset(hdr, 0, sizeof(qio_array_header_t));
+
+  err = qio_channel_read_amt(threadsafe, ch, buf, 40);
+  if( err ) return err;
+
+  if( memcmp(buf, qio_array_magic, 8) != 0 )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "not an array file");
+  if( get32(buf + 8) != QIO_ARRAY_VERSION )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "unsupported array file version");
+
+  flags = get32(buf + 12);
+  hdr->kind = get32(buf + 16);
+  hdr->elt_size = get32(buf + 20);
+  hdr->rank = get32(buf + 24);
+  hdr->compression = get32(buf + 28);
+  hdr->data_len = get64(buf + 32);
+
+  if( hdr->rank < 1 || hdr->rank > QIO_ARRAY_MAX_RANK )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "unsupported array rank");
+  if( hdr->compression != QIO_ARRAY_COMPRESS_NONE )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "unsupported array compression");
+
+  len = qio_array_header_len(hdr->rank);
+  err = qio_channel_read_amt(threadsafe, ch, buf + 40, len - 40);
+  if( err ) return err;
+
+  for( d = 0; d < hdr->rank; d++ ) {
+    hdr->low[d] = get64(buf + 40 + 16*d);
+    hdr->size[d] = get64(buf + 48 + 16*d);
+    if( hdr->size[d] < 0 )
+      QIO_RETURN_CONSTANT_ERROR(EFORMAT, "bad array dimension");
+    nelts *= hdr->size[d];
+  }
+  if( hdr->data_len != nelts * hdr->elt_size )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "array data length does not match shape");
+
+  hdr->swapped = ((flags & QIO_ARRAY_BIG_ENDIAN) != 0) != host_is_big_endian();
+
+  return 0;
+}
+
+void qio_array_bswap(void* data, int64_t nparts, int64_t part_size)
+{
+  int64_t i;
+
+  switch( part_size ) {
+    case 2: {
+      uint16_t* p = (uint16_t*) data;
+      for( i = 0; i < nparts; i++ ) p[i] = bswap_16(p[i]);
+      break;
+    }
+    case 4: {
+      uint32_t* p = (uint32_t*) data;
+      for( i = 0; i < nparts; i++ ) p[i] = bswap_32(p[i]);
+      break;
+    }
+    case 8: {
+      uint64_t* p = (uint64_t*) data;
+      for( i = 0; i < nparts; i++ ) p[i] = bswap_64(p[i]);
+      break;
+    }
+    default:
+      // 1-byte values have no byte order.
+      break;
+  }
+}
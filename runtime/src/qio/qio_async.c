@@ -0,0 +1,471 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _GNU_SOURCE
+// get preadv, pwritev
+#define _GNU_SOURCE
+#endif
+
+#include "sys_basic.h"
+
+#ifndef CHPL_RT_UNIT_TEST
+#include "chplrt.h"
+#include "chpl-env.h"
+#include "chpl-tasks.h"
+#endif
+
+#include "qio_async.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#include <linux/io_uring.h>
+#define QIO_ASYNC_HAS_URING
+#endif
+#endif
+
+#ifndef CHPL_RT_UNIT_TEST
+#define qio_async_yield() chpl_task_yield()
+#define qio_async_env_bool(name, dflt) chpl_get_rt_env_bool(name, dflt)
+#define qio_async_env_int(name, dflt) chpl_get_rt_env_int(name, dflt)
+#else
+#define qio_async_yield() sched_yield()
+#define qio_async_env_bool(name, dflt) (dflt)
+#define qio_async_env_int(name, dflt) (dflt)
+#endif
+
+#define QIO_ASYNC_URING_ENTRIES 256
+
+static void complete_req(qio_async_req_t* req, ssize_t result)
+{
+  req->result = result;
+  __atomic_store_n(&req->done, 1, __ATOMIC_RELEASE);
+}
+
+static int req_done(qio_async_req_t* req)
+{
+  return __atomic_load_n(&req->done, __ATOMIC_ACQUIRE);
+}
+
+// Spin lock serializing access to the io_uring queues.  It is only
+// held for a few loads and stores (plus the non-blocking submit), so
+// a task that finds it busy just yields and tries again.
+static int ring_lock_word;
+
+static int ring_trylock(void)
+{
+  return __atomic_exchange_n(&ring_lock_word, 1, __ATOMIC_ACQUIRE) == 0;
+}
+
+static void ring_unlock(void)
+{
+  __atomic_store_n(&ring_lock_word, 0, __ATOMIC_RELEASE);
+}
+
+
+// *** io_uring *** //
+
+#ifdef QIO_ASYNC_HAS_URING
+
+static struct {
+  int fd;
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_mask;
+  unsigned* sq_array;
+  struct io_uring_sqe* sqes;
+  unsigned sq_entries;
+  unsigned inflight;    // submitted, not yet reaped; <= sq_entries
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned* cq_mask;
+  struct io_uring_cqe* cqes;
+} ring = { -1 };
+
+static int uring_setup(void)
+{
+  struct io_uring_params p;
+  size_t sq_len, cq_len;
+  void* sq_ptr;
+  void* cq_ptr;
+  void* sqes;
+  int fd;
+
+  memset(&p, 0, sizeof(p));
+  fd = syscall(__NR_io_uring_setup, QIO_ASYNC_URING_ENTRIES, &p);
+  if( fd < 0 ) return 0;
+
+  sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  if( p.features & IORING_FEAT_SINGLE_MMAP ) {
+    if( cq_len > sq_len ) sq_len = cq_len;
+  }
+
+  sq_ptr = mmap(NULL, sq_len, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if( sq_ptr == MAP_FAILED ) goto error;
+
+  if( p.features & IORING_FEAT_SINGLE_MMAP ) {
+    cq_ptr = sq_ptr;
+  } else {
+    cq_ptr = mmap(NULL, cq_len, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if( cq_ptr == MAP_FAILED ) goto error;
+  }
+
+  sqes = mmap(NULL, p.sq_entries * sizeof(struct io_uring_sqe),
+              PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+              fd, IORING_OFF_SQES);
+  if( sqes == MAP_FAILED ) goto error;
+
+  ring.sq_head = (unsigned*) ((char*) sq_ptr + p.sq_off.head);
+  ring.sq_tail = (unsigned*) ((char*) sq_ptr + p.sq_off.tail);
+  ring.sq_mask = (unsigned*) ((char*) sq_ptr + p.sq_off.ring_mask);
+  ring.sq_array = (unsigned*) ((char*) sq_ptr + p.sq_off.array);
+  ring.sqes = (struct io_uring_sqe*) sqes;
+  ring.sq_entries = p.sq_entries;
+  ring.cq_head = (unsigned*) ((char*) cq_ptr + p.cq_off.head);
+  ring.cq_tail = (unsigned*) ((char*) cq_ptr + p.cq_off.tail);
+  ring.cq_mask = (unsigned*) ((char*) cq_ptr + p.cq_off.ring_mask);
+  ring.cqes = (struct io_uring_cqe*) ((char*) cq_ptr + p.cq_off.cqes);
+  ring.fd = fd;
+  return 1;
+
+error:
+  // The mappings go away with the process; we just won't use them.
+  close(fd);
+  return 0;
+}
+
+// Hand every available completion to its waiting request, first
+// re-submitting anything a short io_uring_enter() left in the
+// submission queue.  Call with the ring lock held.
+static void uring_reap(void)
+{
+  unsigned head;
+  unsigned tail;
+  unsigned pending;
+
+  pending = *ring.sq_tail - __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE);
+  if( pending > 0 )
+    (void) syscall(__NR_io_uring_enter, ring.fd, pending, 0, 0, NULL, 0);
+
+  head = *ring.cq_head;
+  tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+
+  while( head != tail ) {
+    struct io_uring_cqe* cqe = &ring.cqes[head & *ring.cq_mask];
+    complete_req((qio_async_req_t*) (intptr_t) cqe->user_data, cqe->res);
+    ring.inflight--;
+    head++;
+  }
+  __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+}
+
+// Queue one request and tell the kernel about it.  Returns 0 if there
+// are already sq_entries requests in flight (which also keeps the
+// completion queue, at twice that size, from overflowing), in which
+// case the caller should reap, yield, and try again.  Call with the
+// ring lock held.
+static int uring_submit(qio_async_req_t* req)
+{
+  unsigned tail = *ring.sq_tail;
+  unsigned head = __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE);
+  unsigned idx;
+  struct io_uring_sqe* sqe;
+  int rc;
+
+  if( ring.inflight >= ring.sq_entries ) return 0;
+
+  idx = tail & *ring.sq_mask;
+  sqe = &ring.sqes[idx];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = (req->kind == QIO_ASYNC_READ) ? IORING_OP_READV
+                                              : IORING_OP_WRITEV;
+  sqe->fd = req->fd;
+  sqe->off = req->offset;
+  sqe->addr = (uint64_t) (intptr_t) req->iov;
+  sqe->len = req->iovcnt;
+  sqe->user_data = (uint64_t) (intptr_t) req;
+  ring.sq_array[idx] = idx;
+  __atomic_store_n(ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  ring.inflight++;
+
+  do {
+    rc = syscall(__NR_io_uring_enter, ring.fd, 1, 0, 0, NULL, 0);
+  } while( rc < 0 && errno == EINTR );
+
+  if( rc < 0 ) {
+    // The kernel did not take it.  Roll back, if it is still ours, and
+    // fail the request; otherwise it will complete through the ring.
+    if( __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE) == head ) {
+      __atomic_store_n(ring.sq_tail, tail, __ATOMIC_RELEASE);
+      ring.inflight--;
+      complete_req(req, -errno);
+    }
+  }
+  return 1;
+}
+
+static void uring_start(qio_async_req_t* req)
+{
+  int submitted = 0;
+
+  while( ! submitted ) {
+    if( ring_trylock() ) {
+      submitted = uring_submit(req);
+      if( ! submitted ) uring_reap();
+      ring_unlock();
+    }
+    if( ! submitted ) qio_async_yield();
+  }
+}
+
+// Whichever task gets the lock reaps for everyone.
+static int uring_test(qio_async_req_t* req)
+{
+  if( req_done(req) ) return 1;
+  if( ring_trylock() ) {
+    uring_reap();
+    ring_unlock();
+  }
+  return req_done(req);
+}
+
+#endif // QIO_ASYNC_HAS_URING
+
+
+// *** helper thread pool *** //
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+static qio_async_req_t* pool_head;
+static qio_async_req_t* pool_tail;
+
+static ssize_t do_syscall(qio_async_req_t* req)
+{
+  ssize_t got;
+
+  do {
+    if( req->kind == QIO_ASYNC_READ )
+      got = preadv(req->fd, (struct iovec*) req->iov, req->iovcnt,
+                   req->offset);
+    else
+      got = pwritev(req->fd, (struct iovec*) req->iov, req->iovcnt,
+                    req->offset);
+  } while( got == -1 && errno == EINTR );
+
+  return (got == -1) ? -errno : got;
+}
+
+static void* pool_thread(void* arg)
+{
+  qio_async_req_t* req;
+
+  while( 1 ) {
+    pthread_mutex_lock(&pool_lock);
+    while( pool_head == NULL )
+      pthread_cond_wait(&pool_cond, &pool_lock);
+    req = pool_head;
+    pool_head = req->next;
+    if( pool_head == NULL ) pool_tail = NULL;
+    pthread_mutex_unlock(&pool_lock);
+
+    complete_req(req, do_syscall(req));
+  }
+
+  return NULL;
+}
+
+static int pool_setup(void)
+{
+  pthread_attr_t attr;
+  pthread_t thread;
+  int64_t nthreads;
+  int64_t i;
+  int started = 0;
+
+  nthreads = qio_async_env_int("QIO_ASYNC_THREADS", 4);
+  if( nthreads < 1 ) nthreads = 1;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  for( i = 0; i < nthreads; i++ ) {
+    if( pthread_create(&thread, &attr, pool_thread, NULL) == 0 )
+      started++;
+  }
+  pthread_attr_destroy(&attr);
+
+  return started > 0;
+}
+
+static void pool_start(qio_async_req_t* req)
+{
+  pthread_mutex_lock(&pool_lock);
+  req->next = NULL;
+  if( pool_tail ) pool_tail->next = req;
+  else pool_head = req;
+  pool_tail = req;
+  pthread_cond_signal(&pool_cond);
+  pthread_mutex_unlock(&pool_lock);
+}
+
+
+// *** common *** //
+
+typedef enum {
+  QIO_ASYNC_USE_URING,
+  QIO_ASYNC_USE_POOL,
+  QIO_ASYNC_USE_SYNC,   // couldn't start helper threads either
+} qio_async_mode_t;
+
+static pthread_once_t async_once = PTHREAD_ONCE_INIT;
+static qio_async_mode_t async_mode;
+
+static void async_init(void)
+{
+#ifdef QIO_ASYNC_HAS_URING
+  if( qio_async_env_bool("QIO_ASYNC_URING", 1) && uring_setup() ) {
+    async_mode = QIO_ASYNC_USE_URING;
+    return;
+  }
+#endif
+  async_mode = pool_setup() ? QIO_ASYNC_USE_POOL : QIO_ASYNC_USE_SYNC;
+}
+
+int qio_async_uses_uring(void)
+{
+  pthread_once(&async_once, async_init);
+  return async_mode == QIO_ASYNC_USE_URING;
+}
+
+void qio_async_start(qio_async_req_t* req, qio_async_kind_t kind, fd_t fd,
+                     const struct iovec* iov, int iovcnt, off_t offset)
+{
+  pthread_once(&async_once, async_init);
+
+  req->next = NULL;
+  req->kind = kind;
+  req->fd = fd;
+  req->iov = iov;
+  req->iovcnt = iovcnt;
+  req->offset = offset;
+  req->result = 0;
+  req->done = 0;
+
+  switch( async_mode ) {
+    case QIO_ASYNC_USE_URING:
+#ifdef QIO_ASYNC_HAS_URING
+      uring_start(req);
+      break;
+#endif
+    case QIO_ASYNC_USE_POOL:
+      pool_start(req);
+      break;
+    case QIO_ASYNC_USE_SYNC:
+      complete_req(req, do_syscall(req));
+      break;
+  }
+}
+
+int qio_async_test(qio_async_req_t* req)
+{
+#ifdef QIO_ASYNC_HAS_URING
+  if( async_mode == QIO_ASYNC_USE_URING ) return uring_test(req);
+#endif
+  return req_done(req);
+}
+
+err_t qio_async_wait(qio_async_req_t* req, ssize_t* num_out)
+{
+  while( ! qio_async_test(req) )
+    qio_async_yield();
+
+  if( req->result < 0 ) {
+    *num_out = 0;
+    return -req->result;
+  }
+  *num_out = req->result;
+  return 0;
+}
+
+static ssize_t run_req(qio_async_kind_t kind, fd_t fd, const struct iovec* iov,
+                       int iovcnt, off_t offset)
+{
+  qio_async_req_t req;
+
+  qio_async_start(&req, kind, fd, iov, iovcnt, offset);
+  while( ! qio_async_test(&req) )
+    qio_async_yield();
+
+  return req.result;
+}
+
+// Like sys_preadv/sys_pwritev: split into IOV_MAX pieces and stop at
+// the first short transfer.
+static err_t run_vectored(qio_async_kind_t kind, fd_t fd, const struct iovec* iov,
+                          int iovcnt, off_t seek_to_offset, ssize_t* num_out)
+{
+  ssize_t got;
+  ssize_t got_total = 0;
+  err_t err_out = 0;
+  int i;
+  int niovs = IOV_MAX;
+
+  for( i = 0; i < iovcnt; i += niovs ) {
+    niovs = iovcnt - i;
+    if( niovs > IOV_MAX ) niovs = IOV_MAX;
+
+    got = run_req(kind, fd, &iov[i], niovs, seek_to_offset + got_total);
+    if( got < 0 ) {
+      err_out = -got;
+      break;
+    }
+    got_total += got;
+    if( got != sys_iov_total_bytes(&iov[i], niovs) ) {
+      break;
+    }
+  }
+
+  if( kind == QIO_ASYNC_READ && err_out == 0 && got_total == 0 &&
+      sys_iov_total_bytes(iov, iovcnt) != 0 ) err_out = EEOF;
+
+  *num_out = got_total;
+  return err_out;
+}
+
+err_t qio_async_preadv(fd_t fd, const struct iovec* iov, int iovcnt, off_t seek_to_offset, ssize_t* num_read_out)
+{
+  return run_vectored(QIO_ASYNC_READ, fd, iov, iovcnt, seek_to_offset,
+                      num_read_out);
+}
+
+err_t qio_async_pwritev(fd_t fd, const struct iovec* iov, int iovcnt, off_t seek_to_offset, ssize_t* num_written_out)
+{
+  return run_vectored(QIO_ASYNC_WRITE, fd, iov, iovcnt, seek_to_offset,
+                      num_written_out);
+}
@@ -0,0 +1,1009 @@
+/*
+ * Copyright 2004-2016 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sys_basic.h"
+
+#ifndef CHPL_RT_UNIT_TEST
+#include "chplrt.h"
+#include "chpl-env.h"
+#include "chpl-tasks.h"
+#endif
+
+#include "qio_compress.h"
+#include "bswap.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifndef CHPL_RT_UNIT_TEST
+#define qio_compress_yield() chpl_task_yield()
+#define qio_compress_env_int(name, dflt) chpl_get_rt_env_int(name, dflt)
+#else
+#define qio_compress_yield() sched_yield()
+#define qio_compress_env_int(name, dflt) (dflt)
+#endif
+
+static inline
+uint32_t read32(const unsigned char* p)
+{
+  uint32_t x;
+  memcpy(&x, p, 4);
+  return x;
+}
+
+static inline
+uint32_t read_le32(const unsigned char* p)
+{
+  return le32toh(read32(p));
+}
+
+static inline
+void write_le32(unsigned char* p, uint32_t x)
+{
+  x = htole32(x);
+  memcpy(p, &x, 4);
+}
+
+
+// *** xxHash32 *** //
+
+#define XXH_PRIME1 2654435761U
+#define XXH_PRIME2 2246822519U
+#define XXH_PRIME3 3266489917U
+#define XXH_PRIME4 668265263U
+#define XXH_PRIME5 374761393U
+
+static inline
+uint32_t rotl32(uint32_t x, int r)
+{
+  return (x << r) | (x >> (32 - r));
+}
+
+static inline
+uint32_t xxh32_round(uint32_t acc, uint32_t input)
+{
+  acc += input * XXH_PRIME2;
+  acc = rotl32(acc, 13);
+  return acc * XXH_PRIME1;
+}
+
+void qio_xxh32_init(qio_xxh32_state_t* st, uint32_t seed)
+{
+  memset(st, 0, sizeof(qio_xxh32_state_t));
+  st->v[0] = seed + XXH_PRIME1 + XXH_PRIME2;
+  st->v[1] = seed + XXH_PRIME2;
+  st->v[2] = seed;
+  st->v[3] = seed - XXH_PRIME1;
+}
+
+void qio_xxh32_update(qio_xxh32_state_t* st, const void* data, size_t len)
+{
+  const unsigned char* p = (const unsigned char*) data;
+  const unsigned char* end = p + len;
+
+  st->total_len += len;
+
+  if( st->memsize + len < 16 ) {
+    memcpy(st->mem + st->memsize, p, len);
+    st->memsize += len;
+    return;
+  }
+
+  if( st->memsize ) {
+    memcpy(st->mem + st->memsize, p, 16 - st->memsize);
+    p += 16 - st->memsize;
+    st->v[0] = xxh32_round(st->v[0], read_le32(st->mem));
+    st->v[1] = xxh32_round(st->v[1], read_le32(st->mem + 4));
+    st->v[2] = xxh32_round(st->v[2], read_le32(st->mem + 8));
+    st->v[3] = xxh32_round(st->v[3], read_le32(st->mem + 12));
+    st->memsize = 0;
+  }
+
+  while( p + 16 <= end ) {
+    st->v[0] = xxh32_round(st->v[0], read_le32(p));
+    st->v[1] = xxh32_round(st->v[1], read_le32(p + 4));
+    st->v[2] = xxh32_round(st->v[2], read_le32(p + 8));
+    st->v[3] = xxh32_round(st->v[3], read_le32(p + 12));
+    p += 16;
+  }
+
+  if( p < end ) {
+    memcpy(st->mem, p, end - p);
+    st->memsize = end - p;
+  }
+}
+
+uint32_t qio_xxh32_digest(const qio_xxh32_state_t* st)
+{
+  const unsigned char* p = st->mem;
+  const unsigned char* end = st->mem + st->memsize;
+  uint32_t h;
+
+  if( st->total_len >= 16 )
+    h = rotl32(st->v[0], 1) + rotl32(st->v[1], 7) +
+        rotl32(st->v[2], 12) + rotl32(st->v[3], 18);
+  else
+    h = st->v[2] + XXH_PRIME5;
+
+  h += (uint32_t) st->total_len;
+
+  while( p + 4 <= end ) {
+    h += read_le32(p) * XXH_PRIME3;
+    h = rotl32(h, 17) * XXH_PRIME4;
+    p += 4;
+  }
+  while( p < end ) {
+    h += (*p) * XXH_PRIME5;
+    h = rotl32(h, 11) * XXH_PRIME1;
+    p++;
+  }
+
+  h ^= h >> 15;
+  h *= XXH_PRIME2;
+  h ^= h >> 13;
+  h *= XXH_PRIME3;
+  h ^= h >> 16;
+  return h;
+}
+
+uint32_t qio_xxh32(const void* data, size_t len, uint32_t seed)
+{
+  qio_xxh32_state_t st;
+  qio_xxh32_init(&st, seed);
+  qio_xxh32_update(&st, data, len);
+  return qio_xxh32_digest(&st);
+}
+
+
+// *** LZ4 blocks *** //
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MFLIMIT 12
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_LOG 12
+#define LZ4_SKIP_TRIGGER 6
+
+static inline
+uint32_t lz4_hash(uint32_t seq)
+{
+  return (seq * 2654435761U) >> (32 - LZ4_HASH_LOG);
+}
+
+// Writes a length continuation (the part beyond the 4-bit token field).
+static inline
+unsigned char* lz4_put_length(unsigned char* op, int64_t len)
+{
+  while( len >= 255 ) {
+    *op++ = 255;
+    len -= 255;
+  }
+  *op++ = (unsigned char) len;
+  return op;
+}
+
+// Emits literals [anchor, anchor+lit) and, if match_len > 0, a match.
+// Returns NULL if it would not fit before oend.
+static inline
+unsigned char* lz4_put_sequence(unsigned char* op, unsigned char* oend,
+                                const unsigned char* anchor, int64_t lit,
+                                int64_t offset, int64_t match_len)
+{
+  unsigned char* token = op++;
+  int64_t ml = match_len - LZ4_MIN_MATCH;
+
+  if( op + lit + lit / 255 + 1 + 2 + ml / 255 + 1 > oend ) return NULL;
+
+  if( lit >= 15 ) {
+    *token = 15 << 4;
+    op = lz4_put_length(op, lit - 15);
+  } else {
+    *token = (unsigned char) (lit << 4);
+  }
+  memcpy(op, anchor, lit);
+  op += lit;
+
+  if( match_len == 0 ) return op;
+
+  *op++ = (unsigned char) offset;
+  *op++ = (unsigned char) (offset >> 8);
+  if( ml >= 15 ) {
+    *token |= 15;
+    op = lz4_put_length(op, ml - 15);
+  } else {
+    *token |= (unsigned char) ml;
+  }
+  return op;
+}
+
+int64_t qio_lz4_compress_block(const unsigned char* src, int64_t len,
+                               unsigned char* dst, int64_t cap)
+{
+  uint32_t table[1 << LZ4_HASH_LOG];
+  const unsigned char* ip = src;
+  const unsigned char* anchor = src;
+  const unsigned char* iend = src + len;
+  const unsigned char* mflimit = iend - LZ4_MFLIMIT;
+  const unsigned char* matchlimit = iend - LZ4_LAST_LITERALS;
+  unsigned char* op = dst;
+  unsigned char* oend = dst + cap;
+
+  if( len > LZ4_MFLIMIT ) {
+    memset(table, 0, sizeof(table));
+    table[lz4_hash(read32(ip))] = 0;
+    ip++;
+
+    while( ip <= mflimit ) {
+      const unsigned char* ref;
+      int64_t match_len;
+      uint32_t h;
+
+      // Look for a match, skipping ahead faster the longer we go
+      // without finding one.
+      h = lz4_hash(read32(ip));
+      ref = src + table[h];
+      table[h] = (uint32_t) (ip - src);
+      if( ref >= ip || ip - ref > LZ4_MAX_OFFSET ||
+          read32(ref) != read32(ip) ) {
+        ip += 1 + ((ip - anchor) >> LZ4_SKIP_TRIGGER);
+        continue;
+      }
+
+      // Extend the match backwards and forwards.
+      while( ip > anchor && ref > src && ip[-1] == ref[-1] ) {
+        ip--;
+        ref--;
+      }
+      match_len = LZ4_MIN_MATCH;
+      while( ip + match_len < matchlimit && ip[match_len] == ref[match_len] )
+        match_len++;
+
+      op = lz4_put_sequence(op, oend, anchor, ip - anchor, ip - ref,
+                            match_len);
+      if( ! op ) return 0;
+
+      ip += match_len;
+      anchor = ip;
+      if( ip <= mflimit )
+        table[lz4_hash(read32(ip - 2))] = (uint32_t) (ip - 2 - src);
+    }
+  }
+
+  // The last literals.
+  op = lz4_put_sequence(op, oend, anchor, iend - anchor, 0, 0);
+  if( ! op ) return 0;
+  return op - dst;
+}
+
+int64_t qio_lz4_decompress_block(const unsigned char* src, int64_t len,
+                                 unsigned char* dst, int64_t cap,
+                                 int64_t prefix_len)
+{
+  const unsigned char* ip = src;
+  const unsigned char* iend = src + len;
+  unsigned char* op = dst;
+  unsigned char* oend = dst + cap;
+  const unsigned char* lowest = dst - prefix_len;
+
+  while( ip < iend ) {
+    unsigned token = *ip++;
+    int64_t lit = token >> 4;
+    int64_t ml = token & 15;
+    int64_t offset;
+    const unsigned char* match;
+
+    if( lit == 15 ) {
+      unsigned b;
+      do {
+        if( ip >= iend ) return -1;
+        b = *ip++;
+        lit += b;
+      } while( b == 255 );
+    }
+    if( lit > iend - ip || lit > oend - op ) return -1;
+    memcpy(op, ip, lit);
+    ip += lit;
+    op += lit;
+
+    // The last sequence has only literals.
+    if( ip == iend ) break;
+
+    if( iend - ip < 2 ) return -1;
+    offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if( offset == 0 || offset > op - lowest ) return -1;
+
+    if( ml == 15 ) {
+      unsigned b;
+      do {
+        if( ip >= iend ) return -1;
+        b = *ip++;
+        ml += b;
+      } while( b == 255 );
+    }
+    ml += LZ4_MIN_MATCH;
+    if( ml > oend - op ) return -1;
+
+    match = op - offset;
+    if( offset >= ml ) {
+      memcpy(op, match, ml);
+      op += ml;
+    } else {
+      // Overlapping copy repeats the last offset bytes.
+      int64_t i;
+      for( i = 0; i < ml; i++ ) op[i] = match[i];
+      op += ml;
+    }
+  }
+
+  return op - dst;
+}
+
+
+// *** helper thread pool *** //
+
+// Blocks are compressed and decompressed by a process-wide pool of
+// helper threads, in the same way as qio_async's thread pool.
+
+typedef struct compress_job_s {
+  struct compress_job_s* next;
+  int decompress;
+  const unsigned char* src;
+  int64_t src_len;
+  unsigned char* dst;
+  int64_t dst_cap;
+  int64_t result;
+  int done;
+} compress_job_t;
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+static compress_job_t* pool_head;
+static compress_job_t* pool_tail;
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+static int pool_nthreads;
+
+static void run_job(compress_job_t* job)
+{
+  int64_t result;
+
+  if( job->decompress )
+    result = qio_lz4_decompress_block(job->src, job->src_len,
+                                      job->dst, job->dst_cap, 0);
+  else
+    result = qio_lz4_compress_block(job->src, job->src_len,
+                                    job->dst, job->dst_cap);
+  job->result = result;
+  __atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
+}
+
+static void* pool_thread(void* arg)
+{
+  compress_job_t* job;
+
+  while( 1 ) {
+    pthread_mutex_lock(&pool_lock);
+    while( pool_head == NULL )
+      pthread_cond_wait(&pool_cond, &pool_lock);
+    job = pool_head;
+    pool_head = job->next;
+    if( pool_head == NULL ) pool_tail = NULL;
+    pthread_mutex_unlock(&pool_lock);
+
+    run_job(job);
+  }
+
+  return NULL;
+}
+
+static void pool_init(void)
+{
+  pthread_attr_t attr;
+  pthread_t thread;
+  int64_t ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+  int64_t nthreads;
+  int64_t i;
+
+  if( ncpus < 1 ) ncpus = 1;
+  if( ncpus > 8 ) ncpus = 8;
+  nthreads = qio_compress_env_int("QIO_COMPRESS_THREADS", ncpus);
+
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  for( i = 0; i < nthreads; i++ ) {
+    if( pthread_create(&thread, &attr, pool_thread, NULL) == 0 )
+      pool_nthreads++;
+  }
+  pthread_attr_destroy(&attr);
+}
+
+// Starts a job.  With no helper threads, runs it right away.
+static void job_start(compress_job_t* job)
+{
+  job->done = 0;
+  if( pool_nthreads == 0 ) {
+    run_job(job);
+    return;
+  }
+
+  pthread_mutex_lock(&pool_lock);
+  job->next = NULL;
+  if( pool_tail ) pool_tail->next = job;
+  else pool_head = job;
+  pool_tail = job;
+  pthread_cond_signal(&pool_cond);
+  pthread_mutex_unlock(&pool_lock);
+}
+
+static void job_wait(compress_job_t* job)
+{
+  while( ! __atomic_load_n(&job->done, __ATOMIC_ACQUIRE) )
+    qio_compress_yield();
+}
+
+
+// *** LZ4 frames *** //
+
+#define LZ4F_MAGIC 0x184D2204U
+#define LZ4F_SKIPPABLE_MAGIC 0x184D2A50U
+#define LZ4F_SKIPPABLE_MASK 0xFFFFFFF0U
+#define LZ4F_UNCOMPRESSED 0x80000000U
+
+// FLG byte
+#define LZ4F_VERSION 0x40
+#define LZ4F_BLOCK_INDEP 0x20
+#define LZ4F_BLOCK_CHECKSUM 0x10
+#define LZ4F_CONTENT_SIZE 0x08
+#define LZ4F_CONTENT_CHECKSUM 0x04
+#define LZ4F_DICT_ID 0x01
+
+// Linked blocks may refer to this much earlier output.
+#define LZ4F_WINDOW 65536
+
+// Blocks written are 1 MiB (block maximum size code 6).
+#define QIO_COMPRESS_BLOCK_SIZE_ID 6
+#define QIO_COMPRESS_MAX_SLOTS 16
+// Bound on the memory used by in-flight blocks of one channel.
+#define QIO_COMPRESS_MAX_MEMORY (64*1024*1024)
+
+typedef struct {
+  compress_job_t job;
+  // Writing: uncompressed data.  Reading: the block as stored.
+  unsigned char* in;
+  int64_t in_len;
+  // Writing: the compressed block.  Reading: LZ4F_WINDOW bytes of room
+  // for earlier output, then the decompressed block.
+  unsigned char* out;
+  int64_t out_len;
+  int64_t out_pos;     // reading: bytes of out already returned
+  int64_t prefix_len;  // reading: earlier output before out+LZ4F_WINDOW
+} compress_slot_t;
+
+typedef struct {
+  qio_channel_t* under;
+  int writing;
+  qioerr err;
+
+  int64_t block_size;
+  int nslots;
+  compress_slot_t slots[QIO_COMPRESS_MAX_SLOTS];
+  int head;   // oldest slot in use
+  int count;  // slots in use (when writing, not counting the one filling)
+
+  qio_xxh32_state_t content_hash;
+
+  // Reading state
+  unsigned char flg;
+  int in_frame;          // read a frame header but not its end mark
+  int frame_end;         // read an end mark; verify once count drains
+  uint32_t stored_hash;  // the end mark's content checksum
+  int have_prev;         // a block of this frame was read into prev
+  int prev;
+  int eof;
+  qioerr read_err;       // reported once the decoded blocks are returned
+} compress_filter_t;
+
+static int64_t block_size_for_id(int id)
+{
+  return (int64_t) 1 << (8 + 2 * id);
+}
+
+static void filter_free_slots(compress_filter_t* f)
+{
+  int i;
+  for( i = 0; i < QIO_COMPRESS_MAX_SLOTS; i++ ) {
+    qio_free(f->slots[i].in);
+    qio_free(f->slots[i].out);
+    f->slots[i].in = NULL;
+    f->slots[i].out = NULL;
+  }
+}
+
+// Chooses how many blocks may be in flight and allocates their buffers.
+static qioerr filter_setup_slots(compress_filter_t* f, int64_t block_size)
+{
+  int64_t in_cap, out_cap;
+  int64_t nslots;
+  int i;
+
+  if( block_size == f->block_size ) return 0;
+
+  filter_free_slots(f);
+
+  nslots = pool_nthreads + 2;
+  if( nslots > QIO_COMPRESS_MAX_SLOTS ) nslots = QIO_COMPRESS_MAX_SLOTS;
+  if( nslots > QIO_COMPRESS_MAX_MEMORY / (2 * block_size) )
+    nslots = QIO_COMPRESS_MAX_MEMORY / (2 * block_size);
+  if( nslots < 2 ) nslots = 2;
+
+  if( f->writing ) {
+    in_cap = block_size;
+    out_cap = qio_lz4_compress_bound(block_size);
+  } else {
+    in_cap = block_size;
+    out_cap = LZ4F_WINDOW + block_size;
+  }
+
+  for( i = 0; i < nslots; i++ ) {
+    f->slots[i].in = (unsigned char*) qio_malloc(in_cap);
+    f->slots[i].out = (unsigned char*) qio_malloc(out_cap);
+    if( ! f->slots[i].in || ! f->slots[i].out ) {
+      filter_free_slots(f);
+      f->block_size = 0;
+      return QIO_ENOMEM;
+    }
+  }
+
+  f->block_size = block_size;
+  f->nslots = nslots;
+  return 0;
+}
+
+static void filter_wait_all(compress_filter_t* f)
+{
+  int i;
+  for( i = 0; i < f->count; i++ )
+    job_wait(&f->slots[(f->head + i) % f->nslots].job);
+}
+
+static qioerr filter_write_header(compress_filter_t* f)
+{
+  unsigned char hdr[7];
+
+  write_le32(hdr, LZ4F_MAGIC);
+  hdr[4] = LZ4F_VERSION | LZ4F_BLOCK_INDEP | LZ4F_CONTENT_CHECKSUM;
+  hdr[5] = QIO_COMPRESS_BLOCK_SIZE_ID << 4;
+  hdr[6] = (qio_xxh32(hdr + 4, 2, 0) >> 8) & 0xff;
+  return qio_channel_write_amt(1, f->under, hdr, sizeof(hdr));
+}
+
+// Waits for the oldest block and writes it to the underlying channel.
+static qioerr filter_write_oldest(compress_filter_t* f)
+{
+  compress_slot_t* s = &f->slots[f->head];
+  unsigned char size[4];
+  qioerr err;
+
+  job_wait(&s->job);
+  f->head = (f->head + 1) % f->nslots;
+  f->count--;
+
+  if( s->job.result > 0 && s->job.result < s->in_len ) {
+    write_le32(size, (uint32_t) s->job.result);
+    err = qio_channel_write_amt(1, f->under, size, 4);
+    if( ! err ) err = qio_channel_write_amt(1, f->under, s->out, s->job.result);
+  } else {
+    // Incompressible; store it as is.
+    write_le32(size, (uint32_t) s->in_len | LZ4F_UNCOMPRESSED);
+    err = qio_channel_write_amt(1, f->under, size, 4);
+    if( ! err ) err = qio_channel_write_amt(1, f->under, s->in, s->in_len);
+  }
+  s->in_len = 0;
+  return err;
+}
+
+// Hands the block being filled to the helper threads.
+static qioerr filter_submit_filling(compress_filter_t* f)
+{
+  compress_slot_t* s = &f->slots[(f->head + f->count) % f->nslots];
+  qioerr err = 0;
+
+  s->job.decompress = 0;
+  s->job.src = s->in;
+  s->job.src_len = s->in_len;
+  s->job.dst = s->out;
+  s->job.dst_cap = qio_lz4_compress_bound(f->block_size);
+  job_start(&s->job);
+  f->count++;
+
+  // Keep a free slot to fill.
+  if( f->count == f->nslots ) err = filter_write_oldest(f);
+  return err;
+}
+
+static
+qioerr compress_writev(void* file_info, const struct iovec* iov, int iovcnt,
+                       ssize_t* num_written, void* fs_info)
+{
+  compress_filter_t* f = (compress_filter_t*) file_info;
+  ssize_t total = 0;
+  int i;
+
+  for( i = 0; i < iovcnt && ! f->err; i++ ) {
+    const unsigned char* p = (const unsigned char*) iov[i].iov_base;
+    size_t left = iov[i].iov_len;
+
+    qio_xxh32_update(&f->content_hash, p, left);
+    while( left > 0 && ! f->err ) {
+      compress_slot_t* s = &f->slots[(f->head + f->count) % f->nslots];
+      size_t n = f->block_size - s->in_len;
+      if( n > left ) n = left;
+      memcpy(s->in + s->in_len, p, n);
+      s->in_len += n;
+      p += n;
+      left -= n;
+      total += n;
+      if( s->in_len == f->block_size ) f->err = filter_submit_filling(f);
+    }
+  }
+
+  *num_written = total;
+  return f->err;
+}
+
+static qioerr filter_finish_frame(compress_filter_t* f)
+{
+  unsigned char end[8];
+  qioerr err = 0;
+
+  if( f->slots[(f->head + f->count) % f->nslots].in_len > 0 )
+    err = filter_submit_filling(f);
+  while( ! err && f->count > 0 )
+    err = filter_write_oldest(f);
+  if( err ) return err;
+
+  write_le32(end, 0);
+  write_le32(end + 4, qio_xxh32_digest(&f->content_hash));
+  return qio_channel_write_amt(1, f->under, end, sizeof(end));
+}
+
+// Reads len bytes of the current frame.  Running out of data inside a
+// frame means the stream was cut short, which is not a clean end of file.
+static qioerr filter_read_frame(compress_filter_t* f, void* ptr, ssize_t len)
+{
+  qioerr err = qio_channel_read_amt(1, f->under, ptr, len);
+  int code = qio_err_to_int(err);
+  if( code == EEOF || code == ESHORT )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "truncated LZ4 frame");
+  return err;
+}
+
+// Reads a frame header, skipping skippable frames.  Sets f->eof at the
+// end of the stream.
+static qioerr filter_read_header(compress_filter_t* f)
+{
+  unsigned char buf[16];
+  ssize_t got = 0;
+  uint32_t magic;
+  int64_t desc_len;
+  qioerr err;
+
+  while( 1 ) {
+    err = qio_channel_read(1, f->under, buf, 4, &got);
+    if( qio_err_to_int(err) == EEOF && got == 0 ) {
+      f->eof = 1;
+      return 0;
+    }
+    if( got > 0 && got < 4 )
+      QIO_RETURN_CONSTANT_ERROR(EFORMAT, "truncated LZ4 frame");
+    if( err ) return err;
+
+    magic = read_le32(buf);
+    if( (magic & LZ4F_SKIPPABLE_MASK) != LZ4F_SKIPPABLE_MAGIC ) break;
+
+    err = filter_read_frame(f, buf, 4);
+    if( ! err ) err = qio_channel_advance(1, f->under, read_le32(buf));
+    if( err ) return err;
+  }
+
+  if( magic != LZ4F_MAGIC )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "not an LZ4 frame");
+
+  err = filter_read_frame(f, buf, 2);
+  if( err ) return err;
+  f->flg = buf[0];
+  if( (f->flg & 0xc0) != LZ4F_VERSION || (f->flg & 0x02) ||
+      (buf[1] & 0x8f) || (buf[1] >> 4) < 4 )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "bad LZ4 frame descriptor");
+  if( f->flg & LZ4F_DICT_ID )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "LZ4 dictionaries are not supported");
+
+  desc_len = 2;
+  if( f->flg & LZ4F_CONTENT_SIZE ) desc_len += 8;
+  err = filter_read_frame(f, buf + 2, desc_len - 2 + 1);
+  if( err ) return err;
+  if( buf[desc_len] != ((qio_xxh32(buf, desc_len, 0) >> 8) & 0xff) )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "bad LZ4 frame header checksum");
+
+  err = filter_setup_slots(f, block_size_for_id(buf[1] >> 4));
+  if( err ) return err;
+
+  f->in_frame = 1;
+  f->have_prev = 0;
+  qio_xxh32_init(&f->content_hash, 0);
+  return 0;
+}
+
+// Reads the next block of the frame into a free slot and starts
+// decompressing it.
+static qioerr filter_read_block(compress_filter_t* f)
+{
+  int idx = (f->head + f->count) % f->nslots;
+  compress_slot_t* s = &f->slots[idx];
+  unsigned char buf[4];
+  uint32_t size;
+  int64_t len;
+  qioerr err;
+
+  err = filter_read_frame(f, buf, 4);
+  if( err ) return err;
+  size = read_le32(buf);
+
+  if( size == 0 ) {
+    // End mark
+    if( f->flg & LZ4F_CONTENT_CHECKSUM ) {
+      err = filter_read_frame(f, buf, 4);
+      if( err ) return err;
+      f->stored_hash = read_le32(buf);
+    }
+    f->in_frame = 0;
+    f->frame_end = 1;
+    return 0;
+  }
+
+  len = size & ~LZ4F_UNCOMPRESSED;
+  if( len > f->block_size )
+    QIO_RETURN_CONSTANT_ERROR(EFORMAT, "LZ4 block too large");
+  err = filter_read_frame(f, s->in, len);
+  if( ! err && (f->flg & LZ4F_BLOCK_CHECKSUM) ) {
+    err = filter_read_frame(f, buf, 4);
+    if( ! err && read_le32(buf) != qio_xxh32(s->in, len, 0) )
+      QIO_RETURN_CONSTANT_ERROR(EFORMAT, "bad LZ4 block checksum");
+  }
+  if( err ) return err;
+
+  s->out_pos = 0;
+  s->prefix_len = 0;
+  s->job.done = 1;
+
+  if( ! (f->flg & LZ4F_BLOCK_INDEP) && f->have_prev ) {
+    // This block may refer to the end of the one before it.
+    compress_slot_t* p = &f->slots[f->prev];
+    int64_t plen;
+    // A block that failed to decompress can't be a prefix.  The reader
+    // reports it when it gets to it.
+    if( p->out_len < 0 )
+      QIO_RETURN_CONSTANT_ERROR(EFORMAT, "corrupt LZ4 block");
+    plen = p->prefix_len + p->out_len;
+    if( plen > LZ4F_WINDOW ) plen = LZ4F_WINDOW;
+    memcpy(s->out + LZ4F_WINDOW - plen,
+           p->out + LZ4F_WINDOW + p->out_len - plen, plen);
+    s->prefix_len = plen;
+  }
+
+  if( size & LZ4F_UNCOMPRESSED ) {
+    memcpy(s->out + LZ4F_WINDOW, s->in, len);
+    s->job.result = len;
+  } else if( f->flg & LZ4F_BLOCK_INDEP ) {
+    s->job.decompress = 1;
+    s->job.src = s->in;
+    s->job.src_len = len;
+    s->job.dst = s->out + LZ4F_WINDOW;
+    s->job.dst_cap = f->block_size;
+    job_start(&s->job);
+  } else {
+    // Linked blocks are decompressed in order, here.
+    s->job.result = qio_lz4_decompress_block(s->in, len,
+                                             s->out + LZ4F_WINDOW,
+                                             f->block_size, s->prefix_len);
+  }
+  s->out_len = s->job.result;
+
+  f->prev = idx;
+  f->have_prev = 1;
+  f->count++;
+  return 0;
+}
+
+// Reads ahead until every slot is busy or the frame has ended.
+static qioerr filter_fill(compress_filter_t* f)
+{
+  qioerr err = 0;
+
+  while( ! err && ! f->eof ) {
+    if( f->in_frame ) {
+      if( f->count == f->nslots ) break;
+      err = filter_read_block(f);
+    } else if( f->frame_end ) {
+      // Blocks of the next frame can't share the ring until the
+      // content checksum has been checked.
+      if( f->count > 0 ) break;
+      f->frame_end = 0;
+      if( (f->flg & LZ4F_CONTENT_CHECKSUM) &&
+          qio_xxh32_digest(&f->content_hash) != f->stored_hash )
+        QIO_RETURN_CONSTANT_ERROR(EFORMAT, "bad LZ4 content checksum");
+    } else {
+      err = filter_read_header(f);
+    }
+  }
+
+  return err;
+}
+
+static
+qioerr compress_readv(void* file_info, const struct iovec* iov, int iovcnt,
+                      ssize_t* num_read, void* fs_info)
+{
+  compress_filter_t* f = (compress_filter_t*) file_info;
+  ssize_t total = 0;
+  int i = 0;
+  size_t iov_pos = 0;
+
+  while( i < iovcnt && ! f->err ) {
+    compress_slot_t* s;
+    size_t n;
+
+    if( iov_pos == iov[i].iov_len ) {
+      i++;
+      iov_pos = 0;
+      continue;
+    }
+
+    // Return the blocks already decoded before reporting an error that
+    // came up reading ahead.
+    if( ! f->read_err ) f->read_err = filter_fill(f);
+    if( f->count == 0 ) {
+      f->err = f->read_err;
+      break;
+    }
+
+    s = &f->slots[f->head];
+    if( ! __atomic_load_n(&s->job.done, __ATOMIC_ACQUIRE) ) {
+      // Don't wait if we already have something to return.
+      if( total > 0 ) break;
+      job_wait(&s->job);
+    }
+    s->out_len = s->job.result;
+    if( s->out_len < 0 ) {
+      QIO_GET_CONSTANT_ERROR(f->err, EFORMAT, "corrupt LZ4 block");
+      break;
+    }
+
+    n = s->out_len - s->out_pos;
+    if( n > iov[i].iov_len - iov_pos ) n = iov[i].iov_len - iov_pos;
+    memcpy((char*) iov[i].iov_base + iov_pos,
+           s->out + LZ4F_WINDOW + s->out_pos, n);
+    qio_xxh32_update(&f->content_hash, s->out + LZ4F_WINDOW + s->out_pos, n);
+    s->out_pos += n;
+    iov_pos += n;
+    total += n;
+
+    if( s->out_pos == s->out_len ) {
+      f->head = (f->head + 1) % f->nslots;
+      f->count--;
+    }
+  }
+
+  *num_read = total;
+  if( total > 0 ) return 0;
+  if( f->err ) return f->err;
+  return QIO_EEOF;
+}
+
+static
+qioerr compress_close(void* file_info, void* fs_info)
+{
+  compress_filter_t* f = (compress_filter_t*) file_info;
+  qioerr err = 0;
+
+  // An earlier error has already been reported by the read or write
+  // that ran into it.
+  if( f->writing && ! f->err ) err = filter_finish_frame(f);
+  // Nothing may be in flight once the buffers are gone.
+  filter_wait_all(f);
+
+  filter_free_slots(f);
+  qio_channel_release(f->under);
+  qio_free(f);
+  return err;
+}
+
+static const qio_file_functions_t compress_functions = {
+  &compress_writev,
+  &compress_readv,
+  NULL, // pwritev
+  NULL, // preadv
+  &compress_close,
+  NULL, // open
+  NULL, // seek
+  NULL, // filelength
+  NULL, // getpath
+  NULL, // fsync
+  NULL, // getcwd
+  NULL, // get_fs_type
+  NULL, // get_chunk
+  NULL, // get_locales_for_region
+};
+
+qioerr qio_channel_create_compress(qio_channel_t** ch_out,
+                                   qio_channel_t* under,
+                                   qio_compress_format_t format,
+                                   qio_hint_t hints,
+                                   const qio_style_t* style)
+{
+  compress_filter_t* f;
+  qio_file_t* file = NULL;
+  qio_style_t local_style;
+  int writing = (under->flags & QIO_FDFLAG_WRITEABLE) != 0;
+  qioerr err;
+
+  *ch_out = NULL;
+  if( format != QIO_COMPRESS_LZ4 )
+    QIO_RETURN_CONSTANT_ERROR(EINVAL, "unknown compression format");
+
+  pthread_once(&pool_once, pool_init);
+
+  f = (compress_filter_t*) qio_calloc(1, sizeof(compress_filter_t));
+  if( ! f ) return QIO_ENOMEM;
+  f->under = under;
+  qio_channel_retain(under);
+  f->writing = writing;
+
+  if( writing ) {
+    err = filter_setup_slots(f, block_size_for_id(QIO_COMPRESS_BLOCK_SIZE_ID));
+    if( ! err ) err = filter_write_header(f);
+    qio_xxh32_init(&f->content_hash, 0);
+  } else {
+    err = 0;
+  }
+  if( ! err ) {
+    err = qio_file_init_usr(&file, f, hints | QIO_HINT_OWNED,
+                            writing ? QIO_FDFLAG_WRITEABLE
+                                    : QIO_FDFLAG_READABLE,
+                            style, NULL, &compress_functions);
+  }
+  if( err ) {
+    filter_free_slots(f);
+    qio_channel_release(under);
+    qio_free(f);
+    return err;
+  }
+
+  if( style ) qio_style_copy(&local_style, style);
+  else qio_style_init_default(&local_style);
+
+  // The channel holds the only reference to the file, so closing the
+  // channel closes the filter (finishing the frame when writing).
+  err = qio_channel_create(ch_out, file, hints, ! writing, writing,
+                           0, INT64_MAX, &local_style);
+  qio_file_release(file);
+  return err;
+}
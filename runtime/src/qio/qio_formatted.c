@@ -2105,6 +2105,252 @@ error:
 }
 
 
+// Fast paths for scanning decimal numbers.
+//
+// When a number and the byte after it are already in the cached part
+// of the channel's buffer, and the style is the default decimal one,
+// we can parse it right out of the buffer instead of going through
+// _peek_number_unlocked, a mark and revert, and a copy.  These return
+// 1 and advance cached_cur past the number on success.  They return 0,
+// having consumed nothing, for anything the general path needs to see:
+// a number that might continue past the buffer, a base prefix, too
+// many digits, non-ASCII input, and so on.
+
+static inline int _qio_isdigit(uint8_t c)
+{
+  return (uint8_t) (c - '0') < 10;
+}
+
+static inline int _qio_isspace_ascii(uint8_t c)
+{
+  return c == ' ' || ('\t' <= c && c <= '\r');
+}
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// Eight bytes at a time ("SIMD within a register").  v holds 8 bytes
+// of input loaded little-endian, so the first byte is the low byte.
+#define QIO_SWAR_DIGITS 1
+
+// How many of the bytes in v, starting from the first, are digits?
+static inline int _qio_swar_ndigits(uint64_t v)
+{
+  uint64_t x = v ^ 0x3030303030303030ull; // digits become 0..9
+  // Set the high bit of each byte that is not 0..9.  Carries out of a
+  // byte only happen for bytes that are already flagged, so the lowest
+  // flagged byte is always right.
+  uint64_t nd = ((x + 0x7676767676767676ull) | x) & 0x8080808080808080ull;
+  if( nd == 0 ) return 8;
+  return __builtin_ctzll(nd) >> 3;
+}
+
+// Converts 8 digits to their value with three multiplies.
+static inline uint64_t _qio_swar_parse8(uint64_t v)
+{
+  const uint64_t mask = 0x000000FF000000FFull;
+  const uint64_t mul1 = 100 + (1000000ull << 32);
+  const uint64_t mul2 = 1 + (10000ull << 32);
+  v -= 0x3030303030303030ull;
+  v = (v * 10) + (v >> 8); // pairs of digits
+  v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+  return v;
+}
+#endif
+
+// Reads the digits starting at *pp into *num_out.  Returns the number
+// of digits, which is more than 19 if *num_out overflowed.  Leaves *pp
+// at the first non-digit, or at end.
+static inline int _qio_scan_digits(const uint8_t** pp, const uint8_t* end, uint64_t* num_out)
+{
+  const uint8_t* p = *pp;
+  uint64_t num = 0;
+  int n = 0;
+
+#ifdef QIO_SWAR_DIGITS
+  static const uint64_t pow10[8] = {1, 10, 100, 1000, 10000, 100000,
+                                    1000000, 10000000};
+  while( end - p >= 8 ) {
+    uint64_t v;
+    int k;
+    memcpy(&v, p, 8);
+    k = _qio_swar_ndigits(v);
+    if( k == 8 ) {
+      num = num * 100000000 + _qio_swar_parse8(v);
+    } else if( k > 0 ) {
+      // Shift the k digits up to the top and fill below with '0's.
+      v = (v << (64 - 8*k)) | (0x3030303030303030ull >> (8*k));
+      num = num * pow10[k] + _qio_swar_parse8(v);
+    }
+    p += k;
+    n += k;
+    if( k < 8 ) goto done;
+  }
+#endif
+
+  while( p < end && _qio_isdigit(*p) ) {
+    num = num * 10 + (*p - '0');
+    p++;
+    n++;
+  }
+
+#ifdef QIO_SWAR_DIGITS
+done:
+#endif
+  *pp = p;
+  *num_out = num;
+  return n;
+}
+
+// Skips whitespace and reads a sign.  Returns the first byte of the
+// number, or NULL if the general path should handle the input.
+static inline const uint8_t* _qio_scan_fast_start(const uint8_t* p, const uint8_t* end, char pos_char, char neg_char, int* sign_out)
+{
+  while( p < end && _qio_isspace_ascii(*p) ) p++;
+  if( p == end || *p >= 0x80 ) return NULL;
+
+  *sign_out = 0;
+  if( pos_char && tolower(*p) == pos_char ) {
+    *sign_out = 1;
+    p++;
+  } else if( neg_char && tolower(*p) == neg_char ) {
+    *sign_out = -1;
+    p++;
+  }
+  return p;
+}
+
+// Would _peek_number_unlocked treat the digits at p as a 0x/0o/0b prefix?
+static inline int _qio_scan_has_prefix(const uint8_t* p, const uint8_t* end, const qio_style_t* style)
+{
+  int c;
+  if( ! style->prefix_base || end - p < 2 || p[0] != '0' ) return 0;
+  c = tolower(p[1]);
+  return c == 'x' || c == 'o' || c == 'b';
+}
+
+static
+int _qio_scan_int_fast(qio_channel_t* restrict ch, const qio_style_t* restrict style, int issigned, unsigned long long int* restrict num_out, int* restrict sign_out)
+{
+  const uint8_t* p = ch->cached_cur;
+  const uint8_t* end = ch->cached_end;
+  uint64_t num;
+  int n;
+  int sign;
+
+  if( p == NULL ) return 0;
+  if( style->base != 0 && style->base != 10 ) return 0;
+  // Let the general path consume a . or .000 after the number.
+  if( style->showpoint || style->precision > 0 ) return 0;
+
+  p = _qio_scan_fast_start(p, end,
+                           (style->showplus == 1) ? tolower(style->positive_char) : 0,
+                           issigned ? tolower(style->negative_char) : 0,
+                           &sign);
+  if( ! p || _qio_scan_has_prefix(p, end, style) ) return 0;
+
+  n = _qio_scan_digits(&p, end, &num);
+  // Anything more than 19 digits might not fit; the general path
+  // reports the overflow.  A number running up to the end of the
+  // buffer might have more digits after it.
+  if( n == 0 || n > 19 || p == end ) return 0;
+
+  ch->cached_cur = (void*) p;
+  *num_out = num;
+  *sign_out = issigned ? sign : 1;
+  return 1;
+}
+
+// Powers of 10 that are exact as doubles.
+static const double _qio_exact_pow10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static
+int _qio_scan_float_fast(qio_channel_t* restrict ch, const qio_style_t* restrict style, double* restrict out)
+{
+  const uint8_t* p = ch->cached_cur;
+  const uint8_t* end = ch->cached_end;
+  const uint8_t* digits;
+  uint64_t mant = 0;
+  int ndigits = 0;
+  int nsig = 0; // digits in mant, not counting leading zeros
+  int exp10 = 0;
+  int exp_val = 0;
+  int exp_sign = 1;
+  int sign;
+  double num;
+
+  if( p == NULL ) return 0;
+  if( style->base != 0 && style->base != 10 ) return 0;
+  if( style->point_char != '.' || tolower(style->exponent_char) != 'e' ||
+      style->positive_char != '+' || style->negative_char != '-' )
+    return 0;
+
+  p = _qio_scan_fast_start(p, end, '+', '-', &sign);
+  if( ! p || _qio_scan_has_prefix(p, end, style) ) return 0;
+  digits = p;
+
+  for( ; p < end && _qio_isdigit(*p); p++ ) {
+    ndigits++;
+    if( nsig > 0 || *p != '0' ) {
+      if( nsig < 19 ) mant = mant * 10 + (*p - '0');
+      nsig++;
+    }
+  }
+  if( p < end && *p == '.' ) {
+    for( p++; p < end && _qio_isdigit(*p); p++ ) {
+      ndigits++;
+      if( nsig > 0 || *p != '0' ) {
+        if( nsig < 19 ) mant = mant * 10 + (*p - '0');
+        nsig++;
+      }
+      exp10--;
+    }
+  }
+  if( ndigits == 0 ) return 0; // inf, nan, or not a number
+
+  if( p < end && (*p == 'e' || *p == 'E') ) {
+    p++;
+    if( p < end && (*p == '+' || *p == '-') ) {
+      if( *p == '-' ) exp_sign = -1;
+      p++;
+    }
+    if( p == end || ! _qio_isdigit(*p) ) return 0;
+    for( ; p < end && _qio_isdigit(*p); p++ ) {
+      if( exp_val < 100000 ) exp_val = exp_val * 10 + (*p - '0');
+    }
+  }
+
+  // The general path would keep going after any of these.
+  if( p == end || _qio_isdigit(*p) || *p == '.' || *p == 'e' || *p == 'E' )
+    return 0;
+
+  exp10 += exp_sign * exp_val;
+
+  if( nsig == 0 ) {
+    num = 0.0;
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  } else if( nsig <= 15 && -22 <= exp10 && exp10 <= 22 ) {
+    // mant and 10^|exp10| are both exact doubles, so a single
+    // correctly rounded multiply or divide gives the right answer.
+    num = (double) mant;
+    if( exp10 < 0 ) num /= _qio_exact_pow10[-exp10];
+    else num *= _qio_exact_pow10[exp10];
+#endif
+  } else {
+    char* end_conv;
+    // The byte at p stops strtod, so it stays within the buffer.
+    errno = 0;
+    num = strtod((const char*) digits, &end_conv);
+    if( (const uint8_t*) end_conv != p || errno == ERANGE ) return 0;
+  }
+
+  ch->cached_cur = (void*) p;
+  *out = (sign < 0) ? -num : num;
+  return 1;
+}
+
 qioerr qio_channel_scan_int(const int threadsafe, qio_channel_t* restrict ch, void* restrict out, size_t len, int issigned)
 {
   unsigned long long int num = 0;
@@ -2130,6 +2376,11 @@ qioerr qio_channel_scan_int(const int threadsafe, qio_channel_t* restrict ch, vo
 
   style = &ch->style;
 
+  if( _qio_scan_int_fast(ch, style, issigned, &num, &sign) ) {
+    err = 0;
+    goto error;
+  }
+
   memset(&st, 0, sizeof(number_reading_state_t));
 
   st.base = style->base;
@@ -2290,6 +2541,11 @@ qioerr qio_channel_scan_float_or_imag(const int threadsafe, qio_channel_t* restr
 
   needs_i = imag && style->complex_style == QIO_COMPLEX_FORMAT_ABI;
 
+  if( ! needs_i && _qio_scan_float_fast(ch, style, &num) ) {
+    err = 0;
+    goto error;
+  }
+
   memset(&st, 0, sizeof(number_reading_state_t));
 
   st.base = style->base;
@@ -2471,6 +2727,40 @@ static inline int _ltoa_convert(char *tmp, int tmplen, uint64_t num, int base, i
   return at;
 }
 
+static const char _qio_digit_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+// _ltoa_convert for base 10, two digits at a time.
+static inline int _ltoa_convert10(char *tmp, int tmplen, uint64_t num)
+{
+  int at = tmplen - 1;
+  int pair;
+  tmp[at] = '\0';
+  while( num >= 100 ) {
+    pair = 2 * (num % 100);
+    num /= 100;
+    tmp[--at] = _qio_digit_pairs[pair + 1];
+    tmp[--at] = _qio_digit_pairs[pair];
+  }
+  if( num >= 10 ) {
+    pair = 2 * num;
+    tmp[--at] = _qio_digit_pairs[pair + 1];
+    tmp[--at] = _qio_digit_pairs[pair];
+  } else {
+    tmp[--at] = '0' + num;
+  }
+  return at;
+}
+
 // dst must have room (at most 65 bytes for binary + '\0')
 // Returns the number of characters written (not including '\0')
 // or >= size if there wasn't room in the buffer (returns amt needed)
@@ -2496,7 +2786,7 @@ int _ltoa(char* restrict dst, size_t size, uint64_t num, int isnegative,
   else if( base == 8 )
     tmp_skip = _ltoa_convert(tmp, sizeof(tmp), num, 8, 0);
   else if( base == 10 )
-    tmp_skip = _ltoa_convert(tmp, sizeof(tmp), num, 10, 0);
+    tmp_skip = _ltoa_convert10(tmp, sizeof(tmp), num);
   else if( base == 16 )
     tmp_skip = _ltoa_convert(tmp, sizeof(tmp), num, 16, style->uppercase);
   else
@@ -2589,6 +2879,373 @@ int _ltoa(char* restrict dst, size_t size, uint64_t num, int isnegative,
   return i;
 }
 
+// Shortest round-trip digits for binary floating point, after
+// Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018.
+//
+// _qio_d2d finds the shortest decimal mantissa * 10^exponent that
+// reads back as m2 * 2^e2 (the caller has already applied the IEEE
+// bias and multiplied by 4, as in the paper), and of those, the
+// closest one.  It needs only 64x128-bit multiplies by the
+// precomputed powers of 5 in qio_ryu_table.h.  It works for floats
+// as well as doubles since their mantissas and exponents fit in the
+// same ranges.
+
+#include "qio_ryu_table.h"
+
+// The most digits the shortest form of a double can need.
+#define QIO_SHORTEST_MAX_DIGITS 17
+
+static inline int32_t _qio_pow5bits(int32_t e)
+{
+  // ceil(log2(5^e)) for 0 < e <= 3528; 1 for e == 0.
+  return (int32_t) (((uint32_t) e * 1217359) >> 19) + 1;
+}
+
+static inline int32_t _qio_log10pow2(int32_t e)
+{
+  // floor(log10(2^e)) for 0 <= e <= 1650
+  return (int32_t) (((uint32_t) e * 78913) >> 18);
+}
+
+static inline int32_t _qio_log10pow5(int32_t e)
+{
+  // floor(log10(5^e)) for 0 <= e <= 2620
+  return (int32_t) (((uint32_t) e * 732923) >> 20);
+}
+
+static inline int _qio_multiple_of_pow5(uint64_t v, int32_t p)
+{
+  int32_t count = 0;
+  while( v % 5 == 0 ) {
+    v /= 5;
+    count++;
+  }
+  return count >= p;
+}
+
+static inline int _qio_multiple_of_pow2(uint64_t v, int32_t p)
+{
+  return (v & ((1ull << p) - 1)) == 0;
+}
+
+// (m * mul) >> j, where mul is a 128-bit table entry and 64 < j < 128.
+static inline uint64_t _qio_mulshift64(uint64_t m, const uint64_t* mul, int32_t j)
+{
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 b0 = (unsigned __int128) m * mul[0];
+  unsigned __int128 b2 = (unsigned __int128) m * mul[1];
+  return (uint64_t) (((b0 >> 64) + b2) >> (j - 64));
+#else
+  // The same thing with 32x32-bit multiplies.
+  uint64_t m_lo = (uint32_t) m, m_hi = m >> 32;
+  uint64_t lo0 = (uint32_t) mul[0], hi0 = mul[0] >> 32;
+  uint64_t lo1 = (uint32_t) mul[1], hi1 = mul[1] >> 32;
+  uint64_t t, mid, b0_hi, b2_lo, b2_hi, sum;
+  int32_t dist = j - 64;
+
+  // high 64 bits of m * mul[0]
+  t = m_lo * lo0;
+  mid = m_hi * lo0 + (t >> 32);
+  t = m_lo * hi0 + (uint32_t) mid;
+  b0_hi = m_hi * hi0 + (mid >> 32) + (t >> 32);
+
+  // all 128 bits of m * mul[1]
+  t = m_lo * lo1;
+  mid = m_hi * lo1 + (t >> 32);
+  b2_lo = (uint32_t) t;
+  t = m_lo * hi1 + (uint32_t) mid;
+  b2_lo |= t << 32;
+  b2_hi = m_hi * hi1 + (mid >> 32) + (t >> 32);
+
+  sum = b0_hi + b2_lo;
+  if( sum < b0_hi ) b2_hi++;
+  return (b2_hi << (64 - dist)) | (sum >> dist);
+#endif
+}
+
+// Sets *exp10_out and returns the mantissa.
+static
+uint64_t _qio_d2d(uint64_t m2, int32_t e2, int mm_shift, int32_t* exp10_out)
+{
+  const int accept_bounds = (m2 & 1) == 0;
+  const uint64_t mv = 4 * m2;
+  const uint64_t mp = 4 * m2 + 2;
+  const uint64_t mm = 4 * m2 - 1 - mm_shift;
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  int vm_trailing_zeros = 0;
+  int vr_trailing_zeros = 0;
+  int32_t removed = 0;
+  int last_removed = 0;
+  uint64_t output;
+
+  // Convert the interval [mm, mp] around mv to a power of 10.
+  if( e2 >= 0 ) {
+    const int32_t q = _qio_log10pow2(e2) - (e2 > 3);
+    const int32_t k = QIO_POW5_INV_BITCOUNT + _qio_pow5bits(q) - 1;
+    const int32_t i = -e2 + q + k;
+    e10 = q;
+    vr = _qio_mulshift64(mv, QIO_POW5_INV_SPLIT[q], i);
+    vp = _qio_mulshift64(mp, QIO_POW5_INV_SPLIT[q], i);
+    vm = _qio_mulshift64(mm, QIO_POW5_INV_SPLIT[q], i);
+    if( q <= 21 ) {
+      // At most one of mp, mv, and mm can be a multiple of 5.
+      if( mv % 5 == 0 ) {
+        vr_trailing_zeros = _qio_multiple_of_pow5(mv, q);
+      } else if( accept_bounds ) {
+        vm_trailing_zeros = _qio_multiple_of_pow5(mm, q);
+      } else {
+        vp -= _qio_multiple_of_pow5(mp, q);
+      }
+    }
+  } else {
+    const int32_t q = _qio_log10pow5(-e2) - (-e2 > 1);
+    const int32_t i = -e2 - q;
+    const int32_t k = _qio_pow5bits(i) - QIO_POW5_BITCOUNT;
+    const int32_t j = q - k;
+    e10 = q + e2;
+    vr = _qio_mulshift64(mv, QIO_POW5_SPLIT[i], j);
+    vp = _qio_mulshift64(mp, QIO_POW5_SPLIT[i], j);
+    vm = _qio_mulshift64(mm, QIO_POW5_SPLIT[i], j);
+    if( q <= 1 ) {
+      // mv = 4 * m2 always has at least two trailing 0 bits.
+      vr_trailing_zeros = 1;
+      if( accept_bounds ) {
+        // mm = mv - 1 - mm_shift has a trailing 0 bit iff mm_shift == 1.
+        vm_trailing_zeros = mm_shift == 1;
+      } else {
+        // mp = mv + 2 always has at least one trailing 0 bit.
+        vp--;
+      }
+    } else if( q < 63 ) {
+      vr_trailing_zeros = _qio_multiple_of_pow2(mv, q);
+    }
+  }
+
+  // Remove digits while the interval still holds a shorter number.
+  if( vm_trailing_zeros || vr_trailing_zeros ) {
+    // The uncommon general case.
+    while( vp / 10 > vm / 10 ) {
+      vm_trailing_zeros &= vm % 10 == 0;
+      vr_trailing_zeros &= last_removed == 0;
+      last_removed = vr % 10;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    if( vm_trailing_zeros ) {
+      while( vm % 10 == 0 ) {
+        vr_trailing_zeros &= last_removed == 0;
+        last_removed = vr % 10;
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        removed++;
+      }
+    }
+    if( vr_trailing_zeros && last_removed == 5 && vr % 2 == 0 ) {
+      // Exactly halfway; round to even.
+      last_removed = 4;
+    }
+    output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) ||
+                   last_removed >= 5);
+  } else {
+    int round_up = 0;
+    if( vp / 100 > vm / 100 ) {
+      // Usually we can remove two digits at once.
+      round_up = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while( vp / 10 > vm / 10 ) {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+
+  *exp10_out = e10 + removed;
+  return output;
+}
+
+// Puts the shortest digits that read back as num (which must be finite
+// and positive) into digits and returns how many there are.  The first
+// digit is in the 10^(*exp10_out) place.  If isfloat, the digits are
+// the shortest that read back as (float) num.
+static
+int _qio_shortest_digits(double num, bool isfloat, char* digits, int32_t* exp10_out)
+{
+  uint64_t m2;
+  int32_t e2;
+  int mm_shift;
+  uint64_t output;
+  int32_t exp10;
+  int skip, i;
+
+  if( isfloat ) {
+    float f = num;
+    uint32_t bits;
+    uint32_t mantissa, exponent;
+    memcpy(&bits, &f, sizeof(bits));
+    mantissa = bits & ((1u << 23) - 1);
+    exponent = (bits >> 23) & 0xff;
+    // Subtract 2 more so the bounds get 2 extra bits.
+    if( exponent == 0 ) {
+      e2 = 1 - 127 - 23 - 2;
+      m2 = mantissa;
+    } else {
+      e2 = (int32_t) exponent - 127 - 23 - 2;
+      m2 = (1u << 23) | mantissa;
+    }
+    mm_shift = mantissa != 0 || exponent <= 1;
+  } else {
+    uint64_t bits;
+    uint64_t mantissa;
+    uint32_t exponent;
+    memcpy(&bits, &num, sizeof(bits));
+    mantissa = bits & ((1ull << 52) - 1);
+    exponent = (bits >> 52) & 0x7ff;
+    if( exponent == 0 ) {
+      e2 = 1 - 1023 - 52 - 2;
+      m2 = mantissa;
+    } else {
+      e2 = (int32_t) exponent - 1023 - 52 - 2;
+      m2 = (1ull << 52) | mantissa;
+    }
+    mm_shift = mantissa != 0 || exponent <= 1;
+  }
+
+  output = _qio_d2d(m2, e2, mm_shift, &exp10);
+
+  // Rounding up can leave trailing zeros (e.g. 9.5 -> 10).
+  while( output % 10 == 0 ) {
+    output /= 10;
+    exp10++;
+  }
+
+  skip = _ltoa_convert10(digits, QIO_SHORTEST_MAX_DIGITS + 1, output);
+  // _ltoa_convert10 right-justifies; move the digits to the front.
+  for( i = 0; skip + i < QIO_SHORTEST_MAX_DIGITS; i++ ) {
+    digits[i] = digits[skip + i];
+  }
+  *exp10_out = exp10 + i - 1;
+  return i;
+}
+
+// Lays out n digits whose first digit is in the 10^exp10 place the
+// way printf %.*g would with the given precision (which must be at
+// least n).  Returns the length; see _ftoa_core for how buf is used.
+static
+int _qio_format_digits_g(char* buf, size_t buf_sz, const char* digits, int n, int32_t exp10, int precision, int uppercase)
+{
+  char tmp[3 * QIO_SHORTEST_MAX_DIGITS];
+  int len = 0;
+  int i;
+
+  if( exp10 < -4 || exp10 >= precision ) {
+    // d.ddde+XX
+    tmp[len++] = digits[0];
+    if( n > 1 ) {
+      tmp[len++] = '.';
+      memcpy(tmp + len, digits + 1, n - 1);
+      len += n - 1;
+    }
+    tmp[len++] = uppercase ? 'E' : 'e';
+    if( exp10 < 0 ) {
+      tmp[len++] = '-';
+      exp10 = -exp10;
+    } else {
+      tmp[len++] = '+';
+    }
+    if( exp10 >= 100 ) tmp[len++] = '0' + exp10 / 100;
+    tmp[len++] = '0' + (exp10 / 10) % 10;
+    tmp[len++] = '0' + exp10 % 10;
+  } else if( exp10 >= 0 ) {
+    // ddd.ddd, or ddd000 when there are fewer digits than places.
+    for( i = 0; i <= exp10; i++ ) {
+      tmp[len++] = (i < n) ? digits[i] : '0';
+    }
+    if( n > exp10 + 1 ) {
+      tmp[len++] = '.';
+      memcpy(tmp + len, digits + exp10 + 1, n - exp10 - 1);
+      len += n - exp10 - 1;
+    }
+  } else {
+    // 0.000ddd
+    tmp[len++] = '0';
+    tmp[len++] = '.';
+    for( i = -1; i > exp10; i-- ) tmp[len++] = '0';
+    memcpy(tmp + len, digits, n);
+    len += n;
+  }
+
+  // Copy it out with snprintf's rules.
+  if( buf_sz > 0 ) {
+    size_t amt = ((size_t) len < buf_sz) ? (size_t) len : buf_sz - 1;
+    memcpy(buf, tmp, amt);
+    buf[amt] = '\0';
+  }
+  return len;
+}
+
+// Does what snprintf %.*g would for a nonnegative num, when that can
+// be worked out from the shortest digits.  Returns -1 otherwise.
+//
+// If the shortest digits S of num fit in the precision P, %.*g prints
+// exactly S as long as P <= 15 and num is normal, because then num is
+// within half a unit in the P'th place of S.  If S is longer than P,
+// rounding S to P digits gives the same answer as rounding num unless
+// S ends in exactly 5 right after the P'th digit: there is no rounding
+// boundary between num and S, since otherwise either that boundary
+// would have been a shorter choice or it would have been closer to num.
+static
+int _ftoa_g_shortest(char* buf, size_t buf_sz, double num, int precision, int uppercase)
+{
+  char digits[QIO_SHORTEST_MAX_DIGITS + 1];
+  int32_t exp10;
+  int n, i;
+
+  if( precision == 0 ) precision = 1;
+
+  if( num == 0.0 && ! signbit(num) ) {
+    digits[0] = '0';
+    return _qio_format_digits_g(buf, buf_sz, digits, 1, 0, precision, uppercase);
+  }
+  // Also excludes negative numbers, infinity and nan.
+  if( !(num >= DBL_MIN && num <= DBL_MAX) ) return -1;
+
+  n = _qio_shortest_digits(num, false, digits, &exp10);
+
+  if( n <= precision ) {
+    if( precision > 15 ) return -1;
+  } else {
+    if( n == precision + 1 && digits[precision] == '5' ) return -1;
+    if( digits[precision] >= '5' ) {
+      for( i = precision - 1; i >= 0 && digits[i] == '9'; i-- ) ;
+      if( i < 0 ) {
+        // 999.. rounded up to 1000..
+        digits[0] = '1';
+        n = 1;
+        exp10++;
+      } else {
+        digits[i]++;
+        n = i + 1;
+      }
+    } else {
+      n = precision;
+    }
+    while( n > 1 && digits[n-1] == '0' ) n--;
+  }
+
+  return _qio_format_digits_g(buf, buf_sz, digits, n, exp10, precision, uppercase);
+}
+
 // Converts num to a string in buf, returns the number
 // of bytes that would be used if space permits (not including null)
 // or -1 on error
@@ -2602,16 +3259,17 @@ int _ltoa(char* restrict dst, size_t size, uint64_t num, int isnegative,
 //
 // num is the number to be converted
 // buf and buf_sz are the output buffer
+// isfloat means num came from a float (only matters for realfmt 3)
 // base is the numeric base (10 or 16 only)
-// realfmt is style->realfmt; 0->%g, 1->%f, 2->%e
+// realfmt is style->realfmt; 0->%g, 1->%f, 2->%e, 3->shortest round-trip
 // precision is the number of digits after . for %f or %e or
-//   the number of significant digits
+//   the number of significant digits (ignored for realfmt 3)
 // uppercase indicates hex digits or exponent character should be uppercase
 // prefix_base means add 0x for base=16 conversions
 // skip is described above and indicates some buffer space used that does
 //  not encode output.
 static
-int _ftoa_core(char* buf, size_t buf_sz, double num,
+int _ftoa_core(char* buf, size_t buf_sz, double num, bool isfloat,
                int base, int realfmt,
                int precision, int uppercase,
                int prefix_base,
@@ -2654,7 +3312,12 @@ int _ftoa_core(char* buf, size_t buf_sz, double num,
     // We'll add 0x later if we want it.
     if( !isnan(num) && !isinf(num) ) *skip = 2;
   } else if( realfmt == 0 ) {
-    if( precision < 0 ) {
+    // Usually we can skip snprintf here.
+    got = _ftoa_g_shortest(buf, buf_sz, num,
+                           (precision < 0) ? 6 : precision, uppercase);
+    if( got >= 0 ) {
+      // done
+    } else if( precision < 0 ) {
       if( uppercase ) {
         got = snprintf(buf, buf_sz, "%G", num);
       } else {
@@ -2695,6 +3358,21 @@ int _ftoa_core(char* buf, size_t buf_sz, double num,
         got = snprintf(buf, buf_sz, "%.*e", precision, num);
       }
     }
+  } else if( realfmt == 3 ) {
+    if( isnan(num) || isinf(num) ) {
+      got = snprintf(buf, buf_sz, uppercase ? "%G" : "%g", num);
+    } else {
+      char digits[QIO_SHORTEST_MAX_DIGITS + 1];
+      int32_t exp10 = 0;
+      int n = 1;
+
+      // Like %.17g but with only as many digits as it takes
+      // to read the same number back.
+      digits[0] = '0';
+      if( num != 0.0 ) n = _qio_shortest_digits(num, isfloat, digits, &exp10);
+      got = _qio_format_digits_g(buf, buf_sz, digits, n, exp10,
+                                 QIO_SHORTEST_MAX_DIGITS, uppercase);
+    }
   }
 
   return got;
@@ -2718,7 +3396,7 @@ int _ftoa_core(char* buf, size_t buf_sz, double num,
 // The conversion was successfull if
 //   n + *extra_space_needed <= size.
 static
-int _ftoa(char* restrict dst, size_t size, double num, int base, bool needs_i, const qio_style_t* restrict style, int * extra_space_needed )
+int _ftoa(char* restrict dst, size_t size, double num, bool isfloat, int base, bool needs_i, const qio_style_t* restrict style, int * extra_space_needed )
 {
   int got=0;
   int width;
@@ -2772,7 +3450,7 @@ int _ftoa(char* restrict dst, size_t size, double num, int base, bool needs_i, c
   skip = 0;
   got = _ftoa_core(&dst[sign_base_width],
                    (size>sign_base_width)?(size-sign_base_width):0,
-                   num, base, style->realfmt,
+                   num, isfloat, base, style->realfmt,
                    precision, style->uppercase, style->prefix_base,
                    &skip);
 
@@ -3093,7 +3771,7 @@ qioerr qio_channel_print_float_or_imag(const int threadsafe, qio_channel_t* rest
 
   // Try printing it directly into the buffer.
   got = _ftoa(ch->cached_cur, qio_ptr_diff(ch->cached_end, ch->cached_cur),
-              num, base, needs_i, style, &extra);
+              num, len == 4, base, needs_i, style, &extra);
 
   if( got < 0 ) {
     if( got == -1 ) err = QIO_ENOMEM;
@@ -3129,7 +3807,7 @@ qioerr qio_channel_print_float_or_imag(const int threadsafe, qio_channel_t* rest
     }
 
     // Print it all to buf
-    got = _ftoa(buf, max, num, base, needs_i, style, &extra);
+    got = _ftoa(buf, max, num, len == 4, base, needs_i, style, &extra);
     if( got < 0 ) {
       QIO_GET_CONSTANT_ERROR(err, EINVAL, "converting floating point number to string");
       goto error_free;
@@ -3509,7 +4187,7 @@ qioerr qio_channel_print_complex(const int threadsafe,
     }
 
     // Convert re_num8 into digits in re_buf
-    re_got = _ftoa(re_buf, re_max, re_num, base, false, style, &extra);
+    re_got = _ftoa(re_buf, re_max, re_num, len == 4, base, false, style, &extra);
     if( re_got < 0 ) {
       QIO_GET_CONSTANT_ERROR(err, EFORMAT, "error in floating point to string conversion");
       goto rewind;
@@ -3538,7 +4216,7 @@ qioerr qio_channel_print_complex(const int threadsafe,
     }
 
     // Convert im_num8 into digits in im_buf
-    im_got = _ftoa(im_buf, im_max, im_num, base, imag_needs_i, style, &extra);
+    im_got = _ftoa(im_buf, im_max, im_num, len == 4, base, imag_needs_i, style, &extra);
     if( im_got < 0 ) {
       QIO_GET_CONSTANT_ERROR(err, EFORMAT, "error in floating point to string conversion");
       goto rewind;
@@ -4624,3 +5302,50 @@ qioerr qio_format_error_write_regexp(void)
 
 
 
+
+qioerr qio_file_record_boundaries(qio_file_t* f, uint8_t separator, int64_t start, int64_t end, int64_t nchunks, int64_t* bounds_out)
+{
+  qio_channel_t* ch = NULL;
+  int64_t len = 0;
+  int64_t span;
+  int64_t guess;
+  int64_t pos;
+  int64_t amt = 0;
+  int found = 0;
+  int64_t i;
+  qioerr err;
+
+  if( nchunks < 1 ) QIO_RETURN_CONSTANT_ERROR(EINVAL, "need at least one chunk");
+
+  err = qio_file_length(f, &len);
+  if( err ) return err;
+
+  if( end > len ) end = len;
+  if( start < 0 ) start = 0;
+  if( start > end ) start = end;
+  span = end - start;
+
+  bounds_out[0] = start;
+  for( i = 1; i < nchunks; i++ ) {
+    // Where an even split would put this boundary (without overflowing).
+    guess = start + (span / nchunks) * i + ((span % nchunks) * i) / nchunks;
+
+    // The boundary is just after the first separator at or after
+    // guess-1, so a record that starts exactly at guess stays whole.
+    // If the previous chunk already ends past that, this one is empty.
+    pos = bounds_out[i-1];
+    if( guess > pos ) {
+      err = qio_channel_create(&ch, f, 0, 1, 0, guess - 1, end, NULL);
+      if( err ) return err;
+      err = _peek_until_byte(ch, separator, &amt, &found);
+      qio_channel_release(ch);
+      if( err && qio_err_to_int(err) != EEOF ) return err;
+      if( found ) pos = guess - 1 + amt + 1;
+      else pos = end;
+    }
+    bounds_out[i] = pos;
+  }
+  bounds_out[nchunks] = end;
+
+  return 0;
+}
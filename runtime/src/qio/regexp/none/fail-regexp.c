@@ -90,3 +90,43 @@ qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe
   return 0;
 }
 
+void qio_regexp_set_create(const qio_regexp_options_t* options, qio_regexp_set_t* set)
+{
+  chpl_internal_error("No Regexp Support");
+}
+
+int64_t qio_regexp_set_add(qio_regexp_set_t* set, const char* str, int64_t str_len, const char** error_out)
+{
+  chpl_internal_error("No Regexp Support");
+  return -1;
+}
+
+qio_bool qio_regexp_set_compile(qio_regexp_set_t* set)
+{
+  return false;
+}
+
+void qio_regexp_set_retain(const qio_regexp_set_t* set)
+{
+}
+void qio_regexp_set_release(qio_regexp_set_t* set)
+{
+}
+
+int64_t qio_regexp_set_size(const qio_regexp_set_t* set)
+{
+  return 0;
+}
+
+int64_t qio_regexp_set_match(const qio_regexp_set_t* set, const char* str, int64_t str_len, int64_t* matched, int64_t nmatched)
+{
+  chpl_internal_error("No Regexp Support");
+  return 0;
+}
+
+qioerr qio_regexp_set_channel_match(const qio_regexp_set_t* set, const int threadsafe, struct qio_channel_s* ch, qio_regexp_string_piece_t* line, int64_t* matched, int64_t nmatched, int64_t* nfound)
+{
+  chpl_internal_error("No Regexp Support");
+  return 0;
+}
+
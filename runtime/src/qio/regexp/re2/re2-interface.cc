@@ -6,6 +6,10 @@
 
 #include <limits>
 #include <algorithm>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
 #include <pthread.h>
 
 extern "C" {
@@ -13,6 +17,7 @@ extern "C" {
   #include <stdio.h>
 #ifndef CHPL_RT_UNIT_TEST
   #include "stdchplrt.h"
+  #include "chpl-env.h"
 #endif
   #include "qio_regexp.h"
   #include "qbuffer.h" // qio_strdup, refcount functions, qio_ptr_diff, etc
@@ -21,18 +26,17 @@ extern "C" {
 }
 
 #include "re2/re2.h"
+#include "re2/set.h"
 //#include "re2/regexp.h"
 
 using namespace re2;
 
-struct re_cache;
-
 struct re_t {
   RE2 re;
   qbytes_refcnt_t ref_cnt;
   // RE2 implementations are shared and ref-counted.
   // We free the internal RE2 once ref_cnt==0.
-  re_t(StringPiece& pattern, const RE2::Options& option, re_cache* home)
+  re_t(StringPiece& pattern, const RE2::Options& option)
     : re(pattern, option)
   {
     // Initialize the reference count to 1.
@@ -41,37 +45,38 @@ struct re_t {
   }
 };
 
-// A very simple 8-element local regexp cache.
-#define REGEXP_CACHE_SIZE 8
-struct cache_elem {
-  int64_t date;
-  re_t* re;
-};
+// A process-wide cache of compiled regexps, so that compiling the same
+// pattern again (for example, once per reader or per task) reuses the
+// RE2 object instead of building a new one.  It is keyed by the pattern
+// and the options and holds at most CHPL_RT_REGEXP_CACHE_SIZE regexps,
+// evicting the least recently used one.  An evicted regexp lives on
+// until whoever is using it releases it.
+#ifndef CHPL_RT_UNIT_TEST
+#define REGEXP_CACHE_SIZE_DEFAULT \
+  ((size_t) chpl_get_rt_env_int("REGEXP_CACHE_SIZE", 64))
+#else
+#define REGEXP_CACHE_SIZE_DEFAULT ((size_t) 64)
+#endif
+
+typedef std::list<std::pair<std::string, re_t*> > re_cache_list;
 
 struct re_cache {
-  int64_t date;
-  cache_elem elems[REGEXP_CACHE_SIZE];
+  pthread_mutex_t lock;
+  size_t max;
+  // Most recently used first.
+  re_cache_list lru;
+  std::map<std::string, re_cache_list::iterator> index;
 };
-static pthread_key_t key;
-static pthread_once_t key_once = PTHREAD_ONCE_INIT;
 
-static
-void make_key(void)
-{
-  (void) pthread_key_create(&key, NULL);
-}
+static re_cache* cache;
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
 
-static inline
-re_cache* local_cache(void)
+static
+void make_cache(void)
 {
-  re_cache* ptr;
-  (void) pthread_once(&key_once, make_key);
-  if((ptr = (re_cache*) pthread_getspecific(key)) == NULL) {
-    ptr = (re_cache*) qio_malloc(sizeof(re_cache));
-    memset(ptr, 0, sizeof(re_cache));
-    (void) pthread_setspecific(key, ptr);
-  }
-  return ptr;
+  cache = new re_cache;
+  pthread_mutex_init(&cache->lock, NULL);
+  cache->max = REGEXP_CACHE_SIZE_DEFAULT;
 }
 
 static
@@ -100,19 +105,6 @@ void re2_options_to_qio_re_options(const RE2::Options *opts, qio_regexp_options_
   options->nongreedy = ! opts->longest_match();
 }
 
-static
-bool equal_options(const RE2::Options *opts, const qio_regexp_options_t* options)
-{
-  return  options->utf8 == opts->utf8() &&
-          options->posix == opts->posix_syntax() &&
-          options->literal == opts->literal() &&
-          options->nocapture == opts->never_capture() &&
-          options->ignorecase == !opts->case_sensitive() &&
-          options->multiline == !opts->one_line() &&
-          options->dotnl == opts->dot_nl() &&
-          options->nongreedy == ! opts->longest_match();
-}
-
 static
 void re_free(re_t* re)
 {
@@ -121,56 +113,84 @@ void re_free(re_t* re)
 }
 
 
+// The cache key is the pattern followed by one byte of option bits.
 static
-re_t* local_cache_get(const char* str, int64_t str_len, const qio_regexp_options_t* options) {
-  re_cache* c = local_cache();
-  int oldest;
-  int64_t oldest_date;
-  c->date++;
-  // Find either the oldest element
-  // or a matching element
-  oldest = 0;
-  oldest_date = c->elems[0].date;
-  for( int i = 0; i < REGEXP_CACHE_SIZE; i++ ) {
-    if( c->elems[i].date < oldest_date ) {
-      oldest = i;
-      oldest_date = c->elems[i].date;
-    }
-    if( ! c->elems[i].re ) continue;
-    const string& pat = c->elems[i].re->re.pattern();
-    const RE2::Options& opt = c->elems[i].re->re.options();
-    if( (uint64_t) pat.length() == (uint64_t) str_len &&
-        0 == memcmp(pat.data(), str, str_len ) &&
-        equal_options(&opt, options) ) {
-      // Make the date current.
-      c->elems[i].date = c->date;
-      // Return this element.
-      re_t* re = c->elems[i].re;
-      // We increment the reference count before returning a copy to the
-      // caller.  It is up to the caller to release the re_t handle when done.
-      DO_RETAIN(re);
-      return re;
-    }
-  }
+std::string cache_key(const char* str, int64_t str_len, const qio_regexp_options_t* options)
+{
+  std::string key(str, str_len);
+  char bits = 0;
+  if( options->utf8 ) bits |= 1;
+  if( options->posix ) bits |= 2;
+  if( options->literal ) bits |= 4;
+  if( options->nocapture ) bits |= 8;
+  if( options->ignorecase ) bits |= 16;
+  if( options->multiline ) bits |= 32;
+  if( options->dotnl ) bits |= 64;
+  if( options->nongreedy ) bits |= (char) 128;
+  key.push_back(bits);
+  return key;
+}
+
+static
+re_t* cache_get(const char* str, int64_t str_len, const qio_regexp_options_t* options) {
+  std::string key = cache_key(str, str_len, options);
+  re_t* re;
 
-  // If we found no match, replace oldest.
-  if( c->elems[oldest].re) DO_RELEASE(c->elems[oldest].re, re_free);
+  (void) pthread_once(&cache_once, make_cache);
+
+  pthread_mutex_lock(&cache->lock);
+  std::map<std::string, re_cache_list::iterator>::iterator found =
+    cache->index.find(key);
+  if( found != cache->index.end() ) {
+    // Move it to the front of the LRU list.
+    cache->lru.splice(cache->lru.begin(), cache->lru, found->second);
+    re = found->second->second;
+    // We increment the reference count before returning a copy to the
+    // caller.  It is up to the caller to release the re_t handle when done.
+    DO_RETAIN(re);
+    pthread_mutex_unlock(&cache->lock);
+    return re;
+  }
+  pthread_mutex_unlock(&cache->lock);
 
-  // Put a new RE in that slot.
+  // Compile without holding the lock; if another thread compiled the
+  // same pattern meanwhile, we use theirs.
   RE2::Options opts;
   qio_re_options_to_re2_options(options, &opts);
   StringPiece strp(str, str_len);
-  re_t* re = new re_t(strp, opts, c);
-  c->elems[oldest].date = c->date;
-  c->elems[oldest].re = re;
-  // We increment the reference count before returning a copy to the
-  // caller.  It is up to the caller to release the re_t handle when done.
+  re_t* fresh = new re_t(strp, opts);
+
+  if( cache->max == 0 ) {
+    // No cache; the caller gets the only reference.
+    return fresh;
+  }
+
+  pthread_mutex_lock(&cache->lock);
+  found = cache->index.find(key);
+  if( found != cache->index.end() ) {
+    cache->lru.splice(cache->lru.begin(), cache->lru, found->second);
+    re = found->second->second;
+  } else {
+    re = fresh;
+    fresh = NULL;
+    cache->lru.push_front(std::make_pair(key, re));
+    cache->index[key] = cache->lru.begin();
+    while( cache->lru.size() > cache->max ) {
+      re_t* victim = cache->lru.back().second;
+      cache->index.erase(cache->lru.back().first);
+      cache->lru.pop_back();
+      DO_RELEASE(victim, re_free);
+    }
+  }
   DO_RETAIN(re);
+  pthread_mutex_unlock(&cache->lock);
+
+  if( fresh ) DO_RELEASE(fresh, re_free);
+
   return re;
 }
 
 
-
 void qio_regexp_init_default_options(qio_regexp_options_t* opt)
 {
   opt->utf8 = true;
@@ -186,12 +206,11 @@ void qio_regexp_init_default_options(qio_regexp_options_t* opt)
 // The returned re_t (passed back through "compiled") must be released by the caller.
 void qio_regexp_create_compile(const char* str, int64_t str_len, const qio_regexp_options_t* options, qio_regexp_t* compiled)
 {
-  re_t* regexp = local_cache_get(str, str_len, options);
+  // cache_get has already counted the caller's reference, so a regexp
+  // can be removed from the cache without a copy that is still in use
+  // being deleted early.
+  re_t* regexp = cache_get(str, str_len, options);
   compiled->regexp = (void*) regexp;
-  // We bump the reference count, because caller "owns" its copy of the cached
-  // regexp.  This way, a regexp can be removed from the cache without causing a
-  // copy that is still in use to be deleted early.
-  DO_RETAIN(regexp);
 }
 
 // The re_t returned in compiled must be released by the caller.
@@ -325,6 +344,223 @@ int64_t qio_regexp_replace(qio_regexp_t* regexp, const char* repl, int64_t repl_
   return ret;
 }
 
+struct re_set_t {
+  RE2::Set set;
+  int64_t size;
+  bool compiled;
+  qbytes_refcnt_t ref_cnt;
+  re_set_t(const RE2::Options& options)
+    : set(options, RE2::UNANCHORED), size(0), compiled(false)
+  {
+    DO_INIT_REFCNT(this);
+  }
+};
+
+static
+void re_set_free(re_set_t* s)
+{
+  delete s;
+}
+
+void qio_regexp_set_create(const qio_regexp_options_t* options, qio_regexp_set_t* set)
+{
+  RE2::Options opts;
+  qio_re_options_to_re2_options(options, &opts);
+  // Errors are returned by qio_regexp_set_add instead.
+  opts.set_log_errors(false);
+  set->set = (void*) new re_set_t(opts);
+}
+
+int64_t qio_regexp_set_add(qio_regexp_set_t* set, const char* str, int64_t str_len, const char** error_out)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  StringPiece strp(str, str_len);
+  string error;
+  int idx;
+
+  *error_out = NULL;
+  if( s->compiled ) {
+    *error_out = qio_strdup("pattern added after set was compiled");
+    return -1;
+  }
+
+  idx = s->set.Add(strp, &error);
+  if( idx < 0 ) {
+    *error_out = qio_strdup(error.c_str());
+    return -1;
+  }
+  s->size++;
+  return idx;
+}
+
+qio_bool qio_regexp_set_compile(qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+
+  if( ! s->compiled ) {
+    // An empty set matches nothing and needs no program.
+    if( s->size > 0 && ! s->set.Compile() ) return false;
+    s->compiled = true;
+  }
+  return true;
+}
+
+void qio_regexp_set_retain(const qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  DO_RETAIN(s);
+}
+
+void qio_regexp_set_release(qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  DO_RELEASE(s, re_set_free);
+  set->set = NULL;
+}
+
+int64_t qio_regexp_set_size(const qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  return s ? s->size : 0;
+}
+
+static
+int64_t re_set_match(const re_set_t* s, const StringPiece& text, std::vector<int>* found, int64_t* matched, int64_t nmatched)
+{
+  found->clear();
+  if( s->size == 0 || ! s->compiled ) return 0;
+  if( ! s->set.Match(text, found) ) return 0;
+
+  std::sort(found->begin(), found->end());
+  for( size_t i = 0; i < found->size() && (int64_t) i < nmatched; i++ ) {
+    matched[i] = (*found)[i];
+  }
+  return found->size();
+}
+
+int64_t qio_regexp_set_match(const qio_regexp_set_t* set, const char* text, int64_t text_len, int64_t* matched, int64_t nmatched)
+{
+  std::vector<int> found;
+  StringPiece textp(text, text_len);
+  return re_set_match((const re_set_t*) set->set, textp, &found, matched, nmatched);
+}
+
+qioerr qio_regexp_set_channel_match(const qio_regexp_set_t* set, const int threadsafe, struct qio_channel_s* ch, qio_regexp_string_piece_t* line, int64_t* matched, int64_t nmatched, int64_t* nfound_out)
+{
+  const re_set_t* s = (const re_set_t*) set->set;
+  std::vector<int> found;
+  std::string pending;
+  qioerr err = 0;
+  int64_t line_start;
+  int64_t nfound = 0;
+  bool at_eof = false;
+
+  line->offset = -1;
+  line->len = 0;
+  *nfound_out = 0;
+
+  if( threadsafe ) {
+    err = qio_lock(&ch->lock);
+    if( err ) {
+      return err;
+    }
+  }
+
+  // Look at one line at a time until some pattern matches.  A line that
+  // is all in the channel's buffer is matched where it is; one that
+  // spans buffers is collected in 'pending' first.
+  while( ! at_eof && nfound == 0 ) {
+    StringPiece text;
+    void* advance_to = NULL;
+    bool have_line = false;
+
+    line_start = qio_channel_offset_unlocked(ch);
+    pending.clear();
+
+    while( ! have_line ) {
+      void* bufstart = NULL;
+      void* bufend = NULL;
+
+      err = qio_channel_require_read(false, ch, 1);
+      if( qio_err_to_int(err) == EEOF ) {
+        err = 0;
+        at_eof = true;
+        break;
+      }
+      if( err ) goto done;
+
+      err = qio_channel_begin_peek_cached(false, ch, &bufstart, &bufend);
+      if( err ) goto done;
+
+      int64_t avail = qio_ptr_diff(bufend, bufstart);
+      if( avail <= 0 ) {
+        // Nothing cached (e.g. an unbuffered channel); go byte by byte.
+        int32_t got = qio_channel_read_byte(false, ch);
+        if( got < 0 ) {
+          err = qio_channel_error(ch);
+          if( qio_err_to_int(err) == EEOF ) {
+            err = 0;
+            at_eof = true;
+            break;
+          }
+          goto done;
+        }
+        if( got == '\n' ) {
+          text.set(pending.data(), pending.size());
+          have_line = true;
+        } else {
+          pending.push_back((char) got);
+        }
+        continue;
+      }
+
+      const char* start = (const char*) bufstart;
+      const char* nl = (const char*) memchr(start, '\n', avail);
+      if( ! nl ) {
+        // The line continues past what is buffered.
+        pending.append(start, avail);
+        qio_channel_end_peek_cached(false, ch, bufend);
+        continue;
+      }
+
+      if( pending.empty() ) {
+        text.set(start, nl - start);
+      } else {
+        pending.append(start, nl - start);
+        text.set(pending.data(), pending.size());
+      }
+      advance_to = (void*) (nl + 1);
+      have_line = true;
+    }
+
+    // The last line need not end in a newline.
+    if( ! have_line ) {
+      if( pending.empty() ) break;
+      text.set(pending.data(), pending.size());
+    }
+
+    nfound = re_set_match(s, text, &found, matched, nmatched);
+    if( nfound > 0 ) {
+      line->offset = line_start;
+      line->len = text.size();
+    }
+
+    // Move past the line and its newline.
+    if( advance_to ) qio_channel_end_peek_cached(false, ch, advance_to);
+  }
+
+done:
+  if( qio_err_to_int(err) == EEOF ) err = 0;
+  if( ! err && nfound == 0 ) QIO_GET_CONSTANT_ERROR(err, EEOF, "no more matching lines");
+
+  if( threadsafe ) {
+    qio_unlock(&ch->lock);
+  }
+
+  *nfound_out = nfound;
+  return err;
+}
+
 int qio_regexp_channel_read_byte(qio_channel_s* ch);
 void qio_regexp_channel_discard(qio_channel_s* ch, int64_t cur, int64_t min);
 
@@ -24,7 +24,9 @@
 #include "chplrt.h"
 #include "chpl_rt_utils_static.h"
 #include "chplcgfns.h"
+#include "chpl-atomics.h"
 #include "chpl-comm.h"
+#include "chpl-env.h"
 #include "chplexit.h"
 #include "chpl-locale-model.h"
 #include "chpl-mem.h"
@@ -66,9 +68,26 @@ typedef struct task_pool_struct {
   task_pool_p      list_prev;
   task_pool_p      next;         // double-link pointers for pool
   task_pool_p      prev;
+  task_pool_p*     ws_list;      // task list, if on a work-stealing deque
+  int64_t          ws_index;     // where on the deque it was pushed
 } task_pool_t;
 
 
+//
+// Work-stealing deque (Chase-Lev).  The owning thread pushes and pops
+// at the bottom; other threads steal from the top.  The buffer has a
+// fixed power-of-2 capacity so that a thief reading a slot can never
+// see it recycled before its CAS on 'top' succeeds or fails.  When
+// the deque is full, new tasks overflow to the global task pool.
+//
+typedef struct {
+  atomic_int_least64_t     top;
+  atomic_int_least64_t     bottom;
+  int64_t                  mask;
+  volatile task_pool_p*    tasks;
+} ws_deque_t;
+
+
 //
 // This is a descriptor for movedTaskWrapper().
 //
@@ -93,6 +112,10 @@ typedef struct lockReport {
 typedef struct {
   task_pool_p   ptask;
   lockReport_t* lockRprt;
+  ws_deque_t*   deque;                // work-stealing deque, if any
+  uint64_t      ws_rand;              // victim selection state
+  task_pool_p*  ws_run_list;          // list of the latest run of pushes
+  int64_t       ws_run_start;         // deque index where that run began
 } thread_private_data_t;
 
 
@@ -102,7 +125,6 @@ static volatile chpl_bool canCountRunningTasks = false;
 
 static chpl_thread_mutex_t threading_lock;     // critical section lock
 static chpl_thread_mutex_t extra_task_lock;    // critical section lock
-static chpl_thread_mutex_t task_id_lock;       // critical section lock
 static chpl_thread_mutex_t task_list_lock;     // critical section lock
 static volatile task_pool_p
                            task_pool_head;     // head of task pool
@@ -110,13 +132,17 @@ static volatile task_pool_p
                            task_pool_tail;     // tail of task pool
 
 static int                 queued_task_cnt;    // number of tasks in task pool
-static int                 running_task_cnt;   // number of running tasks
+static atomic_int_least32_t
+                           running_task_cnt;   // number of running tasks
 static int64_t             extra_task_cnt;     // number of tasks being run by
                                                //   threads occupied already
 static int                 blocked_thread_cnt; // number of threads that
                                                //   cannot make progress
-static int                 idle_thread_cnt;    // number of threads looking
+static atomic_int_least32_t
+                           idle_thread_cnt;    // number of threads looking
                                                //   for work
+static atomic_uint_least64_t
+                           next_task_id;       // next task identifier
 static uint64_t            progress_cnt;       // number of unblock operations,
                                                //   as a proxy for progress
 
@@ -129,6 +155,23 @@ static chpl_thread_mutex_t taskTable_lock;     // critical section lock
 
 static chpl_fn_p comm_task_fn;
 
+//
+// Work-stealing mode.  When enabled (CHPL_RT_TASKS_WORK_STEALING), each
+// thread that spawns tasks pushes them onto its own deque instead of
+// the global task pool, and idle threads steal from random victims.
+// The global pool remains as the injection queue for threads without a
+// deque (the comm thread, or threads beyond ws_max_deques) and for
+// deque overflow.
+//
+static chpl_bool           ws_enabled = false;
+static int64_t             ws_deque_size;      // capacity of each deque
+static int32_t             ws_max_deques;      // size of ws_deques[]
+static ws_deque_t**        ws_deques;          // all registered deques
+static atomic_int_least32_t
+                           ws_num_deques;      // number registered
+static atomic_int_least64_t
+                           ws_queued_task_cnt; // number of tasks in deques
+
 //
 // Internal functions.
 //
@@ -154,6 +197,23 @@ static task_pool_p             add_to_task_pool(chpl_fn_p, void*, chpl_bool,
                                                 chpl_task_prvDataImpl_t,
                                                 task_pool_p*, chpl_bool,
                                                 int, int32_t);
+static task_pool_p             new_ptask(chpl_fn_p, void*, chpl_bool,
+                                         chpl_task_prvDataImpl_t,
+                                         int, int32_t);
+static void                    announce_new_ptask(task_pool_p);
+static chpl_bool               task_pool_nonempty(void);
+static void                    run_child_task(task_pool_p, task_pool_p);
+static void                    ws_init(void);
+static void                    ws_exit(void);
+static void                    ws_register_thread(thread_private_data_t*);
+static chpl_bool               ws_add_task(chpl_fn_p, void*, chpl_bool,
+                                           chpl_task_prvDataImpl_t,
+                                           task_pool_p*, chpl_bool,
+                                           int, int32_t);
+static task_pool_p             ws_find_task(thread_private_data_t*);
+static void                    ws_execute_list_tasks(thread_private_data_t*,
+                                                     task_pool_p*);
+static void                    ws_report_pending_tasks(void);
 
 //
 // Condition variable methods
@@ -320,17 +380,28 @@ void chpl_sync_destroyAux(chpl_sync_aux_t *s) {
 void chpl_task_init(void) {
   chpl_thread_mutexInit(&threading_lock);
   chpl_thread_mutexInit(&extra_task_lock);
-  chpl_thread_mutexInit(&task_id_lock);
   chpl_thread_mutexInit(&task_list_lock);
   queued_task_cnt = 0;
-  running_task_cnt = 1;                     // only main task running
+  atomic_init_int_least32_t(&running_task_cnt, 1); // only main task running
   blocked_thread_cnt = 0;
-  idle_thread_cnt = 0;
+  atomic_init_int_least32_t(&idle_thread_cnt, 0);
+  atomic_init_uint_least64_t(&next_task_id, chpl_nullTaskID + 1);
   extra_task_cnt = 0;
   task_pool_head = task_pool_tail = NULL;
 
   chpl_thread_init(thread_begin, thread_end);
 
+  //
+  // This needs the threading layer's idea of the thread limit.
+  //
+  ws_init();
+
+  //
+  // We release each task's arena when the task ends, so we can offer
+  // task arenas.
+  //
+  chpl_mem_taskArenaInit();
+
   //
   // Set main thread private data, so that things that require access
   // to it, like chpl_task_getID() and chpl_task_setSerial(), can be
@@ -359,12 +430,17 @@ void chpl_task_init(void) {
     tp->ptask->lineno       = 0;
     tp->ptask->p_list_head  = NULL;
     tp->ptask->next         = NULL;
+    tp->ptask->ws_list      = NULL;
     tp->lockRprt            = NULL;
+    tp->deque               = NULL;
 
     // Set up task-private data for locale (architectural) support.
+    tp->ptask->chpl_data = (chpl_task_prvDataImpl_t) { .prvdata = { 0 } };
     tp->ptask->chpl_data.prvdata.serial_state = true;     // Set to false in chpl_task_callMain().
 
     chpl_thread_setPrivateData(tp);
+
+    ws_register_thread(tp);
   }
 
   if (blockreport) {
@@ -386,6 +462,8 @@ void chpl_task_exit(void) {
     return;
 
   chpl_thread_exit();
+
+  ws_exit();
 }
 
 
@@ -456,14 +534,22 @@ static void comm_task_wrapper(void* arg) {
   tp->ptask->lineno       = 0;
   tp->ptask->p_list_head  = NULL;
   tp->ptask->next         = NULL;
+  tp->ptask->ws_list      = NULL;
 
   //
   // The comm (polling) task shouldn't really need this information.
   //
+  tp->ptask->chpl_data = (chpl_task_prvDataImpl_t) { .prvdata = { 0 } };
   tp->ptask->chpl_data.prvdata.serial_state = true;
 
   tp->lockRprt = NULL;
 
+  //
+  // The comm thread doesn't get a work-stealing deque.  Anything it
+  // spawns goes into the global task pool.
+  //
+  tp->deque = NULL;
+
   chpl_thread_setPrivateData(tp);
 
   (*comm_task_fn)(arg);
@@ -558,6 +644,23 @@ void chpl_task_addToTaskList(chpl_fn_int_t fid, void* arg,
     return;
   }
 
+  if (ws_enabled) {
+    chpl_bool added;
+
+    //
+    // See below for why a remote task list implies a begin statement.
+    //
+    if (task_list_locale == chpl_nodeID)
+      added = ws_add_task(chpl_ftable[fid], arg, false, chpl_data,
+                          (task_pool_p*) p_task_list_void, is_begin_stmt,
+                          lineno, filename);
+    else
+      added = ws_add_task(chpl_ftable[fid], arg, false, chpl_data,
+                          NULL, true, 0, CHPL_FILE_IDX_UNKNOWN);
+    if (added)
+      return;
+  }
+
   // begin critical section
   chpl_thread_mutexLock(&threading_lock);
 
@@ -596,6 +699,14 @@ void chpl_task_executeTasksInList(void** p_task_list_void) {
 
   curr_ptask = get_current_ptask();
 
+  //
+  // In work-stealing mode most of the list's tasks are on our own
+  // deque rather than linked into the list.  Run those first; only
+  // tasks that overflowed into the global pool remain in the list.
+  //
+  if (ws_enabled)
+    ws_execute_list_tasks(get_thread_private_data(), p_task_list_head);
+
   while (*p_task_list_head != NULL) {
     chpl_fn_p task_to_run_fun = NULL;
 
@@ -613,59 +724,68 @@ void chpl_task_executeTasksInList(void** p_task_list_void) {
     if (task_to_run_fun == NULL)
       continue;
 
-    set_current_ptask(child_ptask);
+    run_child_task(curr_ptask, child_ptask);
+  }
+}
 
-    // begin critical section
-    chpl_thread_mutexLock(&extra_task_lock);
 
-    extra_task_cnt++;
+//
+// Run a task from a task list on the calling thread, on behalf of the
+// parent task currently running there.
+//
+static void run_child_task(task_pool_p curr_ptask, task_pool_p child_ptask) {
+  set_current_ptask(child_ptask);
 
-    // end critical section
-    chpl_thread_mutexUnlock(&extra_task_lock);
+  // begin critical section
+  chpl_thread_mutexLock(&extra_task_lock);
 
-    if (do_taskReport) {
-      chpl_thread_mutexLock(&taskTable_lock);
-      chpldev_taskTable_set_suspended(curr_ptask->id);
-      chpldev_taskTable_set_active(child_ptask->id);
-      chpl_thread_mutexUnlock(&taskTable_lock);
-    }
+  extra_task_cnt++;
 
-    if (blockreport)
-      initializeLockReportForThread();
+  // end critical section
+  chpl_thread_mutexUnlock(&extra_task_lock);
 
-    chpl_task_do_callbacks(chpl_task_cb_event_kind_begin,
-                           child_ptask->filename,
-                           child_ptask->lineno,
-                           child_ptask->id,
-                           child_ptask->is_executeOn);
+  if (do_taskReport) {
+    chpl_thread_mutexLock(&taskTable_lock);
+    chpldev_taskTable_set_suspended(curr_ptask->id);
+    chpldev_taskTable_set_active(child_ptask->id);
+    chpl_thread_mutexUnlock(&taskTable_lock);
+  }
 
-    (*task_to_run_fun)(child_ptask->arg);
+  if (blockreport)
+    initializeLockReportForThread();
 
-    chpl_task_do_callbacks(chpl_task_cb_event_kind_end,
-                           child_ptask->filename,
-                           child_ptask->lineno,
-                           child_ptask->id,
-                           child_ptask->is_executeOn);
+  chpl_task_do_callbacks(chpl_task_cb_event_kind_begin,
+                         child_ptask->filename,
+                         child_ptask->lineno,
+                         child_ptask->id,
+                         child_ptask->is_executeOn);
 
-    if (do_taskReport) {
-      chpl_thread_mutexLock(&taskTable_lock);
-      chpldev_taskTable_set_active(curr_ptask->id);
-      chpldev_taskTable_remove(child_ptask->id);
-      chpl_thread_mutexUnlock(&taskTable_lock);
-    }
+  (*child_ptask->fun)(child_ptask->arg);
 
-    // begin critical section
-    chpl_thread_mutexLock(&extra_task_lock);
+  chpl_task_do_callbacks(chpl_task_cb_event_kind_end,
+                         child_ptask->filename,
+                         child_ptask->lineno,
+                         child_ptask->id,
+                         child_ptask->is_executeOn);
 
-    extra_task_cnt--;
+  if (do_taskReport) {
+    chpl_thread_mutexLock(&taskTable_lock);
+    chpldev_taskTable_set_active(curr_ptask->id);
+    chpldev_taskTable_remove(child_ptask->id);
+    chpl_thread_mutexUnlock(&taskTable_lock);
+  }
 
-    // end critical section
-    chpl_thread_mutexUnlock(&extra_task_lock);
+  // begin critical section
+  chpl_thread_mutexLock(&extra_task_lock);
 
-    set_current_ptask(curr_ptask);
-    chpl_mem_free(child_ptask, 0, 0);
+  extra_task_cnt--;
 
-  }
+  // end critical section
+  chpl_thread_mutexUnlock(&extra_task_lock);
+
+  set_current_ptask(curr_ptask);
+  chpl_mem_taskArenaRelease(&child_ptask->chpl_data.prvdata.mem_arena);
+  chpl_mem_free(child_ptask, 0, 0);
 }
 
 
@@ -689,6 +809,11 @@ void chpl_task_startMovedTask(chpl_fn_p fp,
            { fp, a, canCountRunningTasks,
              private };
 
+  if (ws_enabled
+      && ws_add_task(movedTaskWrapper, pmtwd, true, pmtwd->chpl_data,
+                     NULL, false, 0, CHPL_FILE_IDX_UNKNOWN))
+    return;
+
   // begin critical section
   chpl_thread_mutexLock(&threading_lock);
 
@@ -798,7 +923,12 @@ size_t chpl_task_getCallStackSize(void) {
   return chpl_thread_getCallStackSize();
 }
 
-uint32_t chpl_task_getNumQueuedTasks(void) { return queued_task_cnt; }
+uint32_t chpl_task_getNumQueuedTasks(void) {
+  if (ws_enabled)
+    return queued_task_cnt
+           + (uint32_t) atomic_load_int_least64_t(&ws_queued_task_cnt);
+  return queued_task_cnt;
+}
 
 uint32_t chpl_task_getNumRunningTasks(void) {
   chpl_internal_error("chpl_task_getNumRunningTasks() called");
@@ -813,7 +943,8 @@ int32_t  chpl_task_getNumBlockedTasks(void) {
     chpl_thread_mutexLock(&threading_lock);
     chpl_thread_mutexLock(&block_report_lock);
 
-    numBlockedTasks = blocked_thread_cnt - idle_thread_cnt;
+    numBlockedTasks = blocked_thread_cnt
+                      - atomic_load_int_least32_t(&idle_thread_cnt);
 
     // end critical section
     chpl_thread_mutexUnlock(&block_report_lock);
@@ -833,15 +964,7 @@ int32_t  chpl_task_getNumBlockedTasks(void) {
 // Get a new task ID.
 //
 static chpl_taskID_t get_next_task_id(void) {
-  static chpl_taskID_t       id = chpl_nullTaskID + 1;
-
-  chpl_taskID_t              next_id;
-
-  chpl_thread_mutexLock(&task_id_lock);
-  next_id = id++;
-  chpl_thread_mutexUnlock(&task_id_lock);
-
-  return next_id;
+  return atomic_fetch_add_uint_least64_t(&next_task_id, 1);
 }
 
 
@@ -919,6 +1042,8 @@ static void report_all_tasks(void) {
            (int)pendingTask->lineno);
     pendingTask = pendingTask->next;
   }
+  if (ws_enabled)
+    ws_report_pending_tasks();
   printf("\n");
 
   // print out running tasks
@@ -1082,6 +1207,9 @@ thread_begin(void* ptask_void) {
   if (blockreport)
     initializeLockReportForThread();
 
+  tp->deque = NULL;
+  ws_register_thread(tp);
+
   while (true) {
     //
     // wait for a task to be present in the task pool
@@ -1097,7 +1225,7 @@ thread_begin(void* ptask_void) {
     // that were waiting on the signal, but since there was a performance
     // impact from keeping it as a hybrid as opposed to merely yielding,
     // it was decided that we would return to the simple yield case.
-    while (!task_pool_head) {
+    while (!task_pool_nonempty()) {
       if (set_block_loc(0, CHPL_FILE_IDX_IDLE_TASK)) {
         // all other tasks appear to be blocked
         struct timeval deadline, now;
@@ -1105,56 +1233,73 @@ thread_begin(void* ptask_void) {
         deadline.tv_sec += 1;
         do {
           chpl_thread_yield();
-          if (!task_pool_head)
+          if (!task_pool_nonempty())
             gettimeofday(&now, NULL);
-        } while (!task_pool_head
+        } while (!task_pool_nonempty()
                  && (now.tv_sec < deadline.tv_sec
                      || (now.tv_sec == deadline.tv_sec
                          && now.tv_usec < deadline.tv_usec)));
-        if (!task_pool_head) {
+        if (!task_pool_nonempty()) {
           check_for_deadlock();
         }
       }
       else {
         do {
           chpl_thread_yield();
-        } while (!task_pool_head);
+        } while (!task_pool_nonempty());
       }
 
       unset_block_loc();
     }
  
-    //
-    // Just now the pool had at least one task in it.  Lock and see if
-    // there's something still there.
-    //
-    chpl_thread_mutexLock(&threading_lock);
-    if (!task_pool_head) {
-      chpl_thread_mutexUnlock(&threading_lock);
-      continue;
+    if (ws_enabled) {
+      //
+      // Look on our own deque, then steal, then check the global pool.
+      // This doesn't touch threading_lock unless the global pool is
+      // nonempty.
+      //
+      if ((ptask = ws_find_task(tp)) == NULL)
+        continue;
+
+      if (blockreport)
+        progress_cnt++;
+
+      (void) atomic_fetch_sub_int_least32_t(&idle_thread_cnt, 1);
+      (void) atomic_fetch_add_int_least32_t(&running_task_cnt, 1);
     }
+    else {
+      //
+      // Just now the pool had at least one task in it.  Lock and see if
+      // there's something still there.
+      //
+      chpl_thread_mutexLock(&threading_lock);
+      if (!task_pool_head) {
+        chpl_thread_mutexUnlock(&threading_lock);
+        continue;
+      }
 
-    //
-    // We've found a task to run.
-    //
+      //
+      // We've found a task to run.
+      //
 
-    if (blockreport)
-      progress_cnt++;
+      if (blockreport)
+        progress_cnt++;
 
-    //
-    // start new task; increment running count and remove task from pool
-    // also add to task to task-table (structure in ChapelRuntime that keeps
-    // track of currently running tasks for task-reports on deadlock or
-    // Ctrl+C).
-    //
-    ptask = task_pool_head;
-    idle_thread_cnt--;
-    running_task_cnt++;
+      //
+      // start new task; increment running count and remove task from pool
+      // also add to task to task-table (structure in ChapelRuntime that
+      // keeps track of currently running tasks for task-reports on
+      // deadlock or Ctrl+C).
+      //
+      ptask = task_pool_head;
+      (void) atomic_fetch_sub_int_least32_t(&idle_thread_cnt, 1);
+      (void) atomic_fetch_add_int_least32_t(&running_task_cnt, 1);
 
-    dequeue_task(ptask);
+      dequeue_task(ptask);
 
-    // end critical section
-    chpl_thread_mutexUnlock(&threading_lock);
+      // end critical section
+      chpl_thread_mutexUnlock(&threading_lock);
+    }
 
     tp->ptask = ptask;
 
@@ -1185,20 +1330,15 @@ thread_begin(void* ptask_void) {
     }
 
     tp->ptask = NULL;
+    chpl_mem_taskArenaRelease(&ptask->chpl_data.prvdata.mem_arena);
     chpl_mem_free(ptask, 0, 0);
 
-    // begin critical section
-    chpl_thread_mutexLock(&threading_lock);
-
     //
     // finished task; decrement running count and increment idle count
     //
-    assert(running_task_cnt > 0);
-    running_task_cnt--;
-    idle_thread_cnt++;
-
-    // end critical section
-    chpl_thread_mutexUnlock(&threading_lock);
+    assert(atomic_load_int_least32_t(&running_task_cnt) > 0);
+    (void) atomic_fetch_sub_int_least32_t(&running_task_cnt, 1);
+    (void) atomic_fetch_add_int_least32_t(&idle_thread_cnt, 1);
   }
 }
 
@@ -1230,7 +1370,7 @@ static void maybe_add_thread(void) {
 
   if (!warning_issued && chpl_thread_canCreate()) {
     if (chpl_thread_create(NULL) == 0) {
-      idle_thread_cnt++;
+      (void) atomic_fetch_add_int_least32_t(&idle_thread_cnt, 1);
     }
     else {
       int32_t max_threads = chpl_thread_getMaxThreads();
@@ -1253,17 +1393,13 @@ static void maybe_add_thread(void) {
 }
 
 
-// create a task from the given function pointer and arguments
-// and append it to the end of the task pool
-// assumes threading_lock has already been acquired!
+// create a task descriptor from the given function pointer and arguments
 static inline
-task_pool_p add_to_task_pool(chpl_fn_p fp,
-                             void* a,
-                             chpl_bool is_executeOn,
-                             chpl_task_prvDataImpl_t chpl_data,
-                             task_pool_p* p_task_list_head,
-                             chpl_bool is_begin_stmt,
-                             int lineno, int32_t filename) {
+task_pool_p new_ptask(chpl_fn_p fp,
+                      void* a,
+                      chpl_bool is_executeOn,
+                      chpl_task_prvDataImpl_t chpl_data,
+                      int lineno, int32_t filename) {
   task_pool_p ptask =
     (task_pool_p) chpl_mem_alloc(sizeof(task_pool_t),
                                         CHPL_RT_MD_TASK_POOL_DESC,
@@ -1277,9 +1413,16 @@ task_pool_p add_to_task_pool(chpl_fn_p fp,
   ptask->lineno       = lineno;
   ptask->p_list_head  = NULL;
   ptask->next         = NULL;
+  ptask->ws_list      = NULL;
+
+  return ptask;
+}
 
-  enqueue_task(ptask, p_task_list_head);
 
+// do the task creation callbacks and task table registration for a
+// new task, before any thread can start it
+static inline
+void announce_new_ptask(task_pool_p ptask) {
   chpl_task_do_callbacks(chpl_task_cb_event_kind_create,
                          ptask->filename,
                          ptask->lineno,
@@ -1293,6 +1436,26 @@ task_pool_p add_to_task_pool(chpl_fn_p fp,
                           (uint64_t) (intptr_t) ptask);
     chpl_thread_mutexUnlock(&taskTable_lock);
   }
+}
+
+
+// create a task from the given function pointer and arguments
+// and append it to the end of the task pool
+// assumes threading_lock has already been acquired!
+static inline
+task_pool_p add_to_task_pool(chpl_fn_p fp,
+                             void* a,
+                             chpl_bool is_executeOn,
+                             chpl_task_prvDataImpl_t chpl_data,
+                             task_pool_p* p_task_list_head,
+                             chpl_bool is_begin_stmt,
+                             int lineno, int32_t filename) {
+  task_pool_p ptask = new_ptask(fp, a, is_executeOn, chpl_data,
+                                lineno, filename);
+
+  enqueue_task(ptask, p_task_list_head);
+
+  announce_new_ptask(ptask);
 
   //
   // If we now have more tasks than threads to run them on (taking
@@ -1300,7 +1463,8 @@ task_pool_p add_to_task_pool(chpl_fn_p fp,
   // construct can run at least one of that construct's children),
   // try to start another thread.
   //
-  if (queued_task_cnt > idle_thread_cnt &&
+  if (chpl_task_getNumQueuedTasks()
+      > atomic_load_int_least32_t(&idle_thread_cnt) &&
       (p_task_list_head == NULL || ptask->list_next != NULL || is_begin_stmt)) {
     maybe_add_thread();
   }
@@ -1309,6 +1473,386 @@ task_pool_p add_to_task_pool(chpl_fn_p fp,
 }
 
 
+//
+// Is there anything in the task pool, or (in work-stealing mode) in
+// any deque?  This is only a hint; the caller must still try to get
+// a task and cope with not finding one.
+//
+static inline
+chpl_bool task_pool_nonempty(void) {
+  return (task_pool_head != NULL
+          || (ws_enabled
+              && atomic_load_int_least64_t(&ws_queued_task_cnt) > 0));
+}
+
+
+// Work stealing
+
+static void ws_init(void) {
+  int32_t maxThreads;
+
+  atomic_init_int_least32_t(&ws_num_deques, 0);
+  atomic_init_int_least64_t(&ws_queued_task_cnt, 0);
+
+  if (!chpl_get_rt_env_bool("TASKS_WORK_STEALING", false))
+    return;
+
+  //
+  // With only one thread there is nobody to steal, and executing the
+  // tasks in a task list must not depend on a thief showing up.
+  //
+  maxThreads = chpl_thread_getMaxThreads();
+  if (maxThreads == 1)
+    return;
+
+  ws_deque_size = chpl_get_rt_env_int("TASKS_DEQUE_SIZE", 1024);
+  if (ws_deque_size < 2) {
+    chpl_warning("CHPL_RT_TASKS_DEQUE_SIZE must be >= 2; using 2", 0, 0);
+    ws_deque_size = 2;
+  }
+  while ((ws_deque_size & (ws_deque_size - 1)) != 0)
+    ws_deque_size += ws_deque_size & -ws_deque_size;
+
+  //
+  // One deque per thread we can create, plus the main thread.  If the
+  // thread count is unbounded we guess; threads created beyond this
+  // still steal, but what they spawn goes into the global pool.
+  //
+  if (maxThreads > 0)
+    ws_max_deques = maxThreads + 1;
+  else
+    ws_max_deques = 4 * chpl_getNumLogicalCpus(true) + 1;
+
+  ws_deques = (ws_deque_t**) chpl_mem_calloc(ws_max_deques,
+                                             sizeof(ws_deques[0]),
+                                             CHPL_RT_MD_TASK_POOL_DESC,
+                                             0, 0);
+  ws_enabled = true;
+}
+
+
+static void ws_exit(void) {
+  int32_t i, n;
+
+  if (!ws_enabled)
+    return;
+
+  //
+  // The threads have all been shut down by now, so nobody can be
+  // pushing, popping, or stealing.
+  //
+  n = atomic_load_int_least32_t(&ws_num_deques);
+  if (n > ws_max_deques)
+    n = ws_max_deques;
+  for (i = 0; i < n; i++) {
+    if (ws_deques[i] != NULL) {
+      chpl_mem_free((void*) ws_deques[i]->tasks, 0, 0);
+      chpl_mem_free(ws_deques[i], 0, 0);
+    }
+  }
+  chpl_mem_free(ws_deques, 0, 0);
+  ws_enabled = false;
+}
+
+
+//
+// Give the calling thread a deque, if there are any left.
+//
+static void ws_register_thread(thread_private_data_t* tp) {
+  ws_deque_t* dq;
+  int32_t idx;
+
+  if (!ws_enabled)
+    return;
+
+  idx = atomic_fetch_add_int_least32_t(&ws_num_deques, 1);
+  tp->ws_rand = 0x9e3779b97f4a7c15ULL * (uint64_t) (idx + 1);
+  tp->ws_run_list = NULL;
+  if (idx >= ws_max_deques)
+    return;
+
+  dq = (ws_deque_t*) chpl_mem_alloc(sizeof(*dq),
+                                    CHPL_RT_MD_TASK_POOL_DESC, 0, 0);
+  atomic_init_int_least64_t(&dq->top, 0);
+  atomic_init_int_least64_t(&dq->bottom, 0);
+  dq->mask = ws_deque_size - 1;
+  dq->tasks = (volatile task_pool_p*)
+              chpl_mem_calloc(ws_deque_size, sizeof(dq->tasks[0]),
+                              CHPL_RT_MD_TASK_POOL_DESC, 0, 0);
+
+  tp->deque = dq;
+
+  //
+  // Publish the deque only once it is fully set up.
+  //
+  atomic_thread_fence(memory_order_release);
+  ws_deques[idx] = dq;
+}
+
+
+//
+// Push a task on the bottom of our own deque.  Only the owning thread
+// may call this.  Returns false if the deque is full.
+//
+static inline
+chpl_bool ws_push(ws_deque_t* dq, task_pool_p ptask) {
+  int64_t b = atomic_load_explicit_int_least64_t(&dq->bottom,
+                                                 memory_order_relaxed);
+  int64_t t = atomic_load_explicit_int_least64_t(&dq->top,
+                                                 memory_order_acquire);
+
+  if (b - t > dq->mask)
+    return false;
+
+  ptask->ws_index = b;
+  dq->tasks[b & dq->mask] = ptask;
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit_int_least64_t(&dq->bottom, b + 1,
+                                      memory_order_relaxed);
+  (void) atomic_fetch_add_int_least64_t(&ws_queued_task_cnt, 1);
+  return true;
+}
+
+
+//
+// Pop a task from the bottom of our own deque.  Only the owning thread
+// may call this.  Returns NULL if the deque is empty or a thief won
+// the race for the last task.
+//
+static inline
+task_pool_p ws_pop(ws_deque_t* dq) {
+  int64_t b, t;
+  task_pool_p ptask;
+
+  b = atomic_load_explicit_int_least64_t(&dq->bottom,
+                                         memory_order_relaxed) - 1;
+  atomic_store_explicit_int_least64_t(&dq->bottom, b, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  t = atomic_load_explicit_int_least64_t(&dq->top, memory_order_relaxed);
+
+  if (t > b) {
+    // empty
+    atomic_store_explicit_int_least64_t(&dq->bottom, b + 1,
+                                        memory_order_relaxed);
+    return NULL;
+  }
+
+  ptask = dq->tasks[b & dq->mask];
+  if (t == b) {
+    // last one; race against thieves for it
+    if (!atomic_compare_exchange_strong_explicit_int_least64_t(
+           &dq->top, t, t + 1, memory_order_seq_cst))
+      ptask = NULL;
+    atomic_store_explicit_int_least64_t(&dq->bottom, b + 1,
+                                        memory_order_relaxed);
+  }
+
+  if (ptask != NULL)
+    (void) atomic_fetch_sub_int_least64_t(&ws_queued_task_cnt, 1);
+  return ptask;
+}
+
+
+//
+// Steal a task from the top of someone else's deque.  Returns NULL if
+// the deque is empty or we lost a race.
+//
+static inline
+task_pool_p ws_steal(ws_deque_t* dq) {
+  int64_t t, b;
+  task_pool_p ptask;
+
+  t = atomic_load_explicit_int_least64_t(&dq->top, memory_order_acquire);
+  atomic_thread_fence(memory_order_seq_cst);
+  b = atomic_load_explicit_int_least64_t(&dq->bottom, memory_order_acquire);
+
+  if (t >= b)
+    return NULL;
+
+  ptask = dq->tasks[t & dq->mask];
+  if (!atomic_compare_exchange_strong_explicit_int_least64_t(
+         &dq->top, t, t + 1, memory_order_seq_cst))
+    return NULL;
+
+  (void) atomic_fetch_sub_int_least64_t(&ws_queued_task_cnt, 1);
+  return ptask;
+}
+
+
+//
+// Create a task and push it onto the calling thread's deque.  Returns
+// false, having done nothing, if the thread has no deque or it is
+// full; the caller should then fall back to the global task pool.
+//
+static chpl_bool ws_add_task(chpl_fn_p fp,
+                             void* a,
+                             chpl_bool is_executeOn,
+                             chpl_task_prvDataImpl_t chpl_data,
+                             task_pool_p* p_task_list_head,
+                             chpl_bool is_begin_stmt,
+                             int lineno, int32_t filename) {
+  thread_private_data_t* tp = get_thread_private_data();
+  ws_deque_t* dq = tp->deque;
+  task_pool_p ptask;
+  int64_t t, b;
+
+  if (dq == NULL)
+    return false;
+
+  t = atomic_load_int_least64_t(&dq->top);
+  b = atomic_load_int_least64_t(&dq->bottom);
+  if (b - t > dq->mask)
+    return false;
+
+  ptask = new_ptask(fp, a, is_executeOn, chpl_data, lineno, filename);
+  ptask->ws_list = p_task_list_head;
+
+  //
+  // Once pushed the task can be stolen and started immediately, so
+  // it has to be announced first.
+  //
+  announce_new_ptask(ptask);
+
+  if (!ws_push(dq, ptask))
+    chpl_internal_error("work-stealing deque overflowed");
+
+  //
+  // Remember where a run of pushes for one task list begins, so that
+  // ws_execute_list_tasks() knows which tasks were pushed after it.
+  //
+  if (p_task_list_head == NULL || tp->ws_run_list != p_task_list_head) {
+    tp->ws_run_list = p_task_list_head;
+    tp->ws_run_start = ptask->ws_index;
+  }
+
+  //
+  // If we now have more tasks than idle threads to run them, try to
+  // start another thread.  Only take the lock if that might succeed.
+  //
+  if (chpl_task_getNumQueuedTasks()
+      > atomic_load_int_least32_t(&idle_thread_cnt)
+      && chpl_thread_canCreate()) {
+    chpl_thread_mutexLock(&threading_lock);
+    maybe_add_thread();
+    chpl_thread_mutexUnlock(&threading_lock);
+  }
+
+  return true;
+}
+
+
+//
+// Find a task for an idle thread: our own deque first, then a few
+// random victims, then the global pool.
+//
+static task_pool_p ws_find_task(thread_private_data_t* tp) {
+  task_pool_p ptask;
+  int32_t num_deques;
+  int32_t i;
+
+  if (tp->deque != NULL && (ptask = ws_pop(tp->deque)) != NULL)
+    return ptask;
+
+  num_deques = atomic_load_int_least32_t(&ws_num_deques);
+  if (num_deques > ws_max_deques)
+    num_deques = ws_max_deques;
+  for (i = 0; i < num_deques; i++) {
+    ws_deque_t* victim;
+
+    tp->ws_rand ^= tp->ws_rand << 13;
+    tp->ws_rand ^= tp->ws_rand >> 7;
+    tp->ws_rand ^= tp->ws_rand << 17;
+    victim = ws_deques[tp->ws_rand % num_deques];
+    if (victim == NULL || victim == tp->deque)
+      continue;
+    if ((ptask = ws_steal(victim)) != NULL)
+      return ptask;
+  }
+
+  if (task_pool_head == NULL)
+    return NULL;
+
+  chpl_thread_mutexLock(&threading_lock);
+  if ((ptask = task_pool_head) != NULL)
+    dequeue_task(ptask);
+  chpl_thread_mutexUnlock(&threading_lock);
+
+  return ptask;
+}
+
+
+//
+// Run the tasks in the given task list that are still on our own
+// deque.  We pop until we find a task that belongs to some other list
+// and was pushed before this list's latest run of tasks: that one is
+// from an enclosing construct, so it goes back where it was.  Tasks
+// that this list's tasks started (begins, say) sit above the rest of
+// the list.  Those are moved to the global pool, where any thread can
+// run them, so that running the list never depends on a thief showing
+// up.
+//
+static void ws_execute_list_tasks(thread_private_data_t* tp,
+                                  task_pool_p* p_task_list_head) {
+  task_pool_p curr_ptask = tp->ptask;
+  task_pool_p child_ptask;
+  int64_t run_start;
+
+  if (tp->deque == NULL)
+    return;
+
+  run_start = (tp->ws_run_list == p_task_list_head)
+              ? tp->ws_run_start : INT64_MAX;
+  tp->ws_run_list = NULL;
+
+  while ((child_ptask = ws_pop(tp->deque)) != NULL) {
+    if (child_ptask->ws_list == p_task_list_head) {
+      run_child_task(curr_ptask, child_ptask);
+      continue;
+    }
+
+    if (child_ptask->ws_index < run_start) {
+      (void) ws_push(tp->deque, child_ptask);
+      break;
+    }
+
+    chpl_thread_mutexLock(&threading_lock);
+    enqueue_task(child_ptask, child_ptask->ws_list);
+    if (chpl_task_getNumQueuedTasks()
+        > atomic_load_int_least32_t(&idle_thread_cnt))
+      maybe_add_thread();
+    chpl_thread_mutexUnlock(&threading_lock);
+  }
+}
+
+
+//
+// Print the tasks waiting in the deques, for the task report.  This
+// is called from a signal handler and doesn't synchronize with the
+// deque owners or thieves, so it's only a snapshot.
+//
+static void ws_report_pending_tasks(void) {
+  int32_t i, n;
+
+  n = atomic_load_int_least32_t(&ws_num_deques);
+  if (n > ws_max_deques)
+    n = ws_max_deques;
+  for (i = 0; i < n; i++) {
+    ws_deque_t* dq = ws_deques[i];
+    int64_t t, b;
+
+    if (dq == NULL)
+      continue;
+    b = atomic_load_int_least64_t(&dq->bottom);
+    for (t = atomic_load_int_least64_t(&dq->top); t < b; t++) {
+      task_pool_p pendingTask = dq->tasks[t & dq->mask];
+      if (pendingTask != NULL)
+        printf("- %s:%d\n", chpl_lookupFilename(pendingTask->filename),
+               (int)pendingTask->lineno);
+    }
+  }
+}
+
+
 // Threads
 
 uint32_t chpl_task_getNumThreads(void) {
@@ -1316,5 +1860,5 @@ uint32_t chpl_task_getNumThreads(void) {
 }
 
 uint32_t chpl_task_getNumIdleThreads(void) {
-  return idle_thread_cnt;
+  return atomic_load_int_least32_t(&idle_thread_cnt);
 }
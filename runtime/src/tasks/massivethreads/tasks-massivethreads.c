@@ -298,6 +298,8 @@ static void* moved_task_wrapper(void* a) {
 void chpl_task_init(void) {
   //Initialize tasking layer
   //initializing change the number of workers
+  //Task arenas (chpl_mem_taskArenaInit()) stay off: new tasks start
+  //with a copy of the parent's private data, arena included.
   int32_t numThreadsPerLocale;
   int numCommTasks = chpl_comm_numPollingTasks();
   char *env;
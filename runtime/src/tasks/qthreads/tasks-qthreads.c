@@ -41,6 +41,7 @@
 #include "chpl-comm.h"
 #include "chplexit.h"
 #include "chpl-locale-model.h"
+#include "chpl-mem.h"
 #include "chplsys.h"
 #include "chpl-linefile-support.h"
 #include "chpl-tasks.h"
@@ -665,6 +666,9 @@ void chpl_task_init(void)
     chpl_qthread_process_pthread = pthread_self();
     chpl_qthread_process_tls.chpl_data.id = qthread_incr(&next_task_id, 1);
 
+    // chapel_wrapper() releases each task's arena when the task ends.
+    chpl_mem_taskArenaInit();
+
     commMaxThreads = chpl_comm_getMaxThreads();
 
     // Set up hardware parallelism, the stack size and stack guards, and
@@ -735,6 +739,11 @@ static aligned_t chapel_wrapper(void *arg)
     data->lock_filename = 0;
     data->lock_lineno = 0;
 
+    // With more than one shepherd each is a sublocale, mapped to a NUMA
+    // domain.  Have this thread allocate from memory in its domain.
+    if (chpl_task_getNumSublocales() > 1)
+        chpl_mem_layerSetSubloc(chpl_task_getSubloc());
+
     if (rarg->countRunning) {
         chpl_taskRunningCntInc(0, 0);
     }
@@ -745,6 +754,8 @@ static aligned_t chapel_wrapper(void *arg)
 
     wrap_callbacks(chpl_task_cb_event_kind_end, &data->chpl_data);
 
+    chpl_mem_taskArenaRelease(&data->chpl_data.prvdata.mem_arena);
+
     if (rarg->countRunning) {
         chpl_taskRunningCntDec(0, 0);
     }
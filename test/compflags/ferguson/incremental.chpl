@@ -0,0 +1,48 @@
+// Compiled with --incremental, so that each module below is compiled as
+// its own C translation unit.  Check that globals, dynamic dispatch,
+// tasks and config constants work across the units.
+
+module Shapes {
+  var created = 0;
+
+  class Shape {
+    proc area(): real { return 0.0; }
+  }
+
+  class Square: Shape {
+    var side: real;
+    proc area(): real { return side * side; }
+  }
+
+  class Circle: Shape {
+    var r: real;
+    proc area(): real { return 3.0 * r * r; }
+  }
+
+  proc makeShape(i: int): Shape {
+    created += 1;
+    if i % 2 == 0 then return new Square(i);
+    else return new Circle(i);
+  }
+}
+
+module incremental {
+  use Shapes;
+
+  config const n = 4;
+
+  var total: real;
+
+  proc main() {
+    var shapes: [1..n] Shape;
+    for i in 1..n do shapes[i] = makeShape(i);
+
+    var sum: sync real = 0.0;
+    coforall s in shapes do sum += s.area();
+    total = sum;
+
+    writeln("created ", created, " shapes with total area ", total);
+
+    for s in shapes do delete s;
+  }
+}
@@ -0,0 +1,8 @@
+// Compiled with --object-cache.  The precomp script compiles this once
+// with objectCacheValue.h defining the value as 1, filling the cache,
+// then changes it to 2.  That header is only included indirectly, by
+// objectCache.h, but the cached objects must not be reused.
+
+extern const OBJECT_CACHE_VALUE: int;
+
+writeln("value is ", OBJECT_CACHE_VALUE);
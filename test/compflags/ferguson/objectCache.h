@@ -0,0 +1 @@
+#include "objectCacheValue.h"
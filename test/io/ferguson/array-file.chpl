@@ -0,0 +1,114 @@
+use IO, BlockDist;
+
+// Arrays stored in files with a header describing their shape.
+
+config const n = 5;
+
+var f = opentmp();
+
+// Through a channel, then read back into a fresh array.
+{
+  var A:[1..3, 0..3] real;
+  for (i,j) in A.domain do A[i,j] = i + j/10.0;
+  var w = f.writer();
+  w.writeArray(A);
+  w.close();
+
+  var B:[1..3, 0..3] real;
+  var r = f.reader();
+  r.readArray(B);
+  r.close();
+  writeln(B);
+  writeln(f.arrayDomain(2));
+}
+
+// A shape mismatch is a format error.
+{
+  var C:[1..4, 0..3] real;
+  var D:[1..3, 0..3] int;
+  var e:syserr;
+  var r = f.reader();
+  r.readArray(C, error=e);
+  writeln(e == EFORMAT);
+  r.close();
+  f.readArray(D, error=e);
+  writeln(e == EFORMAT);
+}
+
+// Through the file, at an offset, including complex elements.
+{
+  var Z:[1..n] complex;
+  for i in 1..n do Z[i] = i + (2.0*i)*1.0i;
+  f.writeArray(Z, offset=100);
+  var Y:[f.arrayDomain(1, offset=100)] complex;
+  f.readArray(Y, offset=100);
+  writeln(Y);
+}
+
+// A Block-distributed array is written and read by each locale.
+{
+  const Space = {1..n, 1..n, 1..2};
+  const D = Space dmapped Block(boundingBox=Space);
+  var A:[D] int;
+  forall (i,j,k) in D do A[i,j,k] = 100*i + 10*j + k;
+  f.writeArray(A);
+
+  var B:[D] int;
+  f.readArray(B);
+  writeln(&& reduce (A == B));
+
+  // The same file read into a non-distributed array.
+  var L:[f.arrayDomain(3)] int;
+  f.readArray(L);
+  writeln(&& reduce (L == A));
+
+  // The elements can be mapped where they are.
+  var M => f.mapArray(int, Space, offset=arrayHeaderSize(3));
+  writeln(M[n,n,2], " ", + reduce M == + reduce A);
+}
+
+// Split by columns, each locale's part is a run per row, with the other
+// locales' elements in between.
+{
+  const Space = {1..n, 1..n};
+  const targets = reshape(Locales, {0..0, 0..#numLocales});
+  const D = Space dmapped Block(boundingBox=Space, targetLocales=targets);
+  var A:[D] real;
+  forall (i,j) in D do A[i,j] = i + j/10.0;
+  f.writeArray(A);
+
+  var B:[D] real;
+  f.readArray(B);
+  var L:[f.arrayDomain(2)] real;
+  f.readArray(L);
+  writeln(&& reduce (A == B), " ", && reduce (L == A));
+}
+
+// An array written with the other byte order is swapped when read.
+{
+  var A:[1..3] int(32);
+  for i in 1..3 do A[i] = i:int(32);
+  f.writeArray(A);
+  var flags:uint(32);
+  var r = f.reader(kind=iolittle, start=12);
+  r.read(flags);
+  r.close();
+  var w = f.writer(kind=iolittle, start=12);
+  w.write(flags ^ 1);
+  w.close();
+  // Rewrite the elements in the byte order the new flags claim.
+  if flags == 0 {
+    var wd = f.writer(kind=iobig, start=arrayHeaderSize(1));
+    for x in A do wd.write(x);
+    wd.close();
+  } else {
+    var wd = f.writer(kind=iolittle, start=arrayHeaderSize(1));
+    for x in A do wd.write(x);
+    wd.close();
+  }
+  var B:[1..3] int(32);
+  f.readArray(B);
+  writeln(B);
+}
+
+f.close();
@@ -0,0 +1,30 @@
+use IO;
+
+// Write files and read them back through the asynchronous I/O method,
+// from several tasks at once.
+
+config const nFiles = 16;
+config const n = 20000;
+
+var ok: [1..nFiles] bool;
+
+forall i in 1..nFiles {
+  var f = opentmp(hints=QIO_METHOD_ASYNC);
+  {
+    var w = f.writer();
+    for j in 1..n do w.writeln(i*j);
+    w.close();
+  }
+  var r = f.reader();
+  var x: int;
+  var good = true;
+  for j in 1..n {
+    if !r.read(x) || x != i*j then good = false;
+  }
+  if r.read(x) then good = false;
+  r.close();
+  f.close();
+  ok[i] = good;
+}
+
+writeln(&& reduce ok);
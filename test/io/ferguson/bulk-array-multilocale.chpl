@@ -0,0 +1,38 @@
+use IO;
+
+// Read and write arrays that live on a different locale from the
+// channel, so the data moves directly between the channel buffer
+// and the remote array.
+
+config const n = 300000;
+
+proc check(hints:iohints, chanLoc:locale, dataLoc:locale) {
+  var f = opentmp(hints=hints);
+  on dataLoc {
+    var A:[1..n] int(32);
+    var B:[1..n] int(32);
+    for i in 1..n do A[i] = i:int(32);
+
+    on chanLoc {
+      var w = f.writer();
+      w.writeBinary(A);
+      w.close();
+
+      var got:int;
+      var r = f.reader();
+      if !r.readBinary(B, got) || got != n then writeln("short read");
+      r.close();
+    }
+
+    if || reduce (A != B) then writeln("mismatch");
+  }
+  if f.length() != 4*n then writeln("bad size ", f.length());
+  f.close();
+}
+
+for hints in (QIO_METHOD_PREADPWRITE,
+              QIO_METHOD_PREADPWRITE | QIO_CH_ALWAYS_UNBUFFERED) {
+  check(hints, Locales[0], Locales[numLocales-1]);
+  check(hints, Locales[numLocales-1], Locales[0]);
+}
+writeln("done");
@@ -0,0 +1,53 @@
+use IO;
+
+// Read and write whole arrays as raw bytes, through a buffered
+// channel and an unbuffered one.
+
+config const n = 200000;
+
+proc check(hints:iohints) {
+  var f = opentmp(hints=hints);
+  var A:[1..n] int;
+  var B:[0..#n] real(32);
+  for i in 1..n {
+    A[i] = i * 3;
+    B[i-1] = i:real(32) / 2.0:real(32);
+  }
+
+  {
+    var w = f.writer();
+    w.writeBinary(A);
+    w.writeBinary(B);
+    w.close();
+  }
+
+  var size = f.length();
+  if size != n * 8 + n * 4 then writeln("bad size ", size);
+
+  var AA:[1..n] int;
+  var BB:[0..#n] real(32);
+  var got:int;
+  var r = f.reader();
+  if !r.readBinary(AA, got) || got != n then writeln("short read of A");
+  if !r.readBinary(BB, got) || got != n then writeln("short read of B");
+  if || reduce (AA != A) then writeln("A mismatch");
+  if || reduce (BB != B) then writeln("B mismatch");
+
+  // Nothing left: reading hits EOF right away.
+  var C:[1..10] int;
+  if r.readBinary(C, got) || got != 0 then writeln("expected EOF");
+  r.close();
+
+  // A read that runs off the end returns what there was.
+  var r2 = f.reader(start=(n-5)*8 + 3, end=n*8);
+  var e:syserr;
+  r2.readBinary(C, got, error=e);
+  if e != EEOF || got != 4 then writeln("bad partial read ", got);
+  r2.close();
+
+  f.close();
+}
+
+check(QIO_METHOD_PREADPWRITE);
+check(QIO_METHOD_PREADPWRITE | QIO_CH_ALWAYS_UNBUFFERED);
+writeln("done");
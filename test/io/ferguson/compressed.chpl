@@ -0,0 +1,67 @@
+use IO;
+
+// Channels that compress or decompress another channel's data.
+
+config const n = 200000;
+
+var f = opentmp();
+
+// Text and binary data through a compressing writer.
+{
+  var w = f.writer();
+  var cw = w.compressed();
+  for i in 1..n do cw.writeln("line ", i % 100);
+  cw.close();
+  // Highly repetitive text compresses well.
+  writeln(w.offset() < n / 10);
+  // A second stream right after the first.
+  var bw = w.compressed();
+  for i in 1..n do bw.write(i, " ");
+  bw.close();
+  w.close();
+}
+
+{
+  var r = f.reader(kind=iolittle);
+  var magic:uint(32);
+  r.read(magic);
+  writeln(magic == 0x184D2204);
+  r.close();
+}
+
+// Both streams read back as one.
+{
+  var r = f.reader();
+  var cr = r.compressed();
+  var line:string;
+  var ok = true;
+  for i in 1..n {
+    cr.readline(line);
+    ok &&= line == "line " + (i % 100):string + "\n";
+  }
+  var x:int;
+  var sum = 0;
+  for i in 1..n {
+    cr.read(x);
+    sum += x;
+  }
+  writeln(ok, " ", sum == n*(n+1)/2, " ", !cr.read(x));
+  cr.close();
+  r.close();
+}
+
+// Data that isn't compressed is a format error.
+{
+  var g = opentmp();
+  var w = g.writer();
+  w.writeln("just some text");
+  w.close();
+  var cr = g.reader().compressed();
+  var line:string;
+  var e:syserr;
+  cr.readline(line, error=e);
+  writeln(e == EFORMAT);
+  g.close();
+}
+
+f.close();
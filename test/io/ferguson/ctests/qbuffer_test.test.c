@@ -1,5 +1,6 @@
 #include "qbuffer.h"
 #include <assert.h>
+#include <pthread.h>
 
 void test_qbytes(void)
 {
@@ -550,10 +551,77 @@ void test_qbuffer_edges(void)
 }
 
 
+#define POOL_TEST_N 20
+
+void* pool_thread(void* arg)
+{
+  qbytes_t* b[POOL_TEST_N];
+  qioerr err;
+  int i;
+
+  for( i = 0; i < POOL_TEST_N; i++ ) {
+    err = qbytes_create_iobuf(&b[i]);
+    assert(!err);
+    memset(b[i]->data, 0xff, b[i]->len);
+  }
+  for( i = 0; i < POOL_TEST_N; i++ ) {
+    qbytes_release(b[i]);
+  }
+  return NULL;
+}
+
+void test_iobuf_pool(void)
+{
+  qbytes_t* b[POOL_TEST_N];
+  uint64_t allocs, hits, held, allocs2, hits2, held2;
+  pthread_t thread;
+  qioerr err;
+  int64_t j;
+  int i;
+
+  qio_iobuf_pool_stats(&allocs, &hits, &held);
+
+  // A released iobuf is reused, and comes back zeroed.
+  err = qbytes_create_iobuf(&b[0]);
+  assert(!err);
+  memset(b[0]->data, 0xff, b[0]->len);
+  qbytes_release(b[0]);
+
+  err = qbytes_create_iobuf(&b[0]);
+  assert(!err);
+  for( j = 0; j < b[0]->len; j++ ) assert(((char*)b[0]->data)[j] == 0);
+  qbytes_release(b[0]);
+
+  qio_iobuf_pool_stats(&allocs2, &hits2, &held2);
+  assert(allocs2 == allocs + 2);
+  assert(hits2 > hits);
+  assert(held2 > 0);
+
+  // iobufs freed by a thread that has exited can be used by another.
+  pthread_create(&thread, NULL, pool_thread, NULL);
+  pthread_join(thread, NULL);
+
+  qio_iobuf_pool_stats(&allocs, &hits, &held);
+  for( i = 0; i < POOL_TEST_N; i++ ) {
+    err = qbytes_create_iobuf(&b[i]);
+    assert(!err);
+    assert(((char*)b[i]->data)[0] == 0);
+  }
+  qio_iobuf_pool_stats(&allocs2, &hits2, &held2);
+  assert(hits2 - hits >= POOL_TEST_N / 2);
+  assert(held2 < held);
+
+  for( i = 0; i < POOL_TEST_N; i++ ) {
+    qbytes_release(b[i]);
+  }
+}
+
 int main(int argc, char** argv)
 {
   test_qbytes();
 
+  test_iobuf_pool();
+
   test_qbuffer();
 
   test_qbuffer_two();
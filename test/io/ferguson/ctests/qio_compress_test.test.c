@@ -0,0 +1,578 @@
+#include "qio.h"
+#include "qio_compress.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// Frames made by the lz4 command line tool from sample_text(8000):
+// 'lz4 -BD -B4' (linked 64 KiB blocks) and
+// 'lz4 -BX -B4' (independent blocks with block checksums).
+static const unsigned char linked_frame[1350] = {
+  0x04, 0x22, 0x4d, 0x18, 0x44, 0x40, 0x5e, 0xfe, 0x01, 0x00, 0x00, 0xf1,
+  0x0b, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x30, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x0a, 0x1a, 0x00, 0x1f, 0x31, 0x1a, 0x00, 0x06, 0x1f, 0x32,
+  0x1a, 0x00, 0x06, 0x1f, 0x33, 0x1a, 0x00, 0x06, 0x1f, 0x34, 0x1a, 0x00,
+  0x06, 0x1f, 0x35, 0x1a, 0x00, 0x06, 0x1f, 0x36, 0x1a, 0x00, 0x06, 0x1f,
+  0x37, 0x1a, 0x00, 0x06, 0x1f, 0x38, 0x1a, 0x00, 0x06, 0x1f, 0x39, 0x1a,
+  0x00, 0x06, 0x1f, 0x31, 0x05, 0x01, 0x08, 0x0f, 0x06, 0x01, 0x07, 0x1f,
+  0x31, 0x07, 0x01, 0x07, 0x1f, 0x31, 0x08, 0x01, 0x07, 0x1f, 0x31, 0x09,
+  0x01, 0x07, 0x1f, 0x31, 0x0a, 0x01, 0x07, 0x1f, 0x31, 0x0b, 0x01, 0x07,
+  0x1f, 0x31, 0x0c, 0x01, 0x07, 0x1f, 0x31, 0x0d, 0x01, 0x07, 0x1f, 0x31,
+  0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01,
+  0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f,
+  0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e,
+  0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07,
+  0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33,
+  0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01,
+  0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f,
+  0x33, 0x0e, 0x01, 0x07, 0x0f, 0xbc, 0x00, 0x07, 0x0f, 0xbb, 0x00, 0x07,
+  0x0f, 0xba, 0x00, 0x08, 0x0f, 0x41, 0x03, 0x06, 0x0f, 0xb8, 0x00, 0x07,
+  0x0f, 0xb7, 0x00, 0x07, 0x0f, 0xb6, 0x00, 0x07, 0x0f, 0xc3, 0x01, 0x07,
+  0x0f, 0xc2, 0x01, 0x07, 0x0f, 0xc1, 0x01, 0x07, 0x0f, 0xdd, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+  0x78, 0x74, 0x0a, 0x6c, 0x69, 0x0a, 0x01, 0x00, 0x00, 0x0f, 0x1d, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xe8, 0x50, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0xce,
+  0x01, 0x00, 0x00, 0xf8, 0x0c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x6c,
+  0x69, 0x6e, 0x65, 0x20, 0x32, 0x30, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x1b, 0x00, 0x1f, 0x31,
+  0x1b, 0x00, 0x07, 0x1f, 0x32, 0x1b, 0x00, 0x07, 0x1f, 0x33, 0x1b, 0x00,
+  0x07, 0x1f, 0x34, 0x1b, 0x00, 0x07, 0x1f, 0x35, 0x1b, 0x00, 0x07, 0x1f,
+  0x36, 0x1b, 0x00, 0x07, 0x1f, 0x37, 0x1b, 0x00, 0x07, 0x1f, 0x38, 0x1b,
+  0x00, 0x07, 0x1f, 0x39, 0x1b, 0x00, 0x06, 0x1f, 0x33, 0x0e, 0x01, 0x07,
+  0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33,
+  0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01,
+  0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x0f, 0xbc, 0x00, 0x07, 0x0f, 0xbb,
+  0x00, 0x07, 0x0f, 0xba, 0x00, 0x08, 0x0f, 0x25, 0x01, 0x06, 0x0f, 0xb8,
+  0x00, 0x07, 0x0f, 0xb7, 0x00, 0x07, 0x0f, 0xb6, 0x00, 0x07, 0x0f, 0xc3,
+  0x01, 0x07, 0x0f, 0xc2, 0x01, 0x07, 0x0f, 0xc1, 0x01, 0x07, 0x1f, 0x31,
+  0x05, 0x01, 0x08, 0x0f, 0x06, 0x01, 0x07, 0x1f, 0x31, 0x07, 0x01, 0x07,
+  0x1f, 0x31, 0xc1, 0x01, 0x07, 0x1f, 0x31, 0x09, 0x01, 0x07, 0x1f, 0x31,
+  0x0a, 0x01, 0x07, 0x1f, 0x31, 0x0b, 0x01, 0x07, 0x1f, 0x31, 0x0c, 0x01,
+  0x07, 0x1f, 0x31, 0x0d, 0x01, 0x07, 0x1f, 0x31, 0x0e, 0x01, 0x07, 0x0f,
+  0xdd, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x50, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x51, 0x00, 0x00,
+  0x00, 0x0f, 0xed, 0xff, 0x00, 0x0f, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x60, 0x50, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x97, 0x8d, 0x75,
+};
+
+static const unsigned char checksummed_frame[1760] = {
+  0x04, 0x22, 0x4d, 0x18, 0x74, 0x40, 0xbd, 0xfe, 0x01, 0x00, 0x00, 0xf1,
+  0x0b, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x30, 0x20, 0x6f, 0x66, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x65,
+  0x78, 0x74, 0x0a, 0x1a, 0x00, 0x1f, 0x31, 0x1a, 0x00, 0x06, 0x1f, 0x32,
+  0x1a, 0x00, 0x06, 0x1f, 0x33, 0x1a, 0x00, 0x06, 0x1f, 0x34, 0x1a, 0x00,
+  0x06, 0x1f, 0x35, 0x1a, 0x00, 0x06, 0x1f, 0x36, 0x1a, 0x00, 0x06, 0x1f,
+  0x37, 0x1a, 0x00, 0x06, 0x1f, 0x38, 0x1a, 0x00, 0x06, 0x1f, 0x39, 0x1a,
+  0x00, 0x06, 0x1f, 0x31, 0x05, 0x01, 0x08, 0x0f, 0x06, 0x01, 0x07, 0x1f,
+  0x31, 0x07, 0x01, 0x07, 0x1f, 0x31, 0x08, 0x01, 0x07, 0x1f, 0x31, 0x09,
+  0x01, 0x07, 0x1f, 0x31, 0x0a, 0x01, 0x07, 0x1f, 0x31, 0x0b, 0x01, 0x07,
+  0x1f, 0x31, 0x0c, 0x01, 0x07, 0x1f, 0x31, 0x0d, 0x01, 0x07, 0x1f, 0x31,
+  0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01,
+  0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f,
+  0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e,
+  0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07,
+  0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33,
+  0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01,
+  0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f,
+  0x33, 0x0e, 0x01, 0x07, 0x0f, 0xbc, 0x00, 0x07, 0x0f, 0xbb, 0x00, 0x07,
+  0x0f, 0xba, 0x00, 0x08, 0x0f, 0x41, 0x03, 0x06, 0x0f, 0xb8, 0x00, 0x07,
+  0x0f, 0xb7, 0x00, 0x07, 0x0f, 0xb6, 0x00, 0x07, 0x0f, 0xc3, 0x01, 0x07,
+  0x0f, 0xc2, 0x01, 0x07, 0x0f, 0xc1, 0x01, 0x07, 0x0f, 0xdd, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
+  0x78, 0x74, 0x0a, 0x6c, 0x69, 0x69, 0x58, 0xc9, 0xa8, 0xd0, 0x01, 0x00,
+  0x00, 0xf0, 0x0c, 0x6e, 0x65, 0x20, 0x31, 0x30, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74,
+  0x65, 0x78, 0x74, 0x0a, 0x6c, 0x69, 0x1b, 0x00, 0x1f, 0x31, 0x1b, 0x00,
+  0x07, 0x1f, 0x32, 0x1b, 0x00, 0x07, 0x1f, 0x33, 0x1b, 0x00, 0x07, 0x1f,
+  0x34, 0x1b, 0x00, 0x07, 0x1f, 0x35, 0x1b, 0x00, 0x07, 0x1f, 0x36, 0x1b,
+  0x00, 0x07, 0x1f, 0x37, 0x1b, 0x00, 0x07, 0x1f, 0x38, 0x1b, 0x00, 0x07,
+  0x1f, 0x39, 0x1b, 0x00, 0x06, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32,
+  0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01,
+  0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f,
+  0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e,
+  0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07,
+  0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33,
+  0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01,
+  0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x0f, 0xbc, 0x00, 0x07, 0x0f, 0xbb,
+  0x00, 0x07, 0x0f, 0xba, 0x00, 0x08, 0x0f, 0x33, 0x02, 0x06, 0x0f, 0xb8,
+  0x00, 0x07, 0x0f, 0xb7, 0x00, 0x07, 0x0f, 0xb6, 0x00, 0x07, 0x0f, 0xc3,
+  0x01, 0x07, 0x0f, 0xc2, 0x01, 0x07, 0x0f, 0xc1, 0x01, 0x07, 0x0f, 0xdd,
+  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x05, 0x50, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x7c, 0x29, 0x4d,
+  0x72, 0xce, 0x01, 0x00, 0x00, 0xf8, 0x0c, 0x20, 0x74, 0x65, 0x78, 0x74,
+  0x0a, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x32, 0x30, 0x20, 0x6f, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x1b, 0x00,
+  0x1f, 0x31, 0x1b, 0x00, 0x07, 0x1f, 0x32, 0x1b, 0x00, 0x07, 0x1f, 0x33,
+  0x1b, 0x00, 0x07, 0x1f, 0x34, 0x1b, 0x00, 0x07, 0x1f, 0x35, 0x1b, 0x00,
+  0x07, 0x1f, 0x36, 0x1b, 0x00, 0x07, 0x1f, 0x37, 0x1b, 0x00, 0x07, 0x1f,
+  0x38, 0x1b, 0x00, 0x07, 0x1f, 0x39, 0x1b, 0x00, 0x06, 0x1f, 0x33, 0x0e,
+  0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07,
+  0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x1f, 0x33,
+  0x0e, 0x01, 0x07, 0x1f, 0x33, 0x0e, 0x01, 0x07, 0x0f, 0xbc, 0x00, 0x07,
+  0x0f, 0xbb, 0x00, 0x07, 0x0f, 0xba, 0x00, 0x08, 0x0f, 0x25, 0x01, 0x06,
+  0x0f, 0xb8, 0x00, 0x07, 0x0f, 0xb7, 0x00, 0x07, 0x0f, 0xb6, 0x00, 0x07,
+  0x0f, 0xc3, 0x01, 0x07, 0x0f, 0xc2, 0x01, 0x07, 0x0f, 0xc1, 0x01, 0x07,
+  0x1f, 0x31, 0x05, 0x01, 0x08, 0x0f, 0x06, 0x01, 0x07, 0x1f, 0x31, 0x07,
+  0x01, 0x07, 0x1f, 0x31, 0xc1, 0x01, 0x07, 0x1f, 0x31, 0x09, 0x01, 0x07,
+  0x1f, 0x31, 0x0a, 0x01, 0x07, 0x1f, 0x31, 0x0b, 0x01, 0x07, 0x1f, 0x31,
+  0x0c, 0x01, 0x07, 0x1f, 0x31, 0x0d, 0x01, 0x07, 0x1f, 0x31, 0x0e, 0x01,
+  0x07, 0x0f, 0xdd, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x6f, 0x66, 0x20, 0x74, 0x68, 0xec,
+  0x4d, 0x47, 0xff, 0x15, 0x01, 0x00, 0x00, 0xff, 0x0c, 0x65, 0x20, 0x73,
+  0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x6c,
+  0x69, 0x6e, 0x65, 0x20, 0x33, 0x30, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+  0x1b, 0x00, 0x01, 0x1f, 0x31, 0x1b, 0x00, 0x07, 0x1f, 0x32, 0x1b, 0x00,
+  0x07, 0x1f, 0x33, 0x1b, 0x00, 0x07, 0x1f, 0x34, 0x1b, 0x00, 0x07, 0x1f,
+  0x35, 0x1b, 0x00, 0x07, 0x1f, 0x36, 0x1b, 0x00, 0x06, 0x0f, 0xbc, 0x00,
+  0x07, 0x0f, 0xbb, 0x00, 0x07, 0x0f, 0xba, 0x00, 0x08, 0x0f, 0x68, 0x00,
+  0x06, 0x0f, 0xb8, 0x00, 0x07, 0x0f, 0xb7, 0x00, 0x07, 0x0f, 0xb6, 0x00,
+  0x07, 0x1f, 0x37, 0x68, 0x00, 0x06, 0x1f, 0x38, 0x1a, 0x00, 0x06, 0x1f,
+  0x39, 0x1a, 0x00, 0x06, 0x1f, 0x31, 0x05, 0x01, 0x08, 0x0f, 0x06, 0x01,
+  0x07, 0x1f, 0x31, 0x07, 0x01, 0x07, 0x1f, 0x31, 0xc1, 0x01, 0x07, 0x1f,
+  0x31, 0x09, 0x01, 0x07, 0x1f, 0x31, 0x0a, 0x01, 0x07, 0x1f, 0x31, 0x0b,
+  0x01, 0x07, 0x1f, 0x31, 0x0c, 0x01, 0x07, 0x1f, 0x31, 0x0d, 0x01, 0x07,
+  0x1f, 0x31, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32,
+  0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01,
+  0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f,
+  0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x1f, 0x32, 0x0e,
+  0x01, 0x07, 0x1f, 0x32, 0x0e, 0x01, 0x07, 0x0f, 0xdd, 0x03, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x7f, 0x50, 0x74, 0x65, 0x78, 0x74, 0x0a, 0x22, 0xe3, 0x71, 0x9d,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x97, 0x8d, 0x75,
+};
+
+static char* sample_text(int lines, int64_t* len_out)
+{
+  char* s = malloc(lines * 40);
+  int64_t len = 0;
+  int i;
+  for( i = 0; i < lines; i++ )
+    len += sprintf(s + len, "line %d of the sample text\n", i % 37);
+  *len_out = len;
+  return s;
+}
+
+static void fill_mixed(unsigned char* buf, int64_t len)
+{
+  int64_t i;
+  unsigned x = 1;
+  for( i = 0; i < len; i++ ) {
+    x = x * 1103515245 + 12345;
+    // runs of random bytes, repeats, and zeros
+    if( (i / 5000) % 3 == 0 ) buf[i] = x >> 16;
+    else if( (i / 5000) % 3 == 1 ) buf[i] = "abcdefgh"[i % 7];
+    else buf[i] = 0;
+  }
+}
+
+static void check_block(const unsigned char* src, int64_t len)
+{
+  int64_t cap = qio_lz4_compress_bound(len);
+  unsigned char* comp = malloc(cap);
+  unsigned char* back = malloc(len + 1);
+  int64_t clen, dlen;
+
+  clen = qio_lz4_compress_block(src, len, comp, cap);
+  assert(clen > 0);
+  dlen = qio_lz4_decompress_block(comp, clen, back, len, 0);
+  assert(dlen == len);
+  assert(memcmp(src, back, len) == 0);
+
+  // A truncated block must not decompress past the end of its buffer.
+  if( clen > 1 ) {
+    dlen = qio_lz4_decompress_block(comp, clen - 1, back, len, 0);
+    assert(dlen <= len);
+  }
+
+  free(comp);
+  free(back);
+}
+
+static void test_blocks(void)
+{
+  int64_t len = 300000;
+  unsigned char* buf = malloc(len);
+  int64_t i;
+
+  fill_mixed(buf, len);
+  check_block(buf, len);
+  for( i = 0; i < 40; i++ ) check_block(buf, i);
+  check_block(buf + 10000, 20000); // repeats and zeros
+
+  memset(buf, 'z', len);
+  check_block(buf, len);
+  // Highly repetitive data should shrink a lot.
+  assert(qio_lz4_compress_block(buf, len, buf, 0) == 0);
+
+  free(buf);
+}
+
+static void test_xxh32(void)
+{
+  unsigned char buf[1000];
+  qio_xxh32_state_t st;
+  int i;
+
+  assert(qio_xxh32("", 0, 0) == 0x02CC5D05);
+
+  fill_mixed(buf, sizeof(buf));
+  for( i = 1; i < 40; i += 3 ) {
+    int pos = 0;
+    qio_xxh32_init(&st, 7);
+    while( pos < (int) sizeof(buf) ) {
+      int n = i;
+      if( n > (int) sizeof(buf) - pos ) n = sizeof(buf) - pos;
+      qio_xxh32_update(&st, buf + pos, n);
+      pos += n;
+    }
+    assert(qio_xxh32_digest(&st) == qio_xxh32(buf, sizeof(buf), 7));
+  }
+}
+
+// Reads everything from a decompressing channel over the given data.
+static char* decompress_all(const void* data, int64_t len, int64_t* len_out,
+                            qioerr* err_out)
+{
+  qbuffer_t* buf;
+  qio_file_t* f;
+  qio_channel_t* under;
+  qio_channel_t* ch;
+  int64_t cap = 1024*1024;
+  char* out = malloc(cap);
+  ssize_t got;
+  int64_t total = 0;
+  qioerr err;
+
+  err = qbuffer_create(&buf);
+  assert(!err);
+  err = qio_file_open_mem(&f, buf, NULL);
+  assert(!err);
+  err = qio_channel_create(&under, f, 0, 0, 1, 0, INT64_MAX, NULL);
+  assert(!err);
+  err = qio_channel_write_amt(1, under, data, len);
+  assert(!err);
+  err = qio_channel_close(1, under);
+  assert(!err);
+  qio_channel_release(under);
+
+  err = qio_channel_create(&under, f, 0, 1, 0, 0, INT64_MAX, NULL);
+  assert(!err);
+  err = qio_channel_create_compress(&ch, under, QIO_COMPRESS_LZ4, 0, NULL);
+  assert(!err);
+  // The filtered channel holds its own reference.
+  qio_channel_release(under);
+
+  while( 1 ) {
+    // Odd-sized reads to cross block boundaries at different places.
+    err = qio_channel_read(1, ch, out + total, 4099, &got);
+    total += got;
+    assert(total + 4099 <= cap);
+    if( err ) break;
+  }
+
+  qio_channel_release(ch);
+  qio_file_release(f);
+  qbuffer_release(buf);
+
+  *len_out = total;
+  *err_out = (qio_err_to_int(err) == EEOF) ? 0 : err;
+  return out;
+}
+
+static void test_tool_frames(void)
+{
+  int64_t expect_len, got_len;
+  char* expect = sample_text(8000, &expect_len);
+  unsigned char bad[sizeof(checksummed_frame)];
+  char* got;
+  qioerr err;
+
+  got = decompress_all(linked_frame, sizeof(linked_frame), &got_len, &err);
+  assert(!err);
+  assert(got_len == expect_len);
+  assert(memcmp(got, expect, expect_len) == 0);
+  free(got);
+
+  got = decompress_all(checksummed_frame, sizeof(checksummed_frame),
+                       &got_len, &err);
+  assert(!err);
+  assert(got_len == expect_len);
+  assert(memcmp(got, expect, expect_len) == 0);
+  free(got);
+
+  // Damage the last block; its checksum should catch it.
+  memcpy(bad, checksummed_frame, sizeof(bad));
+  bad[sizeof(bad) - 20] ^= 1;
+  got = decompress_all(bad, sizeof(bad), &got_len, &err);
+  assert(qio_err_to_int(err) == EFORMAT);
+  free(got);
+
+  // A frame cut short is an error, not the end of the data.  What was
+  // decoded before the cut is still returned.
+  got = decompress_all(linked_frame, sizeof(linked_frame) / 2,
+                       &got_len, &err);
+  assert(qio_err_to_int(err) == EFORMAT);
+  assert(got_len < expect_len);
+  assert(memcmp(got, expect, got_len) == 0);
+  free(got);
+
+  // Only the end mark is missing: every block comes back first.
+  got = decompress_all(checksummed_frame, sizeof(checksummed_frame) - 8,
+                       &got_len, &err);
+  assert(qio_err_to_int(err) == EFORMAT);
+  assert(got_len == expect_len);
+  assert(memcmp(got, expect, expect_len) == 0);
+  free(got);
+
+  free(expect);
+}
+
+// A linked-block frame whose first block is corrupt must be reported
+// as such, not used as the prefix of the block after it.
+static void test_corrupt_linked(void)
+{
+  unsigned char frame[64];
+  int64_t len = 0;
+  int64_t got_len;
+  char* got;
+  qioerr err;
+
+  frame[len++] = 0x04; frame[len++] = 0x22;
+  frame[len++] = 0x4d; frame[len++] = 0x18;
+  frame[len++] = 0x40; // version 1, linked blocks
+  frame[len++] = 0x40; // 64 KiB blocks
+  frame[len] = (qio_xxh32(frame + 4, 2, 0) >> 8) & 0xff;
+  len++;
+
+  // A match with offset 0, which can't decompress.
+  frame[len++] = 3; frame[len++] = 0;
+  frame[len++] = 0; frame[len++] = 0;
+  frame[len++] = 0x00; frame[len++] = 0x00; frame[len++] = 0x00;
+
+  // A stored block.
+  frame[len++] = 3; frame[len++] = 0;
+  frame[len++] = 0; frame[len++] = 0x80;
+  frame[len++] = 'a'; frame[len++] = 'b'; frame[len++] = 'c';
+
+  // End mark
+  frame[len++] = 0; frame[len++] = 0;
+  frame[len++] = 0; frame[len++] = 0;
+
+  got = decompress_all(frame, len, &got_len, &err);
+  assert(qio_err_to_int(err) == EFORMAT);
+  assert(got_len == 0);
+  free(got);
+}
+
+static void test_roundtrip(int64_t len)
+{
+  qbuffer_t* buf;
+  qio_file_t* f;
+  qio_channel_t* under;
+  qio_channel_t* ch;
+  unsigned char* data = malloc(len);
+  unsigned char* back = malloc(len);
+  int64_t clen;
+  int64_t pos;
+  qioerr err;
+
+  fill_mixed(data, len);
+
+  err = qbuffer_create(&buf);
+  assert(!err);
+  err = qio_file_open_mem(&f, buf, NULL);
+  assert(!err);
+
+  // Write two frames back to back, as concatenated .lz4 files would be.
+  err = qio_channel_create(&under, f, 0, 0, 1, 0, INT64_MAX, NULL);
+  assert(!err);
+  for( pos = 0; pos < len; ) {
+    int64_t half = len / 2;
+    int64_t end = (pos < half) ? half : len;
+    err = qio_channel_create_compress(&ch, under, QIO_COMPRESS_LZ4, 0, NULL);
+    assert(!err);
+    while( pos < end ) {
+      int64_t n = end - pos;
+      if( n > 70000 ) n = 70000;
+      err = qio_channel_write_amt(1, ch, data + pos, n);
+      assert(!err);
+      pos += n;
+    }
+    err = qio_channel_close(1, ch);
+    assert(!err);
+    qio_channel_release(ch);
+  }
+  clen = qio_channel_offset_unlocked(under);
+  err = qio_channel_close(1, under);
+  assert(!err);
+  qio_channel_release(under);
+  if( len > 100000 ) assert(clen < len);
+
+  err = qio_channel_create(&under, f, 0, 1, 0, 0, INT64_MAX, NULL);
+  assert(!err);
+  err = qio_channel_create_compress(&ch, under, QIO_COMPRESS_LZ4, 0, NULL);
+  assert(!err);
+  err = qio_channel_read_amt(1, ch, back, len);
+  assert(!err);
+  assert(memcmp(data, back, len) == 0);
+  {
+    char c;
+    ssize_t got;
+    err = qio_channel_read(1, ch, &c, 1, &got);
+    assert(qio_err_to_int(err) == EEOF && got == 0);
+  }
+  qio_channel_release(ch);
+  qio_channel_release(under);
+
+  qio_file_release(f);
+  qbuffer_release(buf);
+  free(data);
+  free(back);
+}
+
+int main(int argc, char** argv)
+{
+  test_blocks();
+  test_xxh32();
+  test_tool_frames();
+  test_corrupt_linked();
+  test_roundtrip(0);
+  test_roundtrip(100);
+  test_roundtrip(5*1024*1024 + 12345);
+
+  printf("qio_compress_test PASS\n");
+  return 0;
+}
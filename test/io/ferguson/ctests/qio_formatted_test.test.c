@@ -699,6 +699,174 @@ void test_printscan_float(void)
 #undef NSTYLES
 }
 
+// Scan a mix of numbers that the fast paths in qio_formatted.c handle
+// and ones they leave to the general path, and check we get what
+// strtoll and strtod do.  Run with small buffers, numbers get split
+// across buffer boundaries too.
+void test_scan_numbers(void)
+{
+  qioerr err;
+  qio_file_t* f;
+  qio_channel_t* writing;
+  qio_channel_t* reading;
+  const char* ints[] = { "0", "7", "-7", "0012", "123456789",
+                         "  42", "\n-9223372036854775808",
+                         "9223372036854775807", "1234567890123456789",
+                         "-1", "99999999", "100000000", "12345678901234",
+                         NULL };
+  const char* floats[] = { "0", "-0", "1.5", "  -2.25", "3.", "0.1",
+                           "1e10", "1E-5", "6.02214076e23",
+                           "2.2250738585072014e-308",
+                           "1.7976931348623157e308",
+                           "0.30000000000000004", "123456789012345678",
+                           "1e22", "1e23", "4.9e-324", "-0.000001234",
+                           "9007199254740993", "inf", "-nan", NULL };
+  int64_t got_int;
+  double got_float;
+  int i;
+
+  err = qio_file_open_tmp(&f, 0, NULL);
+  assert(!err);
+
+  err = qio_channel_create(&writing, f, QIO_CH_BUFFERED, 0, 1, 0, INT64_MAX, NULL);
+  assert(!err);
+  for( i = 0; ints[i]; i++ ) {
+    err = qio_channel_write_amt(true, writing, ints[i], strlen(ints[i]));
+    assert(!err);
+    err = qio_channel_write_amt(true, writing, " ", 1);
+    assert(!err);
+  }
+  for( i = 0; floats[i]; i++ ) {
+    err = qio_channel_write_amt(true, writing, floats[i], strlen(floats[i]));
+    assert(!err);
+    err = qio_channel_write_amt(true, writing, ",", 1);
+    assert(!err);
+  }
+  qio_channel_release(writing);
+
+  err = qio_channel_create(&reading, f, QIO_CH_BUFFERED, 1, 0, 0, INT64_MAX, NULL);
+  assert(!err);
+  for( i = 0; ints[i]; i++ ) {
+    err = qio_channel_scan_int(true, reading, &got_int, 8, 1);
+    assert(!err);
+    assert(got_int == strtoll(ints[i], NULL, 10));
+  }
+  for( i = 0; floats[i]; i++ ) {
+    double expect = strtod(floats[i], NULL);
+    err = qio_channel_scan_float(true, reading, &got_float, 8);
+    assert(!err);
+    if( isnan(expect) ) assert(isnan(got_float));
+    else {
+      assert(got_float == expect);
+      assert(signbit(got_float) == signbit(expect));
+    }
+    err = qio_channel_scan_literal(true, reading, ",", 1, 0);
+    assert(!err);
+  }
+  qio_channel_release(reading);
+
+  qio_file_release(f);
+
+  if( verbose ) printf("PASS: scan numbers\n");
+}
+
+// Default %g output must not change even when it doesn't come from
+// snprintf, and realfmt 3 should give the shortest round-trip digits.
+void test_print_shortest(void)
+{
+  qioerr err;
+  qio_file_t* f;
+  qio_channel_t* writing;
+  qio_channel_t* reading;
+  qio_style_t style;
+  double nums[] = { 0.1, 0.5, 1.0/3, 2.0/3, 100, 123456, 1234567, 9.5,
+                    9999995, 0.0001, 0.00001, 1e15, 1e16, 1e17, 5e-324,
+                    2.2250738585072014e-308, 1.7976931348623157e308,
+                    0.30000000000000004, 123.456, 1e21, 1e22, 1e23 };
+  const char* shortest[] = { "0.1", "0.5", "0.3333333333333333",
+                             "0.6666666666666666", "100", "123456",
+                             "1234567", "9.5", "9999995", "0.0001",
+                             "1e-05", "1000000000000000",
+                             "10000000000000000", "1e+17", "5e-324",
+                             "2.2250738585072014e-308",
+                             "1.7976931348623157e+308",
+                             "0.30000000000000004", "123.456", "1e+21",
+                             "1e+22", "1e+23" };
+  char got[100];
+  char expect[100];
+  ssize_t amt_read;
+  int i, j;
+  int n = sizeof(nums)/sizeof(nums[0]);
+
+  err = qio_file_open_tmp(&f, 0, NULL);
+  assert(!err);
+
+  for( i = 0; i < n; i++ ) {
+    for( j = -1; j <= 18; j++ ) {
+      qio_style_init_default(&style);
+      style.showpointzero = 0;
+      style.precision = j;
+      // j == 18 means realfmt 3
+      if( j == 18 ) style.realfmt = 3;
+
+      err = qio_channel_create(&writing, f, QIO_CH_BUFFERED, 0, 1, 0, INT64_MAX, &style);
+      assert(!err);
+      err = qio_channel_print_float(true, writing, &nums[i], 8);
+      assert(!err);
+      err = qio_channel_write_amt(true, writing, "\0", 1);
+      assert(!err);
+      qio_channel_release(writing);
+
+      memset(got, 0, sizeof(got));
+      err = qio_channel_create(&reading, f, QIO_CH_BUFFERED, 1, 0, 0, INT64_MAX, &style);
+      assert(!err);
+      err = qio_channel_read(true, reading, got, sizeof(got), &amt_read);
+      assert(qio_err_to_int(err) == EEOF);
+      qio_channel_release(reading);
+
+      if( j == 18 ) {
+        strcpy(expect, shortest[i]);
+        assert(strtod(got, NULL) == nums[i]);
+      } else if( j < 0 ) {
+        snprintf(expect, sizeof(expect), "%g", nums[i]);
+      } else {
+        snprintf(expect, sizeof(expect), "%.*g", j, nums[i]);
+      }
+      if( strcmp(got, expect) != 0 ) {
+        fprintf(stderr, "Got    '%s'\n", got);
+        fprintf(stderr, "Expect '%s'\n", expect);
+        assert(strcmp(got, expect) == 0);
+      }
+    }
+  }
+
+  // A real(32) gets the shortest digits for a float.
+  {
+    float fl = 0.1f;
+    qio_style_init_default(&style);
+    style.realfmt = 3;
+    err = qio_channel_create(&writing, f, QIO_CH_BUFFERED, 0, 1, 0, INT64_MAX, &style);
+    assert(!err);
+    err = qio_channel_print_float(true, writing, &fl, 4);
+    assert(!err);
+    err = qio_channel_write_amt(true, writing, "\0", 1);
+    assert(!err);
+    qio_channel_release(writing);
+
+    memset(got, 0, sizeof(got));
+    err = qio_channel_create(&reading, f, QIO_CH_BUFFERED, 1, 0, 0, INT64_MAX, &style);
+    assert(!err);
+    err = qio_channel_read(true, reading, got, sizeof(got), &amt_read);
+    assert(qio_err_to_int(err) == EEOF);
+    qio_channel_release(reading);
+    assert(strcmp(got, "0.1") == 0);
+  }
+
+  qio_file_release(f);
+
+  if( verbose ) printf("PASS: shortest float printing\n");
+}
+
 void test_verybasic()
 {
 	qio_file_t *f = NULL;
@@ -1527,6 +1695,8 @@ int main(int argc, char** argv)
     test_endian();
     test_printscan_int();
     test_printscan_float();
+    test_scan_numbers();
+    test_print_shortest();
 
     test_readwritestring();
 
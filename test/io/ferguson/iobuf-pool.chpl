@@ -0,0 +1,23 @@
+use IO, Memory;
+
+// Channels that are opened and closed over and over should reuse
+// the buffers of the channels before them.
+
+config const nFiles = 100;
+
+forall i in 1..nFiles {
+  var f = opentmp();
+  {
+    var w = f.writer();
+    w.writeln(i);
+    w.close();
+  }
+  var r = f.reader();
+  var x: int;
+  r.read(x);
+  r.close();
+  f.close();
+  if x != i then writeln("bad value in file ", i);
+}
+
+printIobufPoolStats();
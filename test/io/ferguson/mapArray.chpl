@@ -0,0 +1,54 @@
+use IO;
+
+// Arrays whose elements are stored in a file.
+
+config const n = 100000;
+
+var f = opentmp();
+{
+  var A:[1..n] int;
+  for i in 1..n do A[i] = i;
+  var w = f.writer();
+  w.writeBinary(A);
+  w.close();
+}
+
+// Read-only use of the whole file.
+{
+  var A => f.mapArray(int, {1..n}, hints=IOHINT_SEQUENTIAL);
+  writeln(+ reduce A);
+  // Without write-back, changes are not seen in the file.
+  A[1] = -1;
+}
+
+// A multidimensional view at an offset that is not page-aligned.
+{
+  var B => f.mapArray(int, {1..3, 1..4}, offset=8*5);
+  writeln(B);
+}
+
+// With write-back, changes reach the file, and the file grows to
+// hold the array.
+{
+  var C => f.mapArray(int, {0..n}, offset=8*(n-1), writeBack=true);
+  writeln(C[0], " ", C[1], " ", C[2]);
+  C[0] = 0;
+  C[n] = 42;
+}
+writeln(f.length() == 8*(2*n-1+1));
+{
+  var r = f.reader(kind=ionative);
+  var x:int;
+  r.read(x);
+  writeln(x);
+  r.close();
+  r = f.reader(kind=ionative, start=8*(n-1));
+  r.read(x);
+  writeln(x);
+  r.close();
+  r = f.reader(kind=ionative, start=8*(2*n-1));
+  r.read(x);
+  writeln(x);
+  r.close();
+}
+
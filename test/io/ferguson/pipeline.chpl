@@ -0,0 +1,42 @@
+use IO;
+
+// Write a file through a write-behind pipeline and read it back
+// through a read-ahead pipeline, whole and in bounded pieces.
+
+config const n = 300000;
+config const depth = 4;
+
+var f = opentmp(hints=QIO_METHOD_PREADPWRITE);
+{
+  var w = f.writer(kind=ionative, hints=IOHINT_PIPELINE(depth));
+  for i in 1..n do w.write(i:int(32));
+  w.close();
+  if w.stallTime() < 0.0 then writeln("bad write stall time");
+}
+
+var ok = true;
+{
+  var r = f.reader(kind=ionative, hints=IOHINT_PIPELINE(depth));
+  var x:int(32);
+  for i in 1..n {
+    if !r.read(x) || x != i then ok = false;
+  }
+  if r.read(x) then ok = false;
+  if r.stallTime() < 0.0 then writeln("bad read stall time");
+  r.close();
+}
+
+// a region that does not line up with the buffer size
+{
+  const lo = 12345, hi = n - 7;
+  var r = f.reader(kind=ionative, start=4*lo, end=4*hi, hints=IOHINT_PIPELINE(depth));
+  var x:int(32);
+  for i in lo+1..hi {
+    if !r.read(x) || x != i then ok = false;
+  }
+  if r.read(x) then ok = false;
+  r.close();
+}
+
+f.close();
+writeln(ok);
@@ -0,0 +1,63 @@
+use IO;
+
+// Split a text file into pieces that hold whole lines and read
+// the pieces in parallel.
+
+config const n = 10000;
+config const nChunks = 7;
+
+var f = opentmp();
+{
+  var w = f.writer();
+  for i in 1..n {
+    // an occasional long line, so that some pieces come out empty
+    if i % 2500 == 0 then w.writeln("x" * 10000);
+    else w.writeln(i);
+  }
+  // no newline after the last record
+  w.write("last");
+  w.close();
+}
+
+var b = f.recordBoundaries(nChunks);
+writeln(b.size == nChunks+1, " ", b[0] == 0, " ", b[nChunks] == f.length());
+{
+  var ok = true;
+  for i in 1..nChunks {
+    if b[i] < b[i-1] then ok = false;
+    // every boundary follows a newline
+    if b[i] > 0 && b[i] < f.length() {
+      var r = f.reader(kind=ionative, start=b[i]-1, end=b[i]);
+      var c:uint(8);
+      r.read(c);
+      r.close();
+      if c != 0x0a then ok = false;
+    }
+  }
+  writeln(ok);
+}
+
+var total: atomic int;
+var nLines: atomic int;
+forall r in f.recordReaders(nChunks) {
+  var line:string;
+  while r.readline(line) {
+    nLines.add(1);
+    if line.length < 10 && line != "last" then total.add(line.strip():int);
+  }
+  r.close();
+}
+writeln(nLines.read(), " ", total.read());
+
+var serialLines = 0;
+for r in f.recordReaders(3) {
+  var line:string;
+  while r.readline(line) do serialLines += 1;
+}
+writeln(serialLines);
+
+// a region of the file, longer than it
+writeln(f.recordBoundaries(2, start=f.length()-6, end=f.length()+100) -
+        (f.length()-6));
+
+f.close();
@@ -0,0 +1,28 @@
+//
+// Memory allocated by a task on a sublocale should come from the jemalloc
+// arena for that sublocale's NUMA domain, and so be bound to that domain.
+// Sublocale i goes with the i'th node the kernel lists, modulo the number
+// of nodes, whether or not the node ids are dense.
+//
+extern proc numaNodeId(i: int): int;
+extern proc preferredNode(p: c_void_ptr): int;
+
+config const n = 4 * 1024 * 1024;   // bigger than a jemalloc chunk
+
+var numNodes = 0;
+while numaNodeId(numNodes) >= 0 do numNodes += 1;
+
+// With a single NUMA domain there are no per-domain arenas.
+if numNodes > 1 {
+  const numSublocs = (here:LocaleModel).numSublocales;
+  for i in 0..#numSublocs do on (here:LocaleModel).getChild(i) {
+    var A: [1..n] int = i;
+    const want = numaNodeId(i % numNodes),
+          got = preferredNode(c_ptrTo(A):c_void_ptr);
+    if got != want then
+      writeln("sublocale ", i, ": memory prefers node ", got,
+              ", expected node ", want);
+  }
+}
+
+writeln("done");
@@ -0,0 +1,38 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#define AP_MAX_NODES (4 * 8 * sizeof(unsigned long))
+
+// the i'th NUMA node id the kernel lists, in increasing order, or -1
+static int64_t numaNodeId(int64_t i) {
+  int node;
+  for (node = 0; node < (int) AP_MAX_NODES; node++) {
+    char path[64];
+    struct stat st;
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d", node);
+    if (stat(path, &st) == 0 && i-- == 0)
+      return node;
+  }
+  return -1;
+}
+
+// the node the memory policy for the page holding p prefers, or -1
+static int64_t preferredNode(void* p) {
+  unsigned long mask[AP_MAX_NODES / (8 * sizeof(unsigned long))] = { 0 };
+  const unsigned long bits = 8 * sizeof(mask[0]);
+  int mode;
+  int node;
+
+  // MPOL_F_ADDR: report the policy for the address, not the thread
+  if (syscall(SYS_get_mempolicy, &mode, mask, AP_MAX_NODES, p, 2) != 0)
+    return -1;
+  for (node = 0; node < (int) AP_MAX_NODES; node++) {
+    if (mask[node / bits] & (1UL << (node % bits)))
+      return node;
+  }
+  return -1;
+}
@@ -0,0 +1,19 @@
+use Memory;
+
+// With --memSample=4, only about a quarter of these allocations are
+// tracked, but the ones that are should still be freed correctly.
+
+class C { var x: int; }
+
+config const n = 1000;
+
+var cs: [1..n] C;
+const before = memoryUsed();
+for i in 1..n do cs[i] = new C(i);
+const used = memoryUsed() - before;
+for c in cs do delete c;
+const after = memoryUsed();
+
+writeln("some tracked: ", used > 0);
+writeln("not all tracked: ", used < n * numBytes(int));
+writeln("all freed: ", after == before);
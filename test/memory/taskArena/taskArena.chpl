@@ -0,0 +1,48 @@
+use Memory;
+
+//
+// Exercise the per-task arena: iterator classes (zippered, so they are
+// not inlined) and recursive-iterator argument bundles, allocated and
+// freed in the main task and in tasks that end.
+//
+config const n = 1000;
+
+iter evens(n: int) {
+  for i in 1..n do
+    if i % 2 == 0 then yield i;
+}
+
+iter odds(n: int) {
+  for i in 1..n do
+    if i % 2 == 1 then yield i;
+}
+
+iter tree(depth: int): int {
+  if depth == 0 {
+    yield 1;
+  } else {
+    for x in tree(depth-1) do yield x;
+    for x in tree(depth-1) do yield x;
+  }
+}
+
+proc zipSum(n: int) {
+  var sum = 0;
+  for (e, o) in zip(evens(n), odds(n)) do
+    sum += e - o;
+  return sum;
+}
+
+var total: sync int = 0;
+coforall t in 1..4 {
+  var mine = 0;
+  for k in 1..n/100 do
+    mine += zipSum(100);
+  for x in tree(6) do
+    mine += x;
+  total += mine;
+}
+writeln("total = ", total.readFF());
+writeln("main = ", zipSum(n));
+
+printTaskArenaStats();
@@ -0,0 +1,152 @@
+// Module-level variables are broadcast from locale 0 to the others at
+// startup, in pieces that fit in an active message.  Declare enough of
+// them to need several pieces, and check that every locale sees the
+// right value for each.
+
+var g1 = 1;
+var g2 = 2;
+var g3 = 3;
+var g4 = 4;
+var g5 = 5;
+var g6 = 6;
+var g7 = 7;
+var g8 = 8;
+var g9 = 9;
+var g10 = 10;
+var g11 = 11;
+var g12 = 12;
+var g13 = 13;
+var g14 = 14;
+var g15 = 15;
+var g16 = 16;
+var g17 = 17;
+var g18 = 18;
+var g19 = 19;
+var g20 = 20;
+var g21 = 21;
+var g22 = 22;
+var g23 = 23;
+var g24 = 24;
+var g25 = 25;
+var g26 = 26;
+var g27 = 27;
+var g28 = 28;
+var g29 = 29;
+var g30 = 30;
+var g31 = 31;
+var g32 = 32;
+var g33 = 33;
+var g34 = 34;
+var g35 = 35;
+var g36 = 36;
+var g37 = 37;
+var g38 = 38;
+var g39 = 39;
+var g40 = 40;
+var g41 = 41;
+var g42 = 42;
+var g43 = 43;
+var g44 = 44;
+var g45 = 45;
+var g46 = 46;
+var g47 = 47;
+var g48 = 48;
+var g49 = 49;
+var g50 = 50;
+var g51 = 51;
+var g52 = 52;
+var g53 = 53;
+var g54 = 54;
+var g55 = 55;
+var g56 = 56;
+var g57 = 57;
+var g58 = 58;
+var g59 = 59;
+var g60 = 60;
+var g61 = 61;
+var g62 = 62;
+var g63 = 63;
+var g64 = 64;
+var g65 = 65;
+var g66 = 66;
+var g67 = 67;
+var g68 = 68;
+var g69 = 69;
+var g70 = 70;
+var g71 = 71;
+var g72 = 72;
+var g73 = 73;
+var g74 = 74;
+var g75 = 75;
+var g76 = 76;
+var g77 = 77;
+var g78 = 78;
+var g79 = 79;
+var g80 = 80;
+var g81 = 81;
+var g82 = 82;
+var g83 = 83;
+var g84 = 84;
+var g85 = 85;
+var g86 = 86;
+var g87 = 87;
+var g88 = 88;
+var g89 = 89;
+var g90 = 90;
+var g91 = 91;
+var g92 = 92;
+var g93 = 93;
+var g94 = 94;
+var g95 = 95;
+var g96 = 96;
+var g97 = 97;
+var g98 = 98;
+var g99 = 99;
+var g100 = 100;
+var g101 = 101;
+var g102 = 102;
+var g103 = 103;
+var g104 = 104;
+var g105 = 105;
+var g106 = 106;
+var g107 = 107;
+var g108 = 108;
+var g109 = 109;
+var g110 = 110;
+var g111 = 111;
+var g112 = 112;
+var g113 = 113;
+var g114 = 114;
+var g115 = 115;
+var g116 = 116;
+var g117 = 117;
+var g118 = 118;
+var g119 = 119;
+var g120 = 120;
+
+proc check() {
+  const vals = (g1, g2, g3, g4, g5, g6, g7, g8, g9, g10,
+                g11, g12, g13, g14, g15, g16, g17, g18, g19, g20,
+                g21, g22, g23, g24, g25, g26, g27, g28, g29, g30,
+                g31, g32, g33, g34, g35, g36, g37, g38, g39, g40,
+                g41, g42, g43, g44, g45, g46, g47, g48, g49, g50,
+                g51, g52, g53, g54, g55, g56, g57, g58, g59, g60,
+                g61, g62, g63, g64, g65, g66, g67, g68, g69, g70,
+                g71, g72, g73, g74, g75, g76, g77, g78, g79, g80,
+                g81, g82, g83, g84, g85, g86, g87, g88, g89, g90,
+                g91, g92, g93, g94, g95, g96, g97, g98, g99, g100,
+                g101, g102, g103, g104, g105, g106, g107, g108, g109, g110,
+                g111, g112, g113, g114, g115, g116, g117, g118, g119, g120);
+  var bad = 0;
+  for param i in 1..vals.size do
+    if vals(i) != i then bad += 1;
+  return bad;
+}
+
+for loc in Locales do on loc {
+  const bad = check();
+  if bad != 0 then
+    writeln("locale ", here.id, ": ", bad, " globals are wrong");
+}
+
+writeln("checked ", numLocales, " locales");
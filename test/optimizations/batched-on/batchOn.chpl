@@ -0,0 +1,27 @@
+use BlockDist;
+
+config const n = 10000;
+
+const D = {1..n} dmapped Block({1..n});
+var A: [D] int;
+var B: [1..n] int;
+
+// Each on-body is small and independent of the others: batchable.
+forall i in 1..n do
+  on A[i] do A[i] += i;
+
+// Reading a sync variable may wait for another task: not batchable.
+var s$: sync int = 0;
+forall i in 1..n with (ref B) do
+  on A[i] {
+    const x = s$;
+    B[i] = x + 1;
+    s$ = x + 1;
+  }
+
+// Not in an order-independent loop: not batchable.
+for i in 1..3 do
+  on A[i] do A[i] += 1;
+
+writeln("sum A = ", + reduce A);
+writeln("max B = ", max reduce B);
@@ -0,0 +1,47 @@
+use CommDiagnostics;
+
+// Reads a remote array in a pattern that reuses a small hot region
+// while also streaming through a larger one, so that the replacement
+// policy matters. Checks that the answer is right and that the cache
+// reports hits, misses, and evictions through the comm diagnostics.
+
+config const n = 200000;
+config const hot = 1000;
+config const passes = 4;
+
+var A:[1..n] int;
+
+for i in 1..n do A[i] = i;
+
+resetCommDiagnostics();
+startCommDiagnostics();
+
+var sum = 0;
+on Locales[1] {
+  var mySum = 0;
+  for p in 1..passes {
+    for i in 1..n {
+      mySum += A[i];
+      // touch the hot region again every so often
+      if i % 8 == 0 then mySum += A[1 + (i/8) % hot];
+    }
+  }
+  sum = mySum;
+}
+
+stopCommDiagnostics();
+
+var expect = 0;
+for p in 1..passes {
+  for i in 1..n {
+    expect += i;
+    if i % 8 == 0 then expect += 1 + (i/8) % hot;
+  }
+}
+
+writeln(sum == expect);
+
+var d = getCommDiagnostics();
+writeln("hits > misses: ", d(1).cache_get_hits > d(1).cache_get_misses);
+writeln("misses: ", d(1).cache_get_misses > 0);
+writeln("evictions: ", d(1).cache_evictions > 0);
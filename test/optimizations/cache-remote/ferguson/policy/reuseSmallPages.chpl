@@ -0,0 +1 @@
+reuse.chpl
\ No newline at end of file
@@ -0,0 +1,42 @@
+use CommDiagnostics;
+
+// Walks down the columns of two remote 2D arrays at once, which gives
+// the cache two interleaved fixed-stride streams of GETs. Checks that
+// the answer is right and that stride prefetching was useful.
+
+config const n = 2000;
+config const m = 32;
+
+var A:[1..n, 1..m] int;
+var B:[1..n, 1..m] int;
+
+forall (i,j) in A.domain {
+  A[i,j] = i*m + j;
+  B[i,j] = 2*(i*m + j);
+}
+
+resetCommDiagnostics();
+startCommDiagnostics();
+
+var sum = 0;
+on Locales[1] {
+  var mySum = 0;
+  for j in 1..m {
+    for i in 1..n {
+      mySum += A[i,j] + B[i,j];
+    }
+  }
+  sum = mySum;
+}
+
+stopCommDiagnostics();
+
+var expect = 0;
+for (i,j) in A.domain do expect += 3*(i*m + j);
+
+writeln(sum == expect);
+
+var d = getCommDiagnostics();
+writeln("useful prefetches: ", d(1).cache_prefetch_useful > 0);
+writeln("more useful than wasted: ",
+        d(1).cache_prefetch_useful > d(1).cache_prefetch_wasted);
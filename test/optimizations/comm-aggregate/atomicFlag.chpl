@@ -0,0 +1,35 @@
+// With PUT aggregation on, a task on Locale 0 writes an array that lives
+// on Locale 1 and then sets an atomic flag that lives on Locale 0.
+// Setting the flag has to flush the buffered PUTs, so a task on Locale 1
+// that has seen the flag must find every element in place.  The
+// .execenv makes the aggregation timeout long enough that the buffers
+// would not go out on their own.
+
+config const n = 1000;
+config const trials = 10;
+
+var errors = 0;
+
+for t in 1..trials {
+  var ready: atomic bool;
+
+  on Locales[1] {
+    var A: [1..n] int;
+    var myErrors = 0;
+
+    sync {
+      begin on Locales[0] {
+        for i in 1..n do A[i] = t * i;
+        ready.write(true);
+      }
+
+      ready.waitFor(true);
+      for i in 1..n do
+        if A[i] != t * i then myErrors += 1;
+    }
+
+    errors += myErrors;
+  }
+}
+
+writeln("errors = ", errors);
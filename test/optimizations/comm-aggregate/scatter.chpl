@@ -0,0 +1,35 @@
+// Fine-grained remote PUTs and GETs from many tasks, with PUT/GET
+// aggregation turned on in the .execenv.  Each locale scatters
+// single-element writes across the whole array, then reads them back.
+
+use BlockDist;
+
+config const n = 10000;
+
+const D = {0..#n} dmapped Block({0..#n});
+var A: [D] int;
+
+// Every locale writes a stride of the array that mostly lives elsewhere.
+coforall loc in Locales do on loc {
+  forall i in 0..#n by numLocales align here.id do
+    A[(i * 7919) % n] = i + 1;
+}
+
+// Read back from every locale, so GETs from many tasks overlap.
+var errors: atomic int;
+coforall loc in Locales do on loc {
+  forall i in 0..#n do
+    if A[(i * 7919) % n] != i + 1 then errors.add(1);
+}
+
+// A task reads back its own write immediately.
+var B: [D] int;
+on Locales[0] {
+  for i in 0..#n by 97 {
+    B[n-1-i] = i;
+    if B[n-1-i] != i then writeln("read of own write failed at ", i);
+  }
+}
+
+writeln("errors = ", errors.read());
+writeln("sum = ", + reduce A);
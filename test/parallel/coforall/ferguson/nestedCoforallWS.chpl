@@ -0,0 +1,21 @@
+// Run with work stealing and only two threads, one of which is kept
+// busy by the first begin.  The main thread then has to run all of
+// each coforall's tasks itself, even though the begins those tasks
+// start land on its deque above the rest of the coforall's tasks.
+
+config const n = 8;
+
+var release: atomic bool;
+var began: atomic int;
+
+sync {
+  begin release.waitFor(true);
+
+  coforall i in 1..n do
+    coforall j in 1..n do
+      begin began.add(1);
+
+  release.write(true);
+}
+
+writeln(began.read(), " begins ran");
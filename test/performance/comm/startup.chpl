@@ -0,0 +1,23 @@
+//
+// Measure the startup and teardown cost of a multilocale program: comm
+// layer setup, barriers, the broadcast of global variable locations and
+// of module-level constants.  Run it with many locales on one machine
+// (e.g., CHPL_COMM_SUBSTRATE=udp or smp) to see how that cost grows with
+// the number of locales.
+//
+config const n = 10;
+
+// Each of these is broadcast to every locale during module init.
+const c1 = n, c2 = 2*n, c3 = 3*n, c4 = 4*n, c5 = 5*n, c6 = 6*n, c7 = 7*n,
+      c8 = 8*n, c9 = 9*n, c10 = 10*n, c11 = 11*n, c12 = 12*n, c13 = 13*n,
+      c14 = 14*n, c15 = 15*n, c16 = 16*n;
+
+var bad: atomic int;
+
+coforall loc in Locales do on loc {
+  if c1 + c2 + c3 + c4 + c5 + c6 + c7 + c8 + c9 + c10 + c11 + c12 + c13 +
+     c14 + c15 + c16 != 136*n then
+    bad.add(1);
+}
+
+writeln("bad locales: ", bad.read());
@@ -0,0 +1,75 @@
+//
+// Measure the throughput of formatted number I/O: write n integers and
+// then n reals as text to a memory file and read them back, reporting
+// GB/s of text in each direction.
+//
+use IO, Time;
+
+config const n = 1000000;
+config const printRate = false;
+
+const f = openmem();
+var t: Timer;
+
+proc report(what: string, nbytes: int, secs: real) {
+  if printRate then
+    writeln(what, " GB/s: ", nbytes / secs / 1e9);
+}
+
+inline proc intVal(i: int) return (i * 7919) % 1000003 - 500000;
+inline proc realVal(i: int) return (i * 7919) % 1000003 / 7.0 - 70000.0;
+
+{
+  var w = f.writer(locking=false);
+  t.start();
+  for i in 1..n do w.write(intVal(i), " ");
+  w.flush();
+  t.stop();
+  const nbytes = w.offset();
+  w.close();
+  report("int write", nbytes, t.elapsed());
+  t.clear();
+
+  var r = f.reader(locking=false, end=nbytes);
+  var x, sum, count: int;
+  t.start();
+  while r.read(x) {
+    sum += x;
+    count += 1;
+  }
+  t.stop();
+  r.close();
+  report("int read", nbytes, t.elapsed());
+  t.clear();
+
+  writeln("ints ok: ", count == n && sum == + reduce [i in 1..n] intVal(i));
+}
+
+{
+  var w = f.writer(locking=false);
+  t.start();
+  for i in 1..n do w.write(realVal(i), " ");
+  w.flush();
+  t.stop();
+  const nbytes = w.offset();
+  w.close();
+  report("real write", nbytes, t.elapsed());
+  t.clear();
+
+  var r = f.reader(locking=false, end=nbytes);
+  var x, maxErr: real;
+  var count: int;
+  t.start();
+  while r.read(x) {
+    count += 1;
+    // %g prints 6 significant digits
+    maxErr = max(maxErr, abs(x - realVal(count)) / max(1.0, abs(realVal(count))));
+  }
+  t.stop();
+  r.close();
+  report("real read", nbytes, t.elapsed());
+
+  writeln("reals ok: ", count == n && maxErr < 1e-5);
+}
+
+f.close();
@@ -0,0 +1,117 @@
+//
+// Measure the throughput of LZ4 compressing channels against piping the
+// same text through an external lz4 process.  n lines of text are
+// compressed to a file and read back in chunks; rates are MB/s of uncompressed
+// text.  The external comparison is skipped if lz4 is not in PATH.
+//
+use IO, Spawn, Time, FileSystem;
+
+config const n = 1000000;
+config const printRate = false;
+config const path = "lz4-channels.tmp";
+
+var t: Timer;
+
+proc report(what: string, nbytes: int, secs: real) {
+  if printRate then
+    writeln(what, " MB/s: ", nbytes / secs / 1e6);
+}
+
+inline proc val(i: int) return (i * 7919) % 1000003;
+
+// The text is written in chunks of 1000 lines; 64 distinct chunks are
+// cycled so the data does not compress unrealistically well.
+config const linesPerChunk = 1000;
+const nchunks = n / linesPerChunk;
+var chunks: [0..#64] string;
+forall (c, k) in zip(chunks, 0..) {
+  for i in k*linesPerChunk+1..(k+1)*linesPerChunk do
+    c += "line " + i + " value " + val(i) + "\n";
+}
+
+// Writes the benchmark text to ch and returns the number of bytes written.
+proc writeText(ch) {
+  const start = ch.offset();
+  for k in 0..#nchunks do ch.write(chunks[k % 64]);
+  return ch.offset() - start;
+}
+
+// Reads the benchmark text back from ch, checking each chunk.
+proc checkText(ch) {
+  var s: string;
+  var ok = true;
+  for k in 0..#nchunks {
+    const expect = chunks[k % 64];
+    ok &&= ch.readstring(s, expect.length) && s == expect;
+  }
+  return ok && !ch.readstring(s, 1);
+}
+
+proc lz4Available() {
+  var sub = spawnshell("command -v lz4 > /dev/null 2>&1");
+  sub.wait();
+  return sub.exit_status == 0;
+}
+
+const haveLz4 = lz4Available();
+var nbytes: int;
+
+{
+  var f = open(path, iomode.cw);
+  var w = f.writer(locking=false);
+  t.start();
+  var c = w.compressed();
+  nbytes = writeText(c);
+  c.close();
+  w.close();
+  t.stop();
+  report("compress", nbytes, t.elapsed());
+  t.clear();
+  f.close();
+}
+
+{
+  var f = open(path, iomode.r);
+  var r = f.reader(locking=false);
+  t.start();
+  var c = r.compressed();
+  const ok = checkText(c);
+  t.stop();
+  c.close();
+  r.close();
+  report("decompress", nbytes, t.elapsed());
+  t.clear();
+  f.close();
+  writeln("round trip ok: ", ok);
+}
+
+if haveLz4 {
+  // lz4 reads the frame written by the compressing channel
+  var sub = spawn(["lz4", "-d", "-c", path], stdout=PIPE, locking=false);
+  t.start();
+  const ok = checkText(sub.stdout);
+  sub.wait();
+  t.stop();
+  report("lz4 process decompress", nbytes, t.elapsed());
+  t.clear();
+  if !ok || sub.exit_status != 0 then writeln("lz4 could not read the frame");
+
+  sub = spawnshell("lz4 -q -c > " + path, stdin=PIPE, locking=false);
+  t.start();
+  writeText(sub.stdin);
+  sub.wait();
+  t.stop();
+  report("lz4 process compress", nbytes, t.elapsed());
+  t.clear();
+
+  // ... and the decompressing channel reads lz4's frame
+  var f = open(path, iomode.r);
+  var r = f.reader(locking=false);
+  var c = r.compressed();
+  if !checkText(c) then writeln("could not read the frame from lz4");
+  c.close();
+  r.close();
+  f.close();
+}
+
+remove(path);
@@ -0,0 +1,55 @@
+//
+// Measure how fast the tasking layer can spawn and retire small tasks,
+// both through structured constructs (coforall, which uses task lists)
+// and through unstructured begins synchronized with a sync variable.
+//
+config const numTasks = 1000;
+config const numTrials = 10;
+config const printTiming = false;
+
+use Time;
+
+var count: atomic int;
+var t: Timer;
+
+t.start();
+for 1..numTrials do
+  coforall 1..numTasks do
+    count.add(1);
+t.stop();
+writeln("coforall tasks: ", count.read());
+if printTiming then
+  writeln("coforall spawns/sec: ", (numTasks * numTrials) / t.elapsed());
+
+count.write(0);
+t.clear();
+
+t.start();
+for 1..numTrials {
+  sync {
+    for 1..numTasks do
+      begin count.add(1);
+  }
+}
+t.stop();
+writeln("begin tasks: ", count.read());
+if printTiming then
+  writeln("begin spawns/sec: ", (numTasks * numTrials) / t.elapsed());
+
+count.write(0);
+t.clear();
+
+//
+// Nested parallelism, so that workers spawn tasks of their own and
+// idle threads have something to steal.
+//
+t.start();
+for 1..numTrials do
+  coforall 1..here.maxTaskPar do
+    coforall 1..numTasks/here.maxTaskPar do
+      count.add(1);
+t.stop();
+writeln("nested tasks: ", count.read() == numTrials * here.maxTaskPar
+                                          * (numTasks/here.maxTaskPar));
+if printTiming then
+  writeln("nested spawns/sec: ", count.read() / t.elapsed());
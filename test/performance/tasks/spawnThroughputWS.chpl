@@ -0,0 +1 @@
+spawnThroughput.chpl
\ No newline at end of file
@@ -0,0 +1,57 @@
+use Regexp;
+
+var levels = compileSet(["ERROR", "WARN(ING)?", "time(out)?", "disk"]);
+writeln("size ", levels.size);
+
+writeln("+string");
+for which in levels.matches("WARNING: disk timeout") do writeln(which);
+for which in levels.matches("all is well") do writeln(which);
+
+writeln("+channel");
+var f = openmem();
+{
+  var w = f.writer();
+  w.writeln("ok");
+  w.writeln("ERROR disk full");
+  w.writeln("");
+  w.writeln("WARN timeout on " + "x"*100000);
+  w.write("last line has no newline, but has a time");
+  w.close();
+}
+{
+  var r = f.reader();
+  for (line, which) in r.matchLines(levels) {
+    writeln(line.offset, " ", line.length, " ", which);
+  }
+  writeln("end offset ", r.offset());
+  r.close();
+}
+
+writeln("+ignorecase");
+var words: [0..1] string = ["apple", "pear"];
+var fruit = compileSet(words, ignorecase=true);
+for which in fruit.matches("An APPLE and a Pear") do writeln(which);
+
+writeln("+copies");
+var other = levels;
+{
+  var tmp = fruit;
+  other = tmp;
+}
+for which in other.matches("pears") do writeln(which);
+
+writeln("+errors");
+var err:syserr;
+var bad = compileSet(["ok", "(unclosed"], err);
+writeln(err != ENOERR);
+
+writeln("+cache");
+// Compiling the same pattern over and over, from many tasks.
+var counts: [1..8] int;
+forall t in 1..8 {
+  for i in 1..100 {
+    var re = compile("(a|b)+c");
+    if re.match("ababc").matched then counts[t] += 1;
+  }
+}
+writeln(+ reduce counts);
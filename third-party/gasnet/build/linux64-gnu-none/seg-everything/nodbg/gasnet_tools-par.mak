@@ -0,0 +1,52 @@
+# Description: Makefile fragment for GASNet_tools, GASNET_PAR mode
+# WARNING: This file is automatically generated - do NOT edit directly
+# other/gasnet_tools-fragment.mak.  Generated from gasnet_tools-fragment.mak.in by configure.
+# Copyright 2011, Dan Bonachea <bonachea@cs.berkeley.edu>
+# Terms of use are as specified in license.txt
+
+# ----------------------------------------------------------------------
+# Usage instructions:
+#
+# Clients should include this file in their Makefile, using: (no leading '#')
+#     include ###INSTALL_INCLUDE###/gasnet_tools-par.mak
+# or alternatively, just:
+#     include gasnet_tools-par.mak  
+# and use a -I###INSTALL_INCLUDE###
+# command-line option when invoking make
+#
+# Then in the Makefile, use a compile line something like this:
+#  $(GASNETTOOLS_CC) $(GASNETTOOLS_CPPFLAGS) $(GASNETTOOLS_CFLAGS) -c myfile.c
+#
+# and a link line something like this:
+#  $(GASNETTOOLS_LD) $(GASNETTOOLS_LDFLAGS) -o myfile myfile.o $(GASNETTOOLS_LIBS)
+# ----------------------------------------------------------------------
+
+GASNET_PREFIX = ###INSTALL_PREFIX###
+
+GASNETTOOLS_INCLUDES =  -I###INSTALL_INCLUDE###
+GASNETTOOLS_INCLUDES =  -I/root/repo/third-party/gasnet/GASNet-1.26.0 -I/root/repo/third-party/gasnet/GASNet-1.26.0/other -I/root/repo/third-party/gasnet/build/linux64-gnu-none/seg-everything/nodbg ###NOINSTALL###
+
+GASNETTOOLS_LIBDIR = ###INSTALL_LIB###
+GASNETTOOLS_LIBDIR = /root/repo/third-party/gasnet/build/linux64-gnu-none/seg-everything/nodbg  ###NOINSTALL###
+
+GASNETTOOLS_DEBUGFLAGS = -DNDEBUG
+
+GASNETTOOLS_THREADFLAGS_PAR = -DGASNETT_THREAD_SAFE -D_REENTRANT -D_GNU_SOURCE
+GASNETTOOLS_THREADFLAGS_SEQ =
+GASNETTOOLS_THREADFLAGS = $(GASNETTOOLS_THREADFLAGS_PAR)
+
+GASNETTOOLS_THREADLIBS_PAR = -lpthread 
+GASNETTOOLS_THREADLIBS_SEQ = 
+GASNETTOOLS_THREADLIBS = $(GASNETTOOLS_THREADLIBS_PAR)
+
+GASNETTOOLS_TOOLLIB_NAME = gasnet_tools-par
+
+GASNETTOOLS_CC = /tmp/bin/gcc 
+GASNETTOOLS_CPPFLAGS = $(GASNETTOOLS_DEBUGFLAGS) $(GASNETTOOLS_THREADFLAGS)  $(GASNETTOOLS_INCLUDES) $(MANUAL_CPPFLAGS)
+GASNETTOOLS_CFLAGS = -O3 --param max-inline-insns-single=35000 --param inline-unit-growth=10000 --param large-function-growth=200000 -Winline  $(KEEPTMP_CFLAGS) $(MANUAL_CFLAGS)
+GASNETTOOLS_LD = /tmp/bin/gcc 
+GASNETTOOLS_LDFLAGS = -O3 --param max-inline-insns-single=35000 --param inline-unit-growth=10000 --param large-function-growth=200000 -Winline  -L$(GASNETTOOLS_LIBDIR) $(MANUAL_LDFLAGS)
+GASNETTOOLS_LIBS = -l$(GASNETTOOLS_TOOLLIB_NAME) $(GASNETTOOLS_THREADLIBS)  -lm $(MANUAL_LIBS)
+GASNETTOOLS_CXX = /tmp/bin/g++ 
+GASNETTOOLS_CXXFLAGS = -O2  $(MANUAL_CXXFLAGS)
+
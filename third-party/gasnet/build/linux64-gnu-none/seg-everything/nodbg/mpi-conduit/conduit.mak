@@ -0,0 +1,19 @@
+#INSTRUCTIONS# Conduit-specific Makefile fragment settings
+#INSTRUCTIONS#
+#INSTRUCTIONS# The contents of this file are embedded into the 
+#INSTRUCTIONS# *-(seq,par,parsync).mak Makefile fragments at conduit build time
+#INSTRUCTIONS# The settings in those fragments are used to build GASNet clients
+#INSTRUCTIONS# (including the GASNet tests). 
+#INSTRUCTIONS# See the conduit-writer instructions in the generated fragments
+#INSTRUCTIONS# or $(top_srcdir)/other/fragment-head.mak.in for usage info.
+
+# AMMPI is MPI-based, which requires us to link using the system MPI compiler
+GASNET_LD_OVERRIDE = /usr/bin/mpicc 
+GASNET_LDFLAGS_OVERRIDE =  -O3 --param max-inline-insns-single=35000 --param inline-unit-growth=10000 --param large-function-growth=200000 -Winline 
+
+# hooks for using AMMPI library from within build tree ###NOINSTALL### 
+# (nothing additional required for installed copy)     ###NOINSTALL###
+CONDUIT_INCLUDES = -I/root/repo/third-party/gasnet/GASNet-1.26.0/other/ammpi          ###NOINSTALL###
+CONDUIT_LIBDIRS =  -L/root/repo/third-party/gasnet/build/linux64-gnu-none/seg-everything/nodbg/other/ammpi        ###NOINSTALL###
+
+CONDUIT_LIBS = -lammpi 
@@ -0,0 +1,23 @@
+#INSTRUCTIONS# Conduit-specific Makefile fragment settings
+#INSTRUCTIONS#
+#INSTRUCTIONS# The contents of this file are embedded into the 
+#INSTRUCTIONS# *-(seq,par,parsync).mak Makefile fragments at conduit build time
+#INSTRUCTIONS# The settings in those fragments are used to build GASNet clients
+#INSTRUCTIONS# (including the GASNet tests). 
+#INSTRUCTIONS# See the conduit-writer instructions in the generated fragments
+#INSTRUCTIONS# or $(top_srcdir)/other/fragment-head.mak.in for usage info.
+
+# When ofi-conduit uses an MPI-based bootstrapper, we must
+# link using the system MPI compiler
+GASNET_LD_OVERRIDE = /usr/bin/mpicc 
+GASNET_LDFLAGS_OVERRIDE =  -O3 --param max-inline-insns-single=35000 --param inline-unit-growth=10000 --param large-function-growth=200000 -Winline 
+MPI_COMPAT_LIBS = 
+
+# Some platforms need extra -libs for the socket calls in ssh-spawner:
+SSH_LIBS = 
+
+
+CONDUIT_INCLUDES = -I ###NOINSTALL###
+
+CONDUIT_LIBDIRS = -L 
+CONDUIT_LIBS =  $(MPI_COMPAT_LIBS) $(SSH_LIBS) 
@@ -0,0 +1,20 @@
+/*   $Source: bitbucket.org:berkeleylab/gasnet.git/mpi-conduit/gasnet_core_help.h $
+ * Description: GASNet MPI conduit core Header Helpers (Internal code, not for client use)
+ * Copyright 2002, Dan Bonachea <bonachea@cs.berkeley.edu>
+ * Terms of use are as specified in license.txt
+ */
+
+#ifndef _IN_GASNET_H
+  #error This file is not meant to be included directly- clients should include gasnet.h
+#endif
+
+#ifndef _GASNET_CORE_HELP_H
+#define _GASNET_CORE_HELP_H
+
+GASNETI_BEGIN_EXTERNC
+
+#include <gasnet_help.h>
+
+GASNETI_END_EXTERNC
+
+#endif
@@ -0,0 +1,9 @@
+#!/bin/sh
+
+prefix=/root/repo/third-party/jemalloc/../../third-party/jemalloc/install/linux64-gnu-none
+exec_prefix=/root/repo/third-party/jemalloc/../../third-party/jemalloc/install/linux64-gnu-none
+libdir=${exec_prefix}/lib
+
+LD_PRELOAD=${libdir}/libjemalloc.so.2
+export LD_PRELOAD
+exec "$@"
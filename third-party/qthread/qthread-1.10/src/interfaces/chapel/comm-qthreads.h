@@ -24,12 +24,8 @@
 extern int32_t chpl_localeID; // unique ID for each locale: 0, 1, 2, ...
 extern int32_t chpl_numLocales; // number of locales
 
-extern int32_t chpl_numPrivateObjects;
-extern void** chpl_privateObjects; // privatized array and domain objects
-
-#define chpl_numPrivatizedClasses() chpl_numPrivateObjects
-extern void chpl_newPrivatizedClass(void*);
-extern void* chpl_getPrivatizedClass(int32_t);
+extern void chpl_newPrivatizedClass(void*, int64_t);
+extern void* chpl_getPrivatizedClass(int64_t);
 
 //
 // Shared interface (implemented in the compiler generated code)